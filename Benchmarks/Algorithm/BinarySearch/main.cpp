@@ -0,0 +1,118 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Find.hpp>
+#include <Prism/Containers/EytzingerArray.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr usize QUERIES = 1 << 16;
+
+    // Every other value, so half of the queries miss
+    Vector<u32>     GenerateSorted(usize size)
+    {
+        Vector<u32> sorted(size);
+        for (usize i = 0; i < size; ++i) sorted[i] = static_cast<u32>(i * 2);
+        return sorted;
+    }
+    Vector<u32> GenerateQueries(usize size)
+    {
+        Vector<u32> queries(QUERIES);
+        u64         state = 0x2545'f491'4f6c'dd1dull;
+        for (usize i = 0; i < QUERIES; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            queries[i] = static_cast<u32>(state % (size * 2));
+        }
+
+        return queries;
+    }
+
+    // A textbook lower bound, branching on every comparison
+    template <typename It, typename T>
+    It BranchyLowerBound(It first, It last, const T& value)
+    {
+        isize length = last - first;
+        while (length > 0)
+        {
+            isize half = length / 2;
+            if (first[half] < value)
+            {
+                first += half + 1;
+                length -= half + 1;
+            }
+            else length = half;
+        }
+
+        return first;
+    }
+
+    template <typename Search>
+    void Run(benchmark::State& state, Search search)
+    {
+        usize       size    = state.range(0);
+        Vector<u32> sorted  = GenerateSorted(size);
+        Vector<u32> queries = GenerateQueries(size);
+        auto        find    = search(sorted);
+
+        usize       i       = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(find(queries[i]));
+            i = (i + 1) % QUERIES;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void Sizes(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgName("size");
+        bench->Arg(1'000)->Arg(1'000'000)->Arg(100'000'000);
+    }
+} // namespace
+
+static void BinarySearch_Branchy(benchmark::State& state)
+{
+    Run(state,
+        [](const Vector<u32>& sorted)
+        {
+            return [&sorted](u32 value)
+            { return BranchyLowerBound(sorted.begin(), sorted.end(), value); };
+        });
+}
+BENCHMARK(BinarySearch_Branchy)->Apply(Sizes);
+
+static void BinarySearch_LowerBound(benchmark::State& state)
+{
+    Run(state,
+        [](const Vector<u32>& sorted)
+        {
+            return [&sorted](u32 value)
+            { return LowerBound(sorted.begin(), sorted.end(), value); };
+        });
+}
+BENCHMARK(BinarySearch_LowerBound)->Apply(Sizes);
+
+static void BinarySearch_Eytzinger(benchmark::State& state)
+{
+    Run(state,
+        [](const Vector<u32>& sorted)
+        {
+            return [array = EytzingerArray<u32>(sorted.begin(), sorted.end())](
+                       u32 value) { return array.LowerBound(value); };
+        });
+}
+BENCHMARK(BinarySearch_Eytzinger)->Apply(Sizes);
+
+BENCHMARK_MAIN();
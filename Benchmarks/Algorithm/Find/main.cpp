@@ -0,0 +1,84 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Find.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    // A table of process ids, searched for one that is not in it
+    Vector<u32> Generate(usize size)
+    {
+        Vector<u32> pids(size);
+        for (usize i = 0; i < size; ++i) pids[i] = static_cast<u32>(i + 1);
+        return pids;
+    }
+
+    // The previous Find: one element at a time
+    template <typename It, typename T>
+    [[gnu::noinline]] It ScalarFind(It first, It last, const T& value)
+    {
+        for (; first != last; ++first)
+            if (*first == value) break;
+        return first;
+    }
+    template <typename It, typename T>
+    [[gnu::noinline]] usize ScalarCount(It first, It last, const T& value)
+    {
+        usize count = 0;
+        for (; first != last; ++first)
+            if (*first == value) ++count;
+        return count;
+    }
+
+    void Sizes(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgName("size");
+        for (i64 size = 16; size <= (1 << 20); size *= 16) bench->Arg(size);
+    }
+} // namespace
+
+static void Find_Scalar(benchmark::State& state)
+{
+    Vector<u32> pids = Generate(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ScalarFind(pids.begin(), pids.end(), 0u));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(Find_Scalar)->Apply(Sizes);
+
+static void Find_Simd(benchmark::State& state)
+{
+    Vector<u32> pids = Generate(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Find(pids.begin(), pids.end(), 0u));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(Find_Simd)->Apply(Sizes);
+
+static void Count_Scalar(benchmark::State& state)
+{
+    Vector<u32> pids = Generate(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ScalarCount(pids.begin(), pids.end(), 7u));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(Count_Scalar)->Apply(Sizes);
+
+static void Count_Simd(benchmark::State& state)
+{
+    Vector<u32> pids = Generate(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Count(pids.begin(), pids.end(), 7u));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(Count_Simd)->Apply(Sizes);
+
+BENCHMARK_MAIN();
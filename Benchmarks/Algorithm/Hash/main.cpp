@@ -0,0 +1,73 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Hash.hpp>
+#include <Prism/Algorithm/WyHash.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    Vector<u8> MakeInput(usize size)
+    {
+        Vector<u8> input;
+        input.Resize(size);
+        for (usize i = 0; i < size; ++i)
+            input[i] = static_cast<u8>(i * 131 + (i >> 5));
+
+        return input;
+    }
+    void InputSizes(benchmark::internal::Benchmark* bench)
+    {
+        for (i64 size : {8, 16, 32, 64, 256, 1024, 4096, 65536})
+            bench->Arg(size);
+    }
+} // namespace
+
+static void Hash_Murmur2(benchmark::State& state)
+{
+    auto input = MakeInput(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(input.Raw());
+        benchmark::DoNotOptimize(
+            Murmur::Hash2(input.Raw(), input.Size(), 0xc70f6907ul));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.Size());
+}
+BENCHMARK(Hash_Murmur2)->Apply(InputSizes);
+
+static void Hash_FNV1a(benchmark::State& state)
+{
+    auto input = MakeInput(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(input.Raw());
+        benchmark::DoNotOptimize(FNV1a::Hash(input.Raw(), input.Size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.Size());
+}
+BENCHMARK(Hash_FNV1a)->Apply(InputSizes);
+
+static void Hash_WyHash(benchmark::State& state)
+{
+    auto input = MakeInput(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(input.Raw());
+        benchmark::DoNotOptimize(WyHash::Hash(input.Raw(), input.Size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.Size());
+}
+BENCHMARK(Hash_WyHash)->Apply(InputSizes);
+
+BENCHMARK_MAIN();
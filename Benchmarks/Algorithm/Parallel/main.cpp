@@ -0,0 +1,207 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Parallel.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr usize SIZE = 4'000'000;
+
+    // A minimal hosted executor: the workers and the calling thread pull
+    // task indices off a shared counter until the batch is done
+    class ThreadPool
+    {
+      public:
+        explicit ThreadPool(usize threads)
+            : m_Concurrency(threads)
+        {
+            for (usize i = 1; i < threads; ++i)
+                m_Workers.emplace_back([this] { Work(); });
+        }
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard lock(m_Lock);
+                m_Stopping = true;
+            }
+            m_Wake.notify_all();
+            for (auto& worker : m_Workers) worker.join();
+        }
+
+        usize Concurrency() const { return m_Concurrency; }
+
+        template <typename Task>
+        void Run(usize count, Task&& task)
+        {
+            if (m_Workers.empty() || count == 1)
+            {
+                for (usize i = 0; i < count; ++i) task(i);
+                return;
+            }
+
+            {
+                std::lock_guard lock(m_Lock);
+                m_Task = [&task](usize i) { task(i); };
+                m_Next.store(0);
+                m_Count   = count;
+                m_Pending = count;
+                ++m_Generation;
+            }
+            m_Wake.notify_all();
+
+            Drain();
+            std::unique_lock lock(m_Lock);
+            m_Done.wait(lock, [this] { return m_Pending == 0; });
+        }
+
+      private:
+        usize                           m_Concurrency;
+        std::vector<std::thread>        m_Workers;
+        std::mutex                      m_Lock;
+        std::condition_variable         m_Wake;
+        std::condition_variable         m_Done;
+        std::function<void(usize)>      m_Task;
+        std::atomic<usize>              m_Next{0};
+        usize                           m_Count      = 0;
+        usize                           m_Pending    = 0;
+        usize                           m_Generation = 0;
+        bool                            m_Stopping   = false;
+
+        void                            Drain()
+        {
+            usize finished = 0;
+            for (usize i = m_Next++; i < m_Count; i = m_Next++)
+            {
+                m_Task(i);
+                ++finished;
+            }
+            if (!finished) return;
+
+            std::lock_guard lock(m_Lock);
+            m_Pending -= finished;
+            if (m_Pending == 0) m_Done.notify_all();
+        }
+        void Work()
+        {
+            usize seen = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock lock(m_Lock);
+                    m_Wake.wait(lock, [&]
+                                { return m_Stopping || m_Generation != seen; });
+                    if (m_Stopping) return;
+                    seen = m_Generation;
+                }
+                Drain();
+            }
+        }
+    };
+
+    Vector<u32> Generate()
+    {
+        Vector<u32> input(SIZE);
+        u64         state = 0x2545'f491'4f6c'dd1dull;
+        for (usize i = 0; i < SIZE; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            input[i] = static_cast<u32>(state);
+        }
+
+        return input;
+    }
+
+    template <typename Algorithm>
+    void RunSort(benchmark::State& state, Algorithm algorithm)
+    {
+        ThreadPool  pool(state.range(0));
+        Vector<u32> input = Generate();
+        Vector<u32> work(SIZE);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            for (usize i = 0; i < SIZE; ++i) work[i] = input[i];
+            state.ResumeTiming();
+
+            algorithm(pool, work.begin(), work.end());
+            benchmark::DoNotOptimize(work.Raw());
+        }
+
+        state.SetItemsProcessed(state.iterations() * SIZE);
+    }
+    template <typename Algorithm>
+    void RunScan(benchmark::State& state, Algorithm algorithm)
+    {
+        ThreadPool  pool(state.range(0));
+        Vector<u32> input = Generate();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(
+                algorithm(pool, input.begin(), input.end()));
+
+        state.SetItemsProcessed(state.iterations() * SIZE);
+        state.SetBytesProcessed(state.iterations() * SIZE * sizeof(u32));
+    }
+
+    void Threads(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgName("threads")->UseRealTime();
+        usize cpus = Max(1u, std::thread::hardware_concurrency());
+        for (usize threads = 1; threads <= cpus; threads *= 2)
+            bench->Arg(threads);
+    }
+} // namespace
+
+static void Parallel_Sort(benchmark::State& state)
+{
+    RunSort(state, [](auto& pool, auto first, auto last)
+            { Sort(pool, first, last); });
+}
+BENCHMARK(Parallel_Sort)->Apply(Threads);
+
+static void Parallel_StableSort(benchmark::State& state)
+{
+    RunSort(state, [](auto& pool, auto first, auto last)
+            { StableSort(pool, first, last); });
+}
+BENCHMARK(Parallel_StableSort)->Apply(Threads);
+
+static void Parallel_CountIf(benchmark::State& state)
+{
+    RunScan(state,
+            [](auto& pool, auto first, auto last)
+            {
+                return CountIf(pool, first, last,
+                               [](u32 value) { return value % 3 == 0; });
+            });
+}
+BENCHMARK(Parallel_CountIf)->Apply(Threads);
+
+static void Parallel_Reduce(benchmark::State& state)
+{
+    RunScan(state,
+            [](auto& pool, auto first, auto last)
+            {
+                return Reduce(pool, first, last, u64(0),
+                              [](u64 lhs, u64 rhs) { return lhs + rhs; });
+            });
+}
+BENCHMARK(Parallel_Reduce)->Apply(Threads);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,211 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Sort.hpp>
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/String/StringView.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr usize SIZE = 100'000;
+
+    enum class Distribution
+    {
+        eRandom,
+        eSorted,
+        eReversed,
+        eSawtooth,
+        eFewUnique,
+        eMostlySorted,
+    };
+
+    Vector<u32> Generate(Distribution distribution)
+    {
+        Vector<u32> input(SIZE);
+        u64         state = 0x2545'f491'4f6c'dd1dull;
+        for (usize i = 0; i < SIZE; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            switch (distribution)
+            {
+                case Distribution::eRandom:
+                    input[i] = static_cast<u32>(state);
+                    break;
+                case Distribution::eSorted: input[i] = i; break;
+                case Distribution::eReversed: input[i] = SIZE - i; break;
+                case Distribution::eSawtooth: input[i] = i % 1000; break;
+                case Distribution::eFewUnique: input[i] = state % 8; break;
+                // Appended to in order, with the odd late arrival
+                case Distribution::eMostlySorted:
+                    input[i] = state % 1000 ? i : static_cast<u32>(state);
+                    break;
+            }
+        }
+
+        return input;
+    }
+
+    // The previous MergeSort: top-down, copying both halves at every level
+    template <typename It, typename Compare>
+    void CopyingMergeSort(It first, It last, Compare comp)
+    {
+        isize size = last - first;
+        if (size <= 1) return;
+
+        It mid = first + size / 2;
+        CopyingMergeSort(first, mid, comp);
+        CopyingMergeSort(mid, last, comp);
+
+        Vector<u32> left(first, mid);
+        Vector<u32> right(mid, last);
+        auto        l   = left.begin();
+        auto        r   = right.begin();
+        It          out = first;
+        while (l != left.end() && r != right.end())
+            *out++ = comp(*r, *l) ? *r++ : *l++;
+        while (l != left.end()) *out++ = *l++;
+        while (r != right.end()) *out++ = *r++;
+    }
+
+    template <typename Sorter>
+    void Run(benchmark::State& state, Sorter sorter)
+    {
+        auto        distribution = static_cast<Distribution>(state.range(0));
+        Vector<u32> input        = Generate(distribution);
+        Vector<u32> work(SIZE);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            for (usize i = 0; i < SIZE; ++i) work[i] = input[i];
+            state.ResumeTiming();
+
+            sorter(work.begin(), work.end());
+            benchmark::DoNotOptimize(work.Raw());
+        }
+
+        state.SetItemsProcessed(state.iterations() * SIZE);
+    }
+    void Distributions(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgName("distribution");
+        for (i64 distribution = 0; distribution < 6; ++distribution)
+            bench->Arg(distribution);
+    }
+} // namespace
+
+// The previous Sort: introsort with a Hoare partition
+static void Sort_IntroSort(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last)
+        { IntroSort(first, last, Less<u32>{}); });
+}
+BENCHMARK(Sort_IntroSort)->Apply(Distributions);
+
+static void Sort_PdqSort(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last) { Sort(first, last); });
+}
+BENCHMARK(Sort_PdqSort)->Apply(Distributions);
+
+// A comparator the branchless partition does not apply to
+static void Sort_PdqSortBranchy(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last)
+        { Sort(first, last, [](u32 lhs, u32 rhs) { return lhs < rhs; }); });
+}
+BENCHMARK(Sort_PdqSortBranchy)->Apply(Distributions);
+
+static void Sort_CopyingMergeSort(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last)
+        { CopyingMergeSort(first, last, Less<u32>{}); });
+}
+BENCHMARK(Sort_CopyingMergeSort)->Apply(Distributions);
+
+static void Sort_StableSort(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last) { StableSort(first, last); });
+}
+BENCHMARK(Sort_StableSort)->Apply(Distributions);
+
+static void Sort_StableSortInPlace(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last) { StableSortInPlace(first, last); });
+}
+BENCHMARK(Sort_StableSortInPlace)->Apply(Distributions);
+
+static void Sort_RadixSort(benchmark::State& state)
+{
+    Run(state, [](auto first, auto last) { RadixSort(first, last); });
+}
+BENCHMARK(Sort_RadixSort)->Apply(Distributions);
+
+namespace
+{
+    Vector<StringView> GenerateStrings(Vector<char>& storage)
+    {
+        constexpr usize LENGTH = 16;
+        storage.Resize(SIZE * LENGTH);
+
+        Vector<StringView> strings(SIZE);
+        u64                state = 0x2545'f491'4f6c'dd1dull;
+        for (usize i = 0; i < SIZE; ++i)
+        {
+            char* string = storage.Raw() + i * LENGTH;
+            for (usize j = 0; j < LENGTH; ++j)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                string[j] = static_cast<char>('a' + state % 26);
+            }
+            strings[i] = StringView(string, LENGTH);
+        }
+
+        return strings;
+    }
+
+    template <typename Sorter>
+    void RunStrings(benchmark::State& state, Sorter sorter)
+    {
+        Vector<char>       storage;
+        Vector<StringView> input = GenerateStrings(storage);
+        Vector<StringView> work(SIZE);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            for (usize i = 0; i < SIZE; ++i) work[i] = input[i];
+            state.ResumeTiming();
+
+            sorter(work.begin(), work.end());
+            benchmark::DoNotOptimize(work.Raw());
+        }
+
+        state.SetItemsProcessed(state.iterations() * SIZE);
+    }
+} // namespace
+
+static void Sort_Strings(benchmark::State& state)
+{
+    RunStrings(state, [](auto first, auto last)
+               { Sort(first, last, Less<StringView>{}); });
+}
+BENCHMARK(Sort_Strings);
+
+static void Sort_StringsAmericanFlag(benchmark::State& state)
+{
+    RunStrings(state, [](auto first, auto last) { RadixSort(first, last); });
+}
+BENCHMARK(Sort_StringsAmericanFlag);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,57 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions so that benchmarks can report how
+// many heap allocations an operation performs next to its timing. Include it
+// from exactly one translation unit of a benchmark executable.
+namespace Prism::Benchmark
+{
+    inline thread_local std::size_t s_AllocationCount = 0;
+
+    /**
+     * @brief Tracks the allocations performed while it is alive and reports
+     * them as a per-iteration counter once the benchmark loop finishes.
+     */
+    class AllocationScope
+    {
+      public:
+        explicit AllocationScope(benchmark::State& state)
+            : m_State(state)
+            , m_Start(s_AllocationCount)
+        {
+        }
+        ~AllocationScope()
+        {
+            m_State.counters["allocs"] = benchmark::Counter(
+                static_cast<double>(s_AllocationCount - m_Start),
+                benchmark::Counter::kAvgIterations);
+        }
+
+      private:
+        benchmark::State& m_State;
+        std::size_t       m_Start;
+    };
+}; // namespace Prism::Benchmark
+
+void* operator new(std::size_t size)
+{
+    ++Prism::Benchmark::s_AllocationCount;
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void  operator delete(void* ptr) noexcept { std::free(ptr); }
+void  operator delete[](void* ptr) noexcept { std::free(ptr); }
+void  operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void  operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
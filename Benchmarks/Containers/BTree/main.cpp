@@ -0,0 +1,133 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/BTree.hpp>
+#include <Prism/Containers/RedBlackTree.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr usize QUERIES = 1 << 16;
+
+    Vector<u64>     GenerateKeys(usize count, u64 seed)
+    {
+        Vector<u64> keys(count);
+        u64         state = seed;
+        for (usize i = 0; i < count; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            keys[i] = state;
+        }
+
+        return keys;
+    }
+
+    template <typename Tree>
+    void Fill(Tree& tree, const Vector<u64>& keys)
+    {
+        for (u64 key : keys) tree.Insert(key, u64(key));
+    }
+
+    void Sizes(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgName("size");
+        bench->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+    }
+
+    template <typename Tree>
+    void RunFind(benchmark::State& state)
+    {
+        Vector<u64> keys = GenerateKeys(state.range(0), 0x2545'f491'4f6c'dd1d);
+        Tree        tree;
+        Fill(tree, keys);
+
+        // Half of the queries hit
+        Vector<u64> queries = GenerateKeys(QUERIES, 0x9e37'79b9'7f4a'7c15);
+        for (usize i = 0; i < QUERIES; i += 2)
+            queries[i] = keys[queries[i] % keys.Size()];
+
+        usize i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(tree.Contains(queries[i]));
+            i = (i + 1) % QUERIES;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <typename Tree>
+    void RunInsert(benchmark::State& state)
+    {
+        Vector<u64> keys = GenerateKeys(state.range(0), 0x2545'f491'4f6c'dd1d);
+        for (auto _ : state)
+        {
+            Tree tree;
+            Fill(tree, keys);
+            benchmark::DoNotOptimize(tree.GetSize());
+        }
+
+        state.SetItemsProcessed(state.iterations() * keys.Size());
+    }
+
+    template <typename Tree>
+    void RunIterate(benchmark::State& state)
+    {
+        Vector<u64> keys = GenerateKeys(state.range(0), 0x2545'f491'4f6c'dd1d);
+        Tree        tree;
+        Fill(tree, keys);
+
+        for (auto _ : state)
+        {
+            u64 sum = 0;
+            for (const auto& entry : tree) sum += entry.Value;
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * keys.Size());
+    }
+
+    using RedBlack = RedBlackTree<u64, u64>;
+    using BPlus    = BTree<u64, u64>;
+} // namespace
+
+static void Find_RedBlackTree(benchmark::State& state)
+{
+    RunFind<RedBlack>(state);
+}
+BENCHMARK(Find_RedBlackTree)->Apply(Sizes);
+
+static void Find_BTree(benchmark::State& state) { RunFind<BPlus>(state); }
+BENCHMARK(Find_BTree)->Apply(Sizes);
+
+static void Insert_RedBlackTree(benchmark::State& state)
+{
+    RunInsert<RedBlack>(state);
+}
+BENCHMARK(Insert_RedBlackTree)->Apply(Sizes);
+
+static void Insert_BTree(benchmark::State& state) { RunInsert<BPlus>(state); }
+BENCHMARK(Insert_BTree)->Apply(Sizes);
+
+static void Iterate_RedBlackTree(benchmark::State& state)
+{
+    RunIterate<RedBlack>(state);
+}
+BENCHMARK(Iterate_RedBlackTree)->Apply(Sizes);
+
+static void Iterate_BTree(benchmark::State& state)
+{
+    RunIterate<BPlus>(state);
+}
+BENCHMARK(Iterate_BTree)->Apply(Sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Common/AllocationCounter.hpp>
+
+#include <Prism/Containers/UnorderedMap.hpp>
+#include <Prism/String/String.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+using namespace Prism::Literals;
+
+namespace
+{
+    constexpr StringView s_Identifiers[] = {
+        "pid",
+        "ppid",
+        "uid",
+        "gid",
+        "cwd",
+        "cmdline",
+        "environ",
+        "mountinfo",
+        "oom_score_adj",
+        "sched_autogroup",
+        "timerslack_ns",
+        "coredump_filter",
+        "personality",
+        "loginuid",
+        "sessionid",
+        "stack",
+        "syscall",
+        "numa_maps",
+        "projid_map",
+        "setgroups",
+        "patch_state",
+        "seccomp_filter_mode",
+        "io_uring_sq_thread_cpu",
+    };
+    constexpr StringView s_PathComponents[]
+        = {"usr", "local", "share", "fonts", "truetype", "dejavu"};
+}; // namespace
+
+static void BasicString_ConstructIdentifier(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        for (auto identifier : s_Identifiers)
+        {
+            String string(identifier);
+            benchmark::DoNotOptimize(string.Raw());
+        }
+    }
+}
+BENCHMARK(BasicString_ConstructIdentifier);
+
+static void BasicString_MoveIdentifier(benchmark::State& state)
+{
+    String source = "io_uring_sq_thread_cpu"_s;
+
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        String moved = Move(source);
+        benchmark::DoNotOptimize(moved.Raw());
+        source = Move(moved);
+    }
+}
+BENCHMARK(BasicString_MoveIdentifier);
+
+static void BasicString_AppendPath(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        String path;
+        for (auto component : s_PathComponents)
+        {
+            path += '/';
+            path += component;
+        }
+
+        benchmark::DoNotOptimize(path.Raw());
+    }
+}
+BENCHMARK(BasicString_AppendPath);
+
+static void BasicString_ConcatenateChain(benchmark::State& state)
+{
+    String root = "/usr"_s;
+
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        String path = root + "/local" + "/share" + "/fonts" + "/truetype";
+        benchmark::DoNotOptimize(path.Raw());
+    }
+}
+BENCHMARK(BasicString_ConcatenateChain);
+
+static void BasicString_UnorderedMapIdentifiers(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        UnorderedMap<String, usize> map(64);
+        for (usize i = 0; auto identifier : s_Identifiers)
+            map[String(identifier)] = i++;
+
+        usize found = 0;
+        for (auto identifier : s_Identifiers)
+            found += map.Contains(String(identifier));
+
+        benchmark::DoNotOptimize(found);
+    }
+}
+BENCHMARK(BasicString_UnorderedMapIdentifiers);
+
+BENCHMARK_MAIN();
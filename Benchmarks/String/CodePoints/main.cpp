@@ -0,0 +1,162 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/String/CodePoints.hpp>
+#include <Prism/String/StringView.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    // File names and console input are mostly ASCII with the occasional
+    // multi-byte character; the second corpus is mostly non-ASCII
+    Vector<char8_t> MakeText(const char8_t* word, usize wordSize, usize size)
+    {
+        Vector<char8_t> text;
+        text.Reserve(size + wordSize);
+        while (text.Size() < size)
+            for (usize i = 0; i < wordSize; ++i) text.PushBack(word[i]);
+
+        return text;
+    }
+    const char8_t s_AsciiWord[] = u8"/usr/share/locale/pl/LC_MESSAGES/";
+    const char8_t s_MixedWord[] = u8"zażółć gęślą jaźń /dev/tty €𝄞 ";
+
+    constexpr usize TEXT_SIZE = 64 * 1024;
+
+    // One code point at a time, without the ASCII fast path
+    bool ValidateScalar(const char8_t* data, usize size)
+    {
+        for (usize i = 0; i < size;)
+        {
+            char32_t codePoint = 0;
+            usize    length = CodePoints::DecodeUtf8(data + i, size - i,
+                                                     codePoint);
+            if (length == 0) return false;
+            i += length;
+        }
+
+        return true;
+    }
+}; // namespace
+
+template <const char8_t* Word, usize WordSize>
+static void CodePoints_ValidateScalar(benchmark::State& state)
+{
+    auto text = MakeText(Word, WordSize - 1, TEXT_SIZE);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ValidateScalar(text.Raw(), text.Size()));
+    state.SetBytesProcessed(state.iterations() * text.Size());
+}
+template <const char8_t* Word, usize WordSize>
+static void CodePoints_ValidateUtf8(benchmark::State& state)
+{
+    auto text = MakeText(Word, WordSize - 1, TEXT_SIZE);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            CodePoints::IsValidUtf8(text.Raw(), text.Size()));
+    state.SetBytesProcessed(state.iterations() * text.Size());
+}
+template <const char8_t* Word, usize WordSize>
+static void CodePoints_Utf8ToUtf16(benchmark::State& state)
+{
+    auto              text = MakeText(Word, WordSize - 1, TEXT_SIZE);
+    Vector<char16_t> output(
+        CodePoints::Utf16LengthFromUtf8(text.Raw(), text.Size()), 0);
+    for (auto _ : state)
+    {
+        auto result = CodePoints::ConvertUtf8ToUtf16(
+            text.Raw(), text.Size(), output.Raw(), output.Size());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * text.Size());
+}
+template <const char8_t* Word, usize WordSize>
+static void CodePoints_Utf8ToUtf32(benchmark::State& state)
+{
+    auto              text = MakeText(Word, WordSize - 1, TEXT_SIZE);
+    Vector<char32_t> output(
+        CodePoints::Utf32LengthFromUtf8(text.Raw(), text.Size()), 0);
+    for (auto _ : state)
+    {
+        auto result = CodePoints::ConvertUtf8ToUtf32(
+            text.Raw(), text.Size(), output.Raw(), output.Size());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * text.Size());
+}
+
+// Character-class operations: the per-character loops they replace are
+// the baseline
+static void CodePoints_ToUpperScalar(benchmark::State& state)
+{
+    auto text = MakeText(s_AsciiWord, sizeof(s_AsciiWord) - 1, state.range(0));
+    for (auto _ : state)
+    {
+        for (auto& c : text) c = CodePoints::ToUpper(c);
+        for (auto& c : text) c = CodePoints::ToLower(c);
+        benchmark::DoNotOptimize(text.Raw());
+    }
+    state.SetBytesProcessed(state.iterations() * text.Size() * 2);
+}
+BENCHMARK(CodePoints_ToUpperScalar)->Arg(64)->Arg(TEXT_SIZE);
+static void CodePoints_ToUpperInPlace(benchmark::State& state)
+{
+    auto text = MakeText(s_AsciiWord, sizeof(s_AsciiWord) - 1, state.range(0));
+    for (auto _ : state)
+    {
+        CodePoints::ToUpperInPlace(text.Raw(), text.Size());
+        CodePoints::ToLowerInPlace(text.Raw(), text.Size());
+        benchmark::DoNotOptimize(text.Raw());
+    }
+    state.SetBytesProcessed(state.iterations() * text.Size() * 2);
+}
+BENCHMARK(CodePoints_ToUpperInPlace)->Arg(64)->Arg(TEXT_SIZE);
+
+static void CodePoints_CountAlpha(benchmark::State& state)
+{
+    auto text = MakeText(s_MixedWord, sizeof(s_MixedWord) - 1, TEXT_SIZE);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(CodePoints::CountIf(
+            text.Raw(), text.Size(), CodePoints::CharacterClass::eAlpha));
+    state.SetBytesProcessed(state.iterations() * text.Size());
+}
+BENCHMARK(CodePoints_CountAlpha);
+
+// A config line padded with indentation and trailing blanks
+static void CodePoints_TrimLine(benchmark::State& state)
+{
+    const StringView line
+        = "                        log_level = debug             \r\n";
+    for (auto _ : state) benchmark::DoNotOptimize(line.Trim().Raw());
+}
+BENCHMARK(CodePoints_TrimLine);
+
+static void CodePoints_EqualsIgnoreCase(benchmark::State& state)
+{
+    const StringView key = "Sec-WebSocket-Extensions";
+    const StringView candidates[]
+        = {"sec-websocket-extensions", "SEC-WEBSOCKET-PROTOCOL",
+           "sec-websocket-accept", "Sec-WebSocket-Extension"};
+    for (auto _ : state)
+        for (auto candidate : candidates)
+            benchmark::DoNotOptimize(key.EqualsIgnoreCase(candidate));
+}
+BENCHMARK(CodePoints_EqualsIgnoreCase);
+
+#define CODE_POINTS_BENCHMARK(name)                                            \
+    BENCHMARK(name<s_AsciiWord, sizeof(s_AsciiWord)>)->Name(#name "/Ascii");   \
+    BENCHMARK(name<s_MixedWord, sizeof(s_MixedWord)>)->Name(#name "/Mixed")
+
+CODE_POINTS_BENCHMARK(CodePoints_ValidateScalar);
+CODE_POINTS_BENCHMARK(CodePoints_ValidateUtf8);
+CODE_POINTS_BENCHMARK(CodePoints_Utf8ToUtf16);
+CODE_POINTS_BENCHMARK(CodePoints_Utf8ToUtf32);
+
+BENCHMARK_MAIN();
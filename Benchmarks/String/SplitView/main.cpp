@@ -0,0 +1,72 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Common/AllocationCounter.hpp>
+
+#include <Prism/String/SplitView.hpp>
+#include <Prism/String/String.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr StringView PATH
+        = "/usr/local/share/cryptix/modules/drivers/storage/nvme.ko";
+    constexpr StringView COMMAND_LINE
+        = "  mount -t ext2  -o ro,noatime /dev/nvme0n1p2   /mnt/root ";
+} // namespace
+
+static void SplitView_EagerPath(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        usize total = 0;
+        for (const auto& component : PATH.Split('/')) total += component.Size();
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetBytesProcessed(state.iterations() * PATH.Size());
+}
+BENCHMARK(SplitView_EagerPath);
+
+static void SplitView_LazyPath(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        usize total = 0;
+        for (StringView component :
+             Split(PATH, '/', SplitBehavior::eSkipEmpty))
+            total += component.Size();
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetBytesProcessed(state.iterations() * PATH.Size());
+}
+BENCHMARK(SplitView_LazyPath);
+
+static void SplitView_Tokenize(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        usize count = 0;
+        for (StringView argument : Tokenize(COMMAND_LINE))
+        {
+            benchmark::DoNotOptimize(argument.Raw());
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetBytesProcessed(state.iterations() * COMMAND_LINE.Size());
+}
+BENCHMARK(SplitView_Tokenize);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Common/AllocationCounter.hpp>
+
+#include <Prism/String/StringBuilder.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr StringView s_Fields[] = {
+        "Name", "Umask", "State", "Tgid", "Ngid", "Pid", "PPid", "TracerPid",
+    };
+}; // namespace
+
+// A procfs-style status dump: many short appends, one materialization
+static void StringBuilder_StatusReport(benchmark::State& state)
+{
+    const usize lines = state.range(0);
+
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        StringBuilder<char> builder;
+        for (usize i = 0; i < lines; ++i)
+        {
+            builder << s_Fields[i % 8] << ':';
+            builder.AppendFill('\t', 1);
+            builder << u64(i * 37) << '\n';
+        }
+
+        String report = Move(builder).ToString();
+        benchmark::DoNotOptimize(report.Raw());
+    }
+}
+BENCHMARK(StringBuilder_StatusReport)->Arg(16)->Arg(1024);
+
+static void StringBuilder_AppendFormatted(benchmark::State& state)
+{
+    const usize lines = state.range(0);
+
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        StringBuilder<char> builder;
+        for (usize i = 0; i < lines; ++i)
+            builder.AppendFormatted("{:<10} {:#010x}\n", s_Fields[i % 8], i);
+
+        String report = Move(builder).ToString();
+        benchmark::DoNotOptimize(report.Raw());
+    }
+}
+BENCHMARK(StringBuilder_AppendFormatted)->Arg(16)->Arg(1024);
+
+static void StringBuilder_Repeat(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        StringBuilder<char> builder;
+        builder.AppendRepeated("-=", 2048);
+
+        benchmark::DoNotOptimize(builder.View().Raw());
+    }
+}
+BENCHMARK(StringBuilder_Repeat);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,172 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Common/AllocationCounter.hpp>
+
+#include <Prism/String/StringUtils.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+using namespace Prism::Literals;
+
+namespace
+{
+    // The conversions StringUtils used before ToChars/FromChars, kept as
+    // the baseline: one division per digit followed by a reversal, and a
+    // multiply-add per parsed digit
+    namespace Legacy
+    {
+        template <Integral T>
+        StringView ToString(T value, char* dest, i32 base = 10)
+        {
+            const bool isNegative = value < 0 && base == 10;
+
+            char*      str        = dest;
+            T          i          = 0;
+            if (value == 0)
+            {
+                str[i++] = '0';
+                str[i]   = 0;
+                return str;
+            }
+
+            if (isNegative) value = -value;
+
+            while (value != '\0')
+            {
+                T rem    = value % base;
+                str[i++] = (rem > 9) ? static_cast<char>((rem - 10) + 'a')
+                                     : static_cast<char>(rem + '0');
+                value    = value / base;
+            }
+
+            if (isNegative) str[i++] = '-';
+            str[i]       = '\0';
+            usize length = i;
+
+            T     start  = 0;
+            T     end    = i - 1;
+            while (start < end)
+            {
+                Swap(*(str + start), *(str + end));
+                ++start;
+                --end;
+            }
+
+            return {str, length};
+        }
+        template <Integral T>
+        T ToNumber(StringView string, usize base = 10)
+        {
+            if (string.Empty()) return {};
+            bool isNegative = string[0] == '-';
+
+            T    number     = 0;
+            for (usize i = isNegative; i < string.Size(); ++i)
+            {
+                u8 c     = string[i];
+                T  digit = CodePoints::ToDigit<T>(c);
+
+                if (static_cast<usize>(digit) >= base) break;
+                number = number * base + digit;
+            }
+
+            return isNegative ? -number : number;
+        }
+    }; // namespace Legacy
+
+    // Mix of small counters and large identifiers/addresses, the shape of
+    // the numbers we log
+    Vector<u64> MakeValues()
+    {
+        Vector<u64> values;
+        u64         state = 0x9e3779b97f4a7c15ull;
+        for (usize i = 0; i < 1024; ++i)
+        {
+            state ^= state << 13, state ^= state >> 7, state ^= state << 17;
+            values.PushBack(state >> (state % 64));
+        }
+
+        return values;
+    }
+    Vector<String> MakeStrings()
+    {
+        Vector<String> strings;
+        for (u64 value : MakeValues())
+            strings.PushBack(StringUtils::ToString(value));
+
+        return strings;
+    }
+}; // namespace
+
+static void StringUtils_LegacyToString(benchmark::State& state)
+{
+    auto values = MakeValues();
+    char buffer[66];
+    for (auto _ : state)
+        for (u64 value : values)
+            benchmark::DoNotOptimize(Legacy::ToString(value, buffer).Size());
+
+    state.SetItemsProcessed(state.iterations() * values.Size());
+}
+BENCHMARK(StringUtils_LegacyToString);
+
+static void StringUtils_ToChars(benchmark::State& state)
+{
+    auto values = MakeValues();
+    char buffer[66];
+    for (auto _ : state)
+        for (u64 value : values)
+            benchmark::DoNotOptimize(
+                StringUtils::ToChars(buffer, buffer + sizeof(buffer), value)
+                    .End);
+
+    state.SetItemsProcessed(state.iterations() * values.Size());
+}
+BENCHMARK(StringUtils_ToChars);
+
+static void StringUtils_ToStringHeap(benchmark::State& state)
+{
+    auto                       values = MakeValues();
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+        for (u64 value : values)
+            benchmark::DoNotOptimize(StringUtils::ToString(value).Raw());
+
+    state.SetItemsProcessed(state.iterations() * values.Size());
+}
+BENCHMARK(StringUtils_ToStringHeap);
+
+static void StringUtils_LegacyToNumber(benchmark::State& state)
+{
+    auto strings = MakeStrings();
+    for (auto _ : state)
+        for (const auto& string : strings)
+            benchmark::DoNotOptimize(Legacy::ToNumber<u64>(string.View()));
+
+    state.SetItemsProcessed(state.iterations() * strings.Size());
+}
+BENCHMARK(StringUtils_LegacyToNumber);
+
+static void StringUtils_FromChars(benchmark::State& state)
+{
+    auto strings = MakeStrings();
+    for (auto _ : state)
+    {
+        for (const auto& string : strings)
+        {
+            u64 value = 0;
+            StringUtils::FromChars(string.View(), value);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * strings.Size());
+}
+BENCHMARK(StringUtils_FromChars);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/Utility/Checksum.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    Vector<u8> MakeInput(usize size)
+    {
+        Vector<u8> input;
+        input.Resize(size);
+        for (usize i = 0; i < size; ++i)
+            input[i] = static_cast<u8>(i * 131 + (i >> 5));
+
+        return input;
+    }
+    void InputSizes(benchmark::internal::Benchmark* bench)
+    {
+        for (i64 size : {64, 1024, 16384, 1 << 20}) bench->Arg(size);
+    }
+
+    // What CRC32::DoChecksum used to do: one table lookup per byte
+    u32 BytewiseCrc32(const u8* data, usize size)
+    {
+        constexpr auto& table = Detail::CRC_TABLES<CRC32::CRC32_POLY>.Entries;
+
+        u32             crc   = 0xffffffff;
+        for (usize i = 0; i < size; ++i)
+            crc = (crc >> 8) ^ table[0][(crc ^ data[i]) & 0xff];
+
+        return ~crc;
+    }
+    // What Adler32::DoChecksum used to do: two divisions per byte
+    u32 BytewiseAdler32(const u8* data, usize size)
+    {
+        u32 a = 1, b = 0;
+        for (usize i = 0; i < size; ++i)
+        {
+            a = (a + data[i]) % Adler32::MOD_ADLER;
+            b = (b + a) % Adler32::MOD_ADLER;
+        }
+
+        return (b << 16) | a;
+    }
+
+    template <u32 (*Checksum)(const u8*, usize)>
+    void Run(benchmark::State& state)
+    {
+        auto input = MakeInput(state.range(0));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(input.Raw());
+            benchmark::DoNotOptimize(Checksum(input.Raw(), input.Size()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * input.Size());
+    }
+} // namespace
+
+static void Checksum_CRC32_Bytewise(benchmark::State& state)
+{
+    Run<BytewiseCrc32>(state);
+}
+BENCHMARK(Checksum_CRC32_Bytewise)->Apply(InputSizes);
+
+static void Checksum_CRC32(benchmark::State& state)
+{
+    Run<CRC32::DoChecksum>(state);
+}
+BENCHMARK(Checksum_CRC32)->Apply(InputSizes);
+
+static void Checksum_CRC32C(benchmark::State& state)
+{
+    Run<CRC32C::DoChecksum>(state);
+}
+BENCHMARK(Checksum_CRC32C)->Apply(InputSizes);
+
+static void Checksum_Adler32_Bytewise(benchmark::State& state)
+{
+    Run<BytewiseAdler32>(state);
+}
+BENCHMARK(Checksum_Adler32_Bytewise)->Apply(InputSizes);
+
+static void Checksum_Adler32(benchmark::State& state)
+{
+    Run<Adler32::DoChecksum>(state);
+}
+BENCHMARK(Checksum_Adler32)->Apply(InputSizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,138 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Common/AllocationCounter.hpp>
+
+#include <Prism/Utility/Path.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr PathView PATHS[] = {
+        "/usr/lib/x86_64-linux-gnu/libc.so.6",
+        "/usr/local/./share//fonts/../icons/hicolor/index.theme",
+        "/home/user/projects/../.config/cryptix/../../.local/bin/",
+        "/dev/disk/by-uuid/2f1c4e8a-71b3-4c1f-9a55-0d5c2e0e6b8f",
+        "/proc/self/fd/3",
+        "/boot//efi/EFI/./BOOT/BOOTX64.EFI",
+    };
+
+    // How paths were canonicalized before Normalize(): split into heap
+    // allocated components, resolve "." and ".." on a vector and join the
+    // survivors back together
+    Path LegacyNormalize(PathView path)
+    {
+        Vector<String> components;
+        for (auto& component : path.Split('/'))
+        {
+            if (component == "."_sv) continue;
+            if (component == ".."_sv)
+            {
+                if (!components.Empty()) components.PopBack();
+                continue;
+            }
+            components.PushBack(component);
+        }
+
+        Path result = path.Absolute() ? "/" : "";
+        for (const auto& component : components) result /= component.View();
+
+        return result;
+    }
+} // namespace
+
+static void Path_LegacyNormalize(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+        for (PathView path : PATHS)
+            benchmark::DoNotOptimize(LegacyNormalize(path).Raw());
+
+    state.SetItemsProcessed(state.iterations() * std::size(PATHS));
+}
+BENCHMARK(Path_LegacyNormalize);
+
+static void Path_Normalize(benchmark::State& state)
+{
+    // Reusing one path keeps the loop allocation-free, as a resolver that
+    // owns its scratch path would be
+    Path                       scratch = Path::Join(PATHS[1], PATHS[2]);
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        for (PathView path : PATHS)
+        {
+            scratch = path.StrView();
+            benchmark::DoNotOptimize(scratch.Normalize().Raw());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(PATHS));
+}
+BENCHMARK(Path_Normalize);
+
+static void Path_LegacyComponents(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        usize total = 0;
+        for (PathView path : PATHS)
+            for (const auto& component : path.Split())
+                total += component.Size();
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(PATHS));
+}
+BENCHMARK(Path_LegacyComponents);
+
+static void Path_Components(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        usize total = 0;
+        for (PathView path : PATHS)
+            for (StringView component : path.Components())
+                total += component.Size();
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(PATHS));
+}
+BENCHMARK(Path_Components);
+
+static void Path_LegacyJoin(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        Path path = "/usr";
+        path /= "local";
+        path /= "share/icons";
+        path /= "hicolor/scalable/apps/terminal.svg";
+        benchmark::DoNotOptimize(path.Raw());
+    }
+}
+BENCHMARK(Path_LegacyJoin);
+
+static void Path_Join(benchmark::State& state)
+{
+    Benchmark::AllocationScope allocations(state);
+    for (auto _ : state)
+    {
+        Path path = Path::Join("/usr", "local", "share/icons",
+                               "hicolor/scalable/apps/terminal.svg");
+        benchmark::DoNotOptimize(path.Raw());
+    }
+}
+BENCHMARK(Path_Join);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,60 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Core/Concepts.hpp>
+#include <Prism/Core/Types.hpp>
+
+namespace Prism
+{
+    /**
+     * @brief Something that runs a batch of independent tasks, possibly on
+     * several CPUs at once, for the parallel algorithms.
+     *
+     * Run(count, task) calls task(i) once for every i in [0, count), in any
+     * order and on any thread, and returns only after all of them finished.
+     * It has to accept any callable taking a usize; a thread pool on hosted
+     * builds and the kernel's per-CPU workers both fit behind it.
+     * Concurrency() is how many tasks can usefully run at the same time;
+     * the algorithms size their work split by it.
+     */
+    namespace Detail
+    {
+        /// Stands in for the capturing lambdas the algorithms pass to Run()
+        struct ExecutorTask
+        {
+            void* State;
+
+            void  operator()(usize) const;
+        };
+    }; // namespace Detail
+
+    template <typename E>
+    concept Executor = requires(E& executor, usize count) {
+        { executor.Concurrency() } -> ConvertibleTo<usize>;
+        { executor.Run(count, Detail::ExecutorTask{}) } -> SameAs<void>;
+    };
+
+    /// Runs every task on the calling thread, in order
+    class SequentialExecutor
+    {
+      public:
+        constexpr usize Concurrency() const { return 1; }
+
+        template <typename Task>
+        constexpr void Run(usize count, Task&& task)
+        {
+            for (usize i = 0; i < count; ++i) task(i);
+        }
+    };
+    static_assert(Executor<SequentialExecutor>);
+}; // namespace Prism
+
+#if PRISM_USE_NAMESPACE != 0
+using Prism::Executor;
+using Prism::SequentialExecutor;
+#endif
@@ -6,11 +6,191 @@
  */
 #pragma once
 
+#include <Prism/Core/Bits.hpp>
 #include <Prism/Core/Concepts.hpp>
+#include <Prism/Core/Platform.hpp>
 #include <Prism/Core/Ranges.hpp>
+#include <Prism/Utility/Compare.hpp>
+
+#if PRISM_TARGET_CRYPTIX == 0                                                  \
+    && (PRISM_SIMD_SSE2_PRESENT || PRISM_SIMD_NEON_PRESENT)
+    #include <Prism/Utility/SimdIntrinsics.hpp>
+    #define PRISM_FIND_SIMD 1
+#else
+    #define PRISM_FIND_SIMD 0
+#endif
 
 namespace Prism
 {
+    namespace Detail
+    {
+        /**
+         * @brief Whether searching [Iterator, Iterator) for a T can compare
+         * the raw bits of whole vectors of elements: the range is an array
+         * of integers or pointers.
+         */
+        template <typename Iterator, typename T>
+        constexpr bool IsSimdSearchable()
+        {
+            if constexpr (!IsPointerV<Iterator>) return false;
+            else
+            {
+                using E = RemoveCvType<RemovePointerType<Iterator>>;
+                if constexpr (IsPointerV<E>)
+                    return IsConvertibleV<const T&, E>;
+                else
+                    return IsIntegralV<E> && !IsSameV<E, bool>
+                        && IsIntegralV<T> && !IsSameV<T, bool>;
+            }
+        }
+        template <typename Iterator, typename T>
+        constexpr bool IS_SIMD_SEARCHABLE = IsSimdSearchable<Iterator, T>();
+
+        template <typename Comparator, typename E>
+        constexpr bool IS_EQUAL_TO
+            = IsSameV<RemoveCvRefType<Comparator>, EqualTo<>>
+           || IsSameV<RemoveCvRefType<Comparator>, EqualTo<E>>;
+        template <typename Comparator, typename E>
+        constexpr bool IS_NOT_EQUAL_TO
+            = IsSameV<RemoveCvRefType<Comparator>, NotEqualTo<>>
+           || IsSameV<RemoveCvRefType<Comparator>, NotEqualTo<E>>;
+
+#if PRISM_FIND_SIMD
+        /**
+         * @brief Index of the first of @p size lanes at @p data that equals
+         * (or, if not @p Equal, differs from) @p value, or @p size.
+         *
+         * Two vectors, 32 bytes, are compared per step and their lane masks
+         * packed into one bitmask, so the loop has a single, well predicted
+         * exit branch; the position of the match is the mask's lowest set
+         * bit.
+         */
+        template <bool Equal, typename U>
+        usize FindLanes(const U* data, usize size, U value)
+        {
+            using V                = VectorOfType<U, 16 / sizeof(U)>;
+            constexpr usize LANES  = 16 / sizeof(U);
+            const V         needle = V{} + value;
+
+            auto            mask   = [&needle](const U* at)
+            {
+                auto lanes = LoadVector<V>(at) == needle;
+                if constexpr (!Equal) lanes = ~lanes;
+                return MoveMask(BitCast<i8x16>(lanes));
+            };
+
+            usize i = 0;
+            for (; i + 2 * LANES <= size; i += 2 * LANES)
+            {
+                u32 matches = mask(data + i) | (mask(data + i + LANES) << 16);
+                if (matches) return i + CountRightZero(matches) / sizeof(U);
+            }
+            if (i + LANES <= size)
+            {
+                u32 matches = mask(data + i);
+                if (matches) return i + CountRightZero(matches) / sizeof(U);
+                i += LANES;
+            }
+
+            for (; i < size; ++i)
+                if ((data[i] == value) == Equal) return i;
+            return size;
+        }
+        /// Number of the @p size lanes at @p data equal to @p value
+        template <typename U>
+        usize CountLanes(const U* data, usize size, U value)
+        {
+            using V               = VectorOfType<U, 16 / sizeof(U)>;
+            constexpr usize LANES = 16 / sizeof(U);
+            // Steps after which a lane counter could wrap
+            constexpr usize FLUSH
+                = sizeof(U) == 1 ? 255 : (sizeof(U) == 2 ? 65535 : 1 << 24);
+            const V needle = V{} + value;
+
+            usize   count  = 0;
+            usize   i      = 0;
+            while (i + LANES <= size)
+            {
+                usize steps  = Min(FLUSH, (size - i) / LANES);
+
+                // Matching lanes compare as all ones, i.e. -1
+                V     counts = V{};
+                for (usize step = 0; step < steps; ++step, i += LANES)
+                    counts -= BitCast<V>(LoadVector<V>(data + i) == needle);
+
+                for (usize lane = 0; lane < LANES; ++lane)
+                    count += counts[lane];
+            }
+
+            for (; i < size; ++i) count += data[i] == value;
+            return count;
+        }
+
+        template <typename E>
+        struct Lane
+        {
+            using Type = typename MakeUnsigned<E>::Type;
+        };
+        template <typename E>
+        struct Lane<E*>
+        {
+            using Type = upointer;
+        };
+        template <typename E>
+        using LaneType = typename Lane<E>::Type;
+
+        /**
+         * @brief The lane @p value is searched as, if it can equal any
+         * element of type @p E at all.
+         *
+         * Comparing an element with @p value converts both to their common
+         * type, which is never narrower than @p E; so an element matches
+         * exactly when it equals value converted to @p E, and none does
+         * unless that conversion is lossless.
+         */
+        template <typename E, typename T>
+        bool ToLane(const T& value, LaneType<E>& lane)
+        {
+            if constexpr (IsPointerV<E>)
+            {
+                lane = reinterpret_cast<upointer>(static_cast<E>(value));
+                return true;
+            }
+            else
+            {
+                E converted = static_cast<E>(value);
+                // The type both sides of == convert to
+                using C     = decltype(converted + value);
+                lane        = static_cast<LaneType<E>>(converted);
+
+                return static_cast<C>(converted) == static_cast<C>(value);
+            }
+        }
+
+        /// FindLanes over an array of integers or pointers
+        template <bool Equal, typename E, typename T>
+        usize FindSimd(const E* data, usize size, const T& value)
+        {
+            using U = LaneType<E>;
+            U lane;
+            if (!ToLane<E>(value, lane)) return Equal ? size : 0;
+
+            return FindLanes<Equal>(reinterpret_cast<const U*>(data), size,
+                                    lane);
+        }
+        /// CountLanes over an array of integers or pointers
+        template <typename E, typename T>
+        usize CountSimd(const E* data, usize size, const T& value)
+        {
+            using U = LaneType<E>;
+            U lane;
+            if (!ToLane<E>(value, lane)) return 0;
+
+            return CountLanes(reinterpret_cast<const U*>(data), size, lane);
+        }
+#endif
+    }; // namespace Detail
+
     /**
      * @brief Finds the first element equal to the given value.
      * @tparam Iterator Type of the iterator.
@@ -24,6 +204,12 @@ namespace Prism
     PM_NODISCARD constexpr Iterator Find(Iterator first, Iterator last,
                                          const T& value)
     {
+#if PRISM_FIND_SIMD
+        if constexpr (Detail::IS_SIMD_SEARCHABLE<Iterator, T>)
+            if (!IsConstantEvaluated())
+                return first
+                     + Detail::FindSimd<true>(first, last - first, value);
+#endif
         for (; first != last; ++first)
             if (*first == value) return first;
         return last;
@@ -196,6 +382,19 @@ namespace Prism
     constexpr bool AnyOf(Iterator first, Iterator last, Comparator&& comp,
                          const T& value)
     {
+#if PRISM_FIND_SIMD
+        if constexpr (Detail::IS_SIMD_SEARCHABLE<Iterator, T>)
+        {
+            using E    = RemoveCvType<RemovePointerType<Iterator>>;
+            usize size = last - first;
+            if constexpr (Detail::IS_EQUAL_TO<Comparator, E>)
+                if (!IsConstantEvaluated())
+                    return Detail::FindSimd<true>(first, size, value) != size;
+            if constexpr (Detail::IS_NOT_EQUAL_TO<Comparator, E>)
+                if (!IsConstantEvaluated())
+                    return Detail::FindSimd<false>(first, size, value) != size;
+        }
+#endif
         for (; first != last; ++first)
             if (comp(*first, value)) return true;
         return false;
@@ -228,6 +427,19 @@ namespace Prism
     constexpr bool AllOf(Iterator first, Iterator last, Comparator&& comp,
                          const T& value)
     {
+#if PRISM_FIND_SIMD
+        if constexpr (Detail::IS_SIMD_SEARCHABLE<Iterator, T>)
+        {
+            using E    = RemoveCvType<RemovePointerType<Iterator>>;
+            usize size = last - first;
+            if constexpr (Detail::IS_EQUAL_TO<Comparator, E>)
+                if (!IsConstantEvaluated())
+                    return Detail::FindSimd<false>(first, size, value) == size;
+            if constexpr (Detail::IS_NOT_EQUAL_TO<Comparator, E>)
+                if (!IsConstantEvaluated())
+                    return Detail::FindSimd<true>(first, size, value) == size;
+        }
+#endif
         for (; first != last; ++first)
             if (!comp(*first, value)) return false;
         return true;
@@ -260,9 +472,7 @@ namespace Prism
     constexpr bool NoneOf(Iterator first, Iterator last, Comparator&& comp,
                           const T& value)
     {
-        for (; first != last; ++first)
-            if (comp(*first, value)) return false;
-        return true;
+        return !AnyOf(first, last, Forward<Comparator>(comp), value);
     }
     /**
      * @brief Iterator-aware version of NoneOf.
@@ -283,6 +493,11 @@ namespace Prism
     template <typename Iterator, typename T>
     constexpr usize Count(Iterator first, Iterator last, const T& value)
     {
+#if PRISM_FIND_SIMD
+        if constexpr (Detail::IS_SIMD_SEARCHABLE<Iterator, T>)
+            if (!IsConstantEvaluated())
+                return Detail::CountSimd(first, last - first, value);
+#endif
         usize cnt = 0;
         for (; first != last; ++first)
             if (*first == value) ++cnt;
@@ -307,6 +522,19 @@ namespace Prism
     constexpr usize CountIf(Iterator first, Iterator last, Comparator&& comp,
                             const T& value)
     {
+#if PRISM_FIND_SIMD
+        if constexpr (Detail::IS_SIMD_SEARCHABLE<Iterator, T>)
+        {
+            using E    = RemoveCvType<RemovePointerType<Iterator>>;
+            usize size = last - first;
+            if constexpr (Detail::IS_EQUAL_TO<Comparator, E>)
+                if (!IsConstantEvaluated())
+                    return Detail::CountSimd(first, size, value);
+            if constexpr (Detail::IS_NOT_EQUAL_TO<Comparator, E>)
+                if (!IsConstantEvaluated())
+                    return size - Detail::CountSimd(first, size, value);
+        }
+#endif
         usize cnt = 0;
         for (; first != last; ++first)
             if (comp(*first, value)) ++cnt;
@@ -511,19 +739,77 @@ namespace Prism
         return Find(Begin(c), End(c), value) != End(c);
     }
 
+    namespace Detail
+    {
+        /**
+         * @brief Halves [first, first + length) down to one element, keeping
+         * the first position at which @p goRight turns false inside it.
+         *
+         * Each step only picks the base of the next half, which compiles to
+         * a conditional move instead of a branch the predictor cannot guess.
+         * Both candidate midpoints of the following step are prefetched, so
+         * the load on the critical path is already underway on large
+         * contiguous ranges.
+         */
+        template <typename It, typename Predicate>
+        constexpr It BranchlessPartitionPoint(It first, usize length,
+                                              Predicate goRight)
+        {
+            if (length == 0) return first;
+            while (length > 1)
+            {
+                usize half = length / 2;
+                if constexpr (IsPointerV<It>)
+                {
+                    if (!IsConstantEvaluated())
+                    {
+                        PmPrefetch(first + half / 2);
+                        PmPrefetch(first + half + half / 2);
+                    }
+                }
+
+                first = goRight(first[half]) ? first + half : first;
+                length -= half;
+            }
+
+            return first + goRight(*first);
+        }
+    }; // namespace Detail
+
+    /**
+     * @brief The first element of the sorted [first, last) not ordered
+     * before @p value, or @p last.
+     */
+    template <typename It, typename T, typename Compare = Less<>>
+    constexpr It LowerBound(It first, It last, const T& value,
+                            Compare comp = Compare{})
+    {
+        return Detail::BranchlessPartitionPoint(
+            first, static_cast<usize>(last - first),
+            [&](const auto& element) { return comp(element, value); });
+    }
+    /**
+     * @brief The first element of the sorted [first, last) ordered after
+     * @p value, or @p last.
+     */
+    template <typename It, typename T, typename Compare = Less<>>
+    constexpr It UpperBound(It first, It last, const T& value,
+                            Compare comp = Compare{})
+    {
+        return Detail::BranchlessPartitionPoint(
+            first, static_cast<usize>(last - first),
+            [&](const auto& element) { return !comp(value, element); });
+    }
+    /**
+     * @brief An element of the sorted [first, last) equivalent to @p value,
+     * or @p last.
+     */
     template <typename It, typename T, typename Compare = Less<>>
     constexpr It BinarySearch(It first, It last, const T& value,
                               Compare comp = Compare{})
     {
-        It originalLast = last;
-        while (first < last)
-        {
-            It mid = first + (last - first) / 2;
-            if (!comp(*mid, value) && !comp(value, *mid)) return mid;
-            else if (comp(*mid, value)) first = mid + 1;
-            else last = mid;
-        }
-        return originalLast;
+        It it = LowerBound(first, last, value, comp);
+        return it != last && !comp(value, *it) ? it : last;
     }
 }; // namespace Prism
 
@@ -548,9 +834,11 @@ using Prism::FindIteratorIter;
 using Prism::FindLastIf;
 using Prism::FindValueIter;
 using Prism::IteratorPredicateAdapter;
+using Prism::LowerBound;
 using Prism::MatchIn;
 using Prism::NoneOf;
 using Prism::NoneOfIter;
 using Prism::RemoveIf;
 using Prism::RemoveIfIter;
+using Prism::UpperBound;
 #endif
@@ -9,58 +9,121 @@
 
 namespace Prism::Murmur
 {
-    usize Hash2(u8* input, usize length, const u64 seed)
-    {
-        return Hash2(Span<u8>(input, length), seed);
-    }
-    usize Hash2(Span<u8> input, const u64 seed)
+    namespace
     {
         // Marmur Hash constants
         constexpr u64 MULTIPLIER   = 0xc6a4'a793'5bd1'e995zu;
         constexpr i32 SHIFT_AMOUNT = 47;
 
-        u64       hash = seed ^ (static_cast<u64>(input.Size()) * MULTIPLIER);
-
-        const u64 chunkCount = input.Size() >> 3;
+        constexpr u64 C1           = 0x87c3'7b91'1142'53d5zu;
+        constexpr u64 C2           = 0x4cf5'ad43'2745'937fzu;
 
-        for (u64 i = 0; i < chunkCount; ++i)
+        PM_ALWAYS_INLINE u64 Mix2(u64 hash, u64 chunk)
         {
-            // NOTE(v1tr10l7): We use memcpy here to avoid unaligned accesses
-            u64 chunk = 0;
-            Memory::Copy(&chunk, input.Raw() + (i << 3), sizeof(u64));
-
             chunk *= MULTIPLIER;
             chunk ^= chunk >> SHIFT_AMOUNT;
             chunk *= MULTIPLIER;
 
             hash ^= chunk;
-            hash *= MULTIPLIER;
+            return hash * MULTIPLIER;
         }
+        PM_ALWAYS_INLINE void Mix3(u64& h1, u64& h2, const u8* block)
+        {
+            // NOTE(v1tr10l7): We use memcpy here to avoid unaligned accesses
+            u64 k1;
+            u64 k2;
+            Memory::Copy(&k1, block, sizeof(u64));
+            Memory::Copy(&k2, block + 8, sizeof(u64));
 
-        auto remaining = input.Raw() + (chunkCount << 3);
+            k1 *= C1;
+            k1 = RotateLeft(k1, 31);
+            k1 *= C2;
+            h1 ^= k1;
 
-        switch (input.Size() & 7)
+            h1 = RotateLeft(h1, 27);
+            h1 += h2;
+            h1 = h1 * 5 + 0x52dc'e729;
+
+            k2 *= C2;
+            k2 = RotateLeft(k2, 33);
+            k2 *= C1;
+            h2 ^= k2;
+
+            h2 = RotateLeft(h2, 31);
+            h2 += h1;
+            h2 = h2 * 5 + 0x3849'5ab5;
+        }
+
+        // Tops up a partial block from the front of @p bytes; true once the
+        // block is complete
+        template <usize BlockSize>
+        bool FillTail(u8 (&tail)[BlockSize], usize& tailSize,
+                      Span<const u8>& bytes)
         {
-            case 7:
-                hash ^= static_cast<u64>(remaining[6]) << 48;
-                [[fallthrough]];
-            case 6:
-                hash ^= static_cast<u64>(remaining[5]) << 40;
-                [[fallthrough]];
-            case 5:
-                hash ^= static_cast<u64>(remaining[4]) << 32;
-                [[fallthrough]];
-            case 4:
-                hash ^= static_cast<u64>(remaining[3]) << 24;
-                [[fallthrough]];
-            case 3:
-                hash ^= static_cast<u64>(remaining[2]) << 16;
-                [[fallthrough]];
-            case 2:
-                hash ^= static_cast<u64>(remaining[1]) << 8;
-                [[fallthrough]];
-            case 1: hash ^= static_cast<u64>(remaining[0]); hash *= MULTIPLIER;
-        };
+            usize count = Min(BlockSize - tailSize, bytes.Size());
+            if (count) Memory::Copy(tail + tailSize, bytes.Raw(), count);
+
+            tailSize += count;
+            bytes = Span<const u8>(bytes.Raw() + count, bytes.Size() - count);
+
+            return tailSize == BlockSize;
+        }
+    } // namespace
+
+    usize Hash2(u8* input, usize length, const u64 seed)
+    {
+        return Hash2(Span<u8>(input, length), seed);
+    }
+    usize Hash2(Span<u8> input, const u64 seed)
+    {
+        Hasher2 hasher(input.Size(), seed);
+        hasher.Update(input);
+
+        return hasher.Finalize();
+    }
+
+    Hasher2::Hasher2(usize length, u64 seed)
+        : m_Hash(seed ^ (static_cast<u64>(length) * MULTIPLIER))
+        , m_Length(length)
+    {
+    }
+    void Hasher2::Update(Span<const u8> bytes)
+    {
+        m_Consumed += bytes.Size();
+        if (m_TailSize)
+        {
+            if (!FillTail(m_Tail, m_TailSize, bytes)) return;
+
+            u64 chunk;
+            Memory::Copy(&chunk, m_Tail, sizeof(u64));
+            m_Hash     = Mix2(m_Hash, chunk);
+            m_TailSize = 0;
+        }
+
+        const u8* data  = bytes.Raw();
+        usize     count = bytes.Size() >> 3;
+        for (usize i = 0; i < count; ++i)
+        {
+            u64 chunk;
+            Memory::Copy(&chunk, data + (i << 3), sizeof(u64));
+
+            m_Hash = Mix2(m_Hash, chunk);
+        }
+
+        m_TailSize = bytes.Size() & 7;
+        if (m_TailSize) Memory::Copy(m_Tail, data + (count << 3), m_TailSize);
+    }
+    usize Hasher2::Finalize() const
+    {
+        assert(m_Consumed == m_Length);
+
+        u64 hash = m_Hash;
+        if (m_TailSize)
+        {
+            for (usize i = 0; i < m_TailSize; ++i)
+                hash ^= static_cast<u64>(m_Tail[i]) << (i * 8);
+            hash *= MULTIPLIER;
+        }
 
         hash ^= hash >> SHIFT_AMOUNT;
         hash *= MULTIPLIER;
@@ -79,50 +142,48 @@ namespace Prism::Murmur
 
         return k;
     }
-    // TODO(v1tr10l7): Endianness
     u128 Hash3(Span<u8> input, const u32 seed)
     {
-        const isize blockCount = input.Size() >> 4;
+        Hasher3 hasher(seed);
+        hasher.Update(input);
 
-        u64         h1         = seed;
-        u64         h2         = seed;
-
-        const u64   c1         = 0x87c3'7b91'1142'53d5zu;
-        const u64   c2         = 0x4cf5'ad43'2745'937fzu;
+        return hasher.Finalize();
+    }
 
-        for (isize i = 0; i < blockCount; i++)
+    Hasher3::Hasher3(u32 seed)
+        : m_H1(seed)
+        , m_H2(seed)
+    {
+    }
+    // TODO(v1tr10l7): Endianness
+    void Hasher3::Update(Span<const u8> bytes)
+    {
+        m_Length += bytes.Size();
+        if (m_TailSize)
         {
-            u64 k1;
-            u64 k2;
-            Memory::Copy(&k1, input.Raw() + (i << 4), sizeof(u64));
-            Memory::Copy(&k2, input.Raw() + (i << 4) + 8, sizeof(u64));
-
-            k1 *= c1;
-            k1 = RotateLeft(k1, 31);
-            k1 *= c2;
-            h1 ^= k1;
-
-            h1 = RotateLeft(h1, 27);
-            h1 += h2;
-            h1 = h1 * 5 + 0x52dc'e729;
-
-            k2 *= c2;
-            k2 = RotateLeft(k2, 33);
-            k2 *= c1;
-            h2 ^= k2;
+            if (!FillTail(m_Tail, m_TailSize, bytes)) return;
 
-            h2 = RotateLeft(h2, 31);
-            h2 += h1;
-            h2 = h2 * 5 + 0x3849'5ab5;
+            Mix3(m_H1, m_H2, m_Tail);
+            m_TailSize = 0;
         }
 
-        const u8* tail
-            = reinterpret_cast<const u8*>(input.Raw() + (blockCount << 4));
+        const u8* data  = bytes.Raw();
+        usize     count = bytes.Size() >> 4;
+        for (usize i = 0; i < count; ++i) Mix3(m_H1, m_H2, data + (i << 4));
+
+        m_TailSize = bytes.Size() & 15;
+        if (m_TailSize) Memory::Copy(m_Tail, data + (count << 4), m_TailSize);
+    }
+    u128 Hasher3::Finalize() const
+    {
+        u64       h1   = m_H1;
+        u64       h2   = m_H2;
+        const u8* tail = m_Tail;
 
-        u64 k1 = 0;
-        u64 k2 = 0;
+        u64       k1   = 0;
+        u64       k2   = 0;
 
-        switch (input.Size() & 15)
+        switch (m_TailSize)
         {
             case 15: k2 ^= ((u64)tail[14]) << 48; [[fallthrough]];
             case 14: k2 ^= ((u64)tail[13]) << 40; [[fallthrough]];
@@ -132,9 +193,9 @@ namespace Prism::Murmur
             case 10: k2 ^= ((u64)tail[9]) << 8; [[fallthrough]];
             case 9:
                 k2 ^= ((u64)tail[8]) << 0;
-                k2 *= c2;
+                k2 *= C2;
                 k2 = RotateLeft(k2, 33);
-                k2 *= c1;
+                k2 *= C1;
                 h2 ^= k2;
 
                 [[fallthrough]];
@@ -147,14 +208,14 @@ namespace Prism::Murmur
             case 2: k1 ^= ((u64)tail[1]) << 8; [[fallthrough]];
             case 1:
                 k1 ^= static_cast<u64>(tail[0]) << 0;
-                k1 *= c1;
+                k1 *= C1;
                 k1 = RotateLeft(k1, 31);
-                k1 *= c2;
+                k1 *= C2;
                 h1 ^= k1;
         };
 
-        h1 ^= input.Size();
-        h2 ^= input.Size();
+        h1 ^= m_Length;
+        h2 ^= m_Length;
 
         h1 += h2;
         h2 += h1;
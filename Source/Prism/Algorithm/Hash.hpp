@@ -7,6 +7,7 @@
 #pragma once
 
 #include <Prism/Algorithm/FNV1aHash.hpp>
+#include <Prism/Algorithm/Hasher.hpp>
 #include <Prism/Containers/Span.hpp>
 #include <Prism/Core/Integer128.hpp>
 #include <Prism/Core/Limits.hpp>
@@ -14,11 +15,86 @@
 
 namespace Prism
 {
+    namespace FNV1a
+    {
+        /// Streaming FNV1a; the state is the hash itself
+        class Hasher
+        {
+          public:
+            using ResultType = usize;
+
+            constexpr explicit Hasher(usize basis = OFFSET_BASIC)
+                : m_Hash(basis)
+            {
+            }
+
+            constexpr void Update(Span<const u8> bytes)
+            {
+                for (u8 byte : bytes)
+                {
+                    m_Hash ^= byte;
+                    m_Hash *= PRIME;
+                }
+            }
+            constexpr usize Finalize() const { return m_Hash; }
+
+          private:
+            usize m_Hash;
+        };
+        static_assert(StreamingHasher<Hasher>);
+    }; // namespace FNV1a
     namespace Murmur
     {
         usize Hash2(u8* input, usize length, const u64 seed);
         usize Hash2(Span<u8> input, const u64 seed);
         u128  Hash3(Span<u8> input, const u32 seed);
+
+        /**
+         * @brief Streaming Hash2.
+         *
+         * MurmurHash64A mixes the input length into its initial state, so
+         * the total length has to be known up front; Finalize() asserts
+         * that exactly that many bytes were fed.
+         */
+        class Hasher2
+        {
+          public:
+            using ResultType = usize;
+
+            Hasher2(usize length, u64 seed);
+
+            void  Update(Span<const u8> bytes);
+            usize Finalize() const;
+
+          private:
+            u64   m_Hash;
+            usize m_Length;
+            usize m_Consumed = 0;
+            // Bytes of an incomplete 8-byte chunk
+            u8    m_Tail[8];
+            usize m_TailSize = 0;
+        };
+        /// Streaming Hash3
+        class Hasher3
+        {
+          public:
+            using ResultType = u128;
+
+            explicit Hasher3(u32 seed);
+
+            void Update(Span<const u8> bytes);
+            u128 Finalize() const;
+
+          private:
+            u64   m_H1;
+            u64   m_H2;
+            usize m_Length = 0;
+            // Bytes of an incomplete 16-byte block
+            u8    m_Tail[16];
+            usize m_TailSize = 0;
+        };
+        static_assert(StreamingHasher<Hasher2>);
+        static_assert(StreamingHasher<Hasher3>);
     }; // namespace Murmur
 }; // namespace Prism
 
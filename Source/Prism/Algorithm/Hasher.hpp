@@ -0,0 +1,36 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Containers/Span.hpp>
+#include <Prism/Core/Concepts.hpp>
+
+namespace Prism
+{
+    /**
+     * @brief A hash or checksum computed over data that arrives in pieces.
+     *
+     * Update() can be called any number of times with any split of the
+     * input, and Finalize() returns what the matching one-shot function
+     * returns for all of the bytes at once, so scattered data never has to
+     * be copied into one buffer first. Finalize() leaves the state alone: a
+     * hasher can report the hash of what it has seen so far and go on.
+     */
+    template <typename H>
+    concept StreamingHasher
+        = requires(H& hasher, const H& finished, Span<const u8> bytes) {
+              typename H::ResultType;
+              { hasher.Update(bytes) } -> SameAs<void>;
+              {
+                  finished.Finalize()
+              } -> SameAs<typename H::ResultType>;
+          };
+}; // namespace Prism
+
+#if PRISM_USE_NAMESPACE != 0
+using Prism::StreamingHasher;
+#endif
@@ -0,0 +1,504 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Algorithm/Executor.hpp>
+#include <Prism/Algorithm/Find.hpp>
+#include <Prism/Algorithm/Sort.hpp>
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/Utility/Atomic.hpp>
+
+/*
+ * Executor overloads of the algorithms in Find.hpp and Sort.hpp. The range
+ * is cut into one contiguous chunk per task, so iterators have to be random
+ * access, and the callables are invoked concurrently, so they must not
+ * share unsynchronized state. Ranges too small to be worth the hand-off
+ * run on the calling thread.
+ */
+namespace Prism
+{
+    namespace Detail
+    {
+        /// Fewest elements handed to a task of the parallel algorithms
+        constexpr isize PARALLEL_GRAIN_SIZE      = 4096;
+        /// Fewest elements the parallel sorts split up at all
+        constexpr isize PARALLEL_SORT_THRESHOLD  = 1 << 14;
+        /// Samples taken per bucket to pick the sample sort's splitters
+        constexpr isize SAMPLE_SORT_OVERSAMPLING = 32;
+        /// The sample sort classifies into at most this many buckets
+        constexpr isize SAMPLE_SORT_MAX_BUCKETS  = 256;
+
+        /// Elements found by FindIf tasks before they look for an earlier hit
+        constexpr isize PARALLEL_FIND_STRIDE     = 1024;
+
+        template <typename E>
+        isize TaskCount(E& executor, isize size, isize grain)
+        {
+            isize tasks = static_cast<isize>(executor.Concurrency());
+            if (tasks < 1) tasks = 1;
+
+            return Max(isize(1), Min(tasks, size / grain));
+        }
+        /// Start of chunk @p task when @p size elements go to @p tasks
+        PM_ALWAYS_INLINE isize ChunkBegin(isize size, isize tasks, isize task)
+        {
+            return static_cast<isize>(static_cast<u64>(size) * task / tasks);
+        }
+
+        /**
+         * @brief Number of elements of [left, left + leftSize) among the
+         * first @p diagonal of their stable merge with [right, right +
+         * rightSize), found by binary search along the merge path.
+         */
+        template <typename It, typename Compare>
+        isize MergeCoRank(It left, isize leftSize, It right, isize rightSize,
+                          isize diagonal, Compare& comp)
+        {
+            isize low  = Max(isize(0), diagonal - rightSize);
+            isize high = Min(diagonal, leftSize);
+            while (low < high)
+            {
+                isize i = low + (high - low) / 2;
+                isize j = diagonal - i;
+                // left[i] is no greater than right[j - 1], so it merges
+                // within the diagonal
+                if (j > 0 && !comp(right[j - 1], left[i])) low = i + 1;
+                else high = i;
+            }
+
+            return low;
+        }
+
+        /**
+         * @brief Stably merges [first, mid) and [mid, last) into the raw
+         * storage at @p buffer, each task producing one slice of the output,
+         * then moves the result back.
+         */
+        template <typename E, typename It, typename T, typename Compare>
+        void ParallelMerge(E& executor, It first, It mid, It last, T* buffer,
+                           Compare& comp)
+        {
+            isize leftSize  = mid - first;
+            isize rightSize = last - mid;
+            isize size      = leftSize + rightSize;
+            isize tasks     = TaskCount(executor, size, PARALLEL_GRAIN_SIZE);
+
+            executor.Run(
+                tasks,
+                [&](usize task)
+                {
+                    isize begin = ChunkBegin(size, tasks, task);
+                    isize end   = ChunkBegin(size, tasks, task + 1);
+                    isize i = MergeCoRank(first, leftSize, mid, rightSize,
+                                          begin, comp);
+                    isize iEnd = MergeCoRank(first, leftSize, mid, rightSize,
+                                             end, comp);
+                    isize j    = begin - i;
+                    isize jEnd = end - iEnd;
+
+                    T*    out  = buffer + begin;
+                    while (i < iEnd && j < jEnd)
+                    {
+                        if (comp(mid[j], first[i]))
+                            ConstructAt(out++, Move(mid[j++]));
+                        else ConstructAt(out++, Move(first[i++]));
+                    }
+                    while (i < iEnd) ConstructAt(out++, Move(first[i++]));
+                    while (j < jEnd) ConstructAt(out++, Move(mid[j++]));
+                });
+            executor.Run(tasks,
+                         [&](usize task)
+                         {
+                             isize begin = ChunkBegin(size, tasks, task);
+                             isize end   = ChunkBegin(size, tasks, task + 1);
+                             MoveForward(buffer + begin, buffer + end,
+                                         first + begin);
+                             DestroyBuffer(buffer + begin, buffer + end);
+                         });
+        }
+    }; // namespace Detail
+
+    /// Counts the elements of [first, last) for which @p pred holds
+    template <Executor E, typename It, typename UnaryPredicate>
+    usize CountIf(E& executor, It first, It last, UnaryPredicate pred)
+    {
+        isize size  = last - first;
+        isize tasks = Detail::TaskCount(executor, size,
+                                        Detail::PARALLEL_GRAIN_SIZE);
+        if (tasks == 1) return CountIf(first, last, pred);
+
+        // Each task writes its slot once, at the end
+        Vector<usize> counts(tasks);
+        executor.Run(tasks,
+                     [&](usize task)
+                     {
+                         It begin = first + Detail::ChunkBegin(size, tasks,
+                                                               task);
+                         It end   = first + Detail::ChunkBegin(size, tasks,
+                                                               task + 1);
+                         counts[task] = CountIf(begin, end, pred);
+                     });
+
+        usize count = 0;
+        for (usize partial : counts) count += partial;
+        return count;
+    }
+    /// Counts the elements of [first, last) equal to @p value
+    template <Executor E, typename It, typename T>
+    usize Count(E& executor, It first, It last, const T& value)
+    {
+        return CountIf(executor, first, last,
+                       [&value](const auto& element)
+                       { return element == value; });
+    }
+
+    /**
+     * @brief Finds the first element of [first, last) for which @p pred
+     * holds.
+     *
+     * Every task scans its own chunk; once one finds a match, tasks whose
+     * chunk starts after it stop at their next check.
+     */
+    template <Executor E, typename It, typename UnaryPredicate>
+    It FindIf(E& executor, It first, It last, UnaryPredicate pred)
+    {
+        isize size  = last - first;
+        isize tasks = Detail::TaskCount(executor, size,
+                                        Detail::PARALLEL_GRAIN_SIZE);
+        if (tasks == 1) return FindIf(first, last, pred);
+
+        Atomic<isize> found = size;
+        executor.Run(
+            tasks,
+            [&](usize task)
+            {
+                isize begin = Detail::ChunkBegin(size, tasks, task);
+                isize end   = Detail::ChunkBegin(size, tasks, task + 1);
+                for (isize i = begin; i < end;)
+                {
+                    if (found.Load(MemoryOrder::eRelaxed) < begin) return;
+
+                    isize stop = Min(end, i + Detail::PARALLEL_FIND_STRIDE);
+                    for (; i < stop; ++i)
+                    {
+                        if (!pred(first[i])) continue;
+
+                        isize current = found.Load(MemoryOrder::eRelaxed);
+                        while (i < current
+                               && !found.CompareExchange(
+                                   current, i, true, MemoryOrder::eRelaxed,
+                                   MemoryOrder::eRelaxed));
+                        return;
+                    }
+                }
+            });
+
+        return first + found.Load();
+    }
+    /// Finds the first element of [first, last) equal to @p value
+    template <Executor E, typename It, typename T>
+    It Find(E& executor, It first, It last, const T& value)
+    {
+        return FindIf(executor, first, last,
+                      [&value](const auto& element)
+                      { return element == value; });
+    }
+    template <Executor E, typename It, typename UnaryPredicate>
+    bool AnyOf(E& executor, It first, It last, UnaryPredicate pred)
+    {
+        return FindIf(executor, first, last, pred) != last;
+    }
+    template <Executor E, typename It, typename UnaryPredicate>
+    bool AllOf(E& executor, It first, It last, UnaryPredicate pred)
+    {
+        return FindIf(executor, first, last,
+                      [&pred](const auto& element) { return !pred(element); })
+            == last;
+    }
+    template <Executor E, typename It, typename UnaryPredicate>
+    bool NoneOf(E& executor, It first, It last, UnaryPredicate pred)
+    {
+        return !AnyOf(executor, first, last, pred);
+    }
+
+    /**
+     * @brief Writes op(*it) for every element of [first, last) to the range
+     * starting at @p out, which may be [first, last) itself.
+     *
+     * @return The end of the output range
+     */
+    template <Executor E, typename It, typename Out, typename UnaryOperation>
+    Out Transform(E& executor, It first, It last, Out out, UnaryOperation op)
+    {
+        isize size  = last - first;
+        isize tasks = Detail::TaskCount(executor, size,
+                                        Detail::PARALLEL_GRAIN_SIZE);
+        executor.Run(tasks,
+                     [&](usize task)
+                     {
+                         isize begin = Detail::ChunkBegin(size, tasks, task);
+                         isize end
+                             = Detail::ChunkBegin(size, tasks, task + 1);
+                         for (isize i = begin; i < end; ++i)
+                             out[i] = op(first[i]);
+                     });
+
+        return out + size;
+    }
+
+    /**
+     * @brief Folds [first, last) into @p init with @p op.
+     *
+     * Each task folds its chunk on its own and the partial results are
+     * combined in order, so @p op has to be associative; it need not be
+     * commutative.
+     */
+    template <Executor E, typename It, typename T, typename BinaryOperation>
+    T Reduce(E& executor, It first, It last, T init, BinaryOperation op)
+    {
+        isize size  = last - first;
+        isize tasks = Detail::TaskCount(executor, size,
+                                        Detail::PARALLEL_GRAIN_SIZE);
+        if (tasks == 1)
+        {
+            for (; first != last; ++first) init = op(Move(init), *first);
+            return init;
+        }
+
+        Detail::MergeBuffer<T> partials(tasks);
+        if (partials.Capacity() == 0)
+        {
+            for (; first != last; ++first) init = op(Move(init), *first);
+            return init;
+        }
+
+        executor.Run(tasks,
+                     [&](usize task)
+                     {
+                         isize begin = Detail::ChunkBegin(size, tasks, task);
+                         isize end
+                             = Detail::ChunkBegin(size, tasks, task + 1);
+
+                         T value = first[begin];
+                         for (isize i = begin + 1; i < end; ++i)
+                             value = op(Move(value), first[i]);
+                         ConstructAt(partials.Raw() + task, Move(value));
+                     });
+
+        for (isize task = 0; task < tasks; ++task)
+        {
+            T& partial = partials.Raw()[task];
+            init       = op(Move(init), Move(partial));
+            DestroyAt(&partial);
+        }
+
+        return init;
+    }
+
+    /**
+     * @brief Sorts [first, last) across the executor's tasks with sample
+     * sort.
+     *
+     * Splitters chosen from an evenly spread sample cut the keys into
+     * buckets of similar size. Each task first classifies its chunk, only
+     * reading, then moves its elements to their bucket's slice of a buffer
+     * at offsets known from everyone's counts, so no two tasks write the
+     * same place. The buckets then move back and are sorted independently.
+     * Not stable.
+     */
+    template <Executor E, typename It, typename Compare = Less<>>
+    void Sort(E& executor, It first, It last, Compare comp = Compare{})
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+
+        isize size      = last - first;
+        isize tasks
+            = Detail::TaskCount(executor, size, Detail::PARALLEL_GRAIN_SIZE);
+        if (size < Detail::PARALLEL_SORT_THRESHOLD || tasks == 1)
+            return Sort(first, last, comp);
+
+        // Without memory for the buckets, sort in place on this thread
+        Detail::MergeBuffer<ValueType> buffer(size);
+        if (buffer.Capacity() == 0) return Sort(first, last, comp);
+
+        isize buckets = Min(Detail::SAMPLE_SORT_MAX_BUCKETS, tasks * 4);
+
+        // Positions spread evenly, with a little jitter against periodic
+        // input; sorting the positions leaves the range untouched
+        isize      samples = buckets * Detail::SAMPLE_SORT_OVERSAMPLING;
+        isize      stride  = size / samples;
+        Vector<It> sample(samples);
+        u64        state = 0x9e37'79b9'7f4a'7c15ull;
+        for (isize i = 0; i < samples; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            sample[i]
+                = first + (i * stride + static_cast<isize>(state % stride));
+        }
+        Sort(sample.begin(), sample.end(),
+             [&comp](It lhs, It rhs) { return comp(*lhs, *rhs); });
+
+        Vector<It> splitters(buckets - 1);
+        for (isize i = 0; i + 1 < buckets; ++i)
+            splitters[i]
+                = sample[(i + 1) * Detail::SAMPLE_SORT_OVERSAMPLING - 1];
+
+        Vector<u8>    bucketOf(size);
+        Vector<isize> offsets(tasks * buckets);
+        executor.Run(
+            tasks,
+            [&](usize task)
+            {
+                isize counts[Detail::SAMPLE_SORT_MAX_BUCKETS] = {};
+                isize begin = Detail::ChunkBegin(size, tasks, task);
+                isize end   = Detail::ChunkBegin(size, tasks, task + 1);
+                for (isize i = begin; i < end; ++i)
+                {
+                    // First splitter greater than the element
+                    isize low = 0, high = buckets - 1;
+                    while (low < high)
+                    {
+                        isize mid = low + (high - low) / 2;
+                        if (comp(first[i], *splitters[mid])) high = mid;
+                        else low = mid + 1;
+                    }
+
+                    bucketOf[i] = static_cast<u8>(low);
+                    ++counts[low];
+                }
+
+                for (isize bucket = 0; bucket < buckets; ++bucket)
+                    offsets[task * buckets + bucket] = counts[bucket];
+            });
+
+        // Buckets in order, and within each bucket the tasks in order
+        Vector<isize> bucketBegin(buckets + 1);
+        isize         sum = 0;
+        for (isize bucket = 0; bucket < buckets; ++bucket)
+        {
+            bucketBegin[bucket] = sum;
+            for (isize task = 0; task < tasks; ++task)
+            {
+                isize count = offsets[task * buckets + bucket];
+                offsets[task * buckets + bucket] = sum;
+                sum += count;
+            }
+        }
+        bucketBegin[buckets] = sum;
+
+        ValueType* scratch = buffer.Raw();
+        executor.Run(
+            tasks,
+            [&](usize task)
+            {
+                isize* offset = &offsets[task * buckets];
+                isize  begin  = Detail::ChunkBegin(size, tasks, task);
+                isize  end    = Detail::ChunkBegin(size, tasks, task + 1);
+                for (isize i = begin; i < end; ++i)
+                    ConstructAt(scratch + offset[bucketOf[i]]++,
+                                Move(first[i]));
+            });
+        executor.Run(buckets,
+                     [&](usize bucket)
+                     {
+                         ValueType* begin = scratch + bucketBegin[bucket];
+                         ValueType* end   = scratch + bucketBegin[bucket + 1];
+                         It         out   = first + bucketBegin[bucket];
+
+                         Detail::MoveForward(begin, end, out);
+                         Detail::DestroyBuffer(begin, end);
+                         Sort(out, out + (end - begin), comp);
+                     });
+    }
+
+    /**
+     * @brief Stably merges the sorted [first, mid) and [mid, last) across
+     * the executor's tasks.
+     *
+     * The output is cut into equal slices; where each slice starts in the
+     * two inputs is found by binary search along the merge path, so every
+     * task merges the same number of elements independently.
+     */
+    template <Executor E, typename It, typename Compare = Less<>>
+    void Merge(E& executor, It first, It mid, It last,
+               Compare comp = Compare{})
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+        if (first == mid || mid == last) return;
+        if (last - first < Detail::PARALLEL_SORT_THRESHOLD)
+            return Merge(first, mid, last, comp);
+
+        Detail::MergeBuffer<ValueType> buffer(last - first);
+        if (buffer.Capacity() == 0) return Merge(first, mid, last, comp);
+
+        Detail::ParallelMerge(executor, first, mid, last, buffer.Raw(), comp);
+    }
+
+    /**
+     * @brief Sorts [first, last) stably across the executor's tasks.
+     *
+     * Every task stable sorts a chunk of its own, then neighbouring chunks
+     * are merged pairwise with the parallel merge until one is left, all
+     * through a single buffer.
+     */
+    template <Executor E, typename It, typename Compare = Less<>>
+    void StableSort(E& executor, It first, It last, Compare comp = Compare{})
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+
+        isize size      = last - first;
+        isize tasks
+            = Detail::TaskCount(executor, size, Detail::PARALLEL_GRAIN_SIZE);
+        if (size < Detail::PARALLEL_SORT_THRESHOLD || tasks == 1)
+            return StableSort(first, last, comp);
+
+        // Without memory to merge through, sort on this thread, which then
+        // merges in place
+        Detail::MergeBuffer<ValueType> buffer(size);
+        if (buffer.Capacity() == 0) return StableSort(first, last, comp);
+
+        executor.Run(tasks,
+                     [&](usize task)
+                     {
+                         StableSort(first + Detail::ChunkBegin(size, tasks,
+                                                               task),
+                                    first + Detail::ChunkBegin(size, tasks,
+                                                               task + 1),
+                                    comp);
+                     });
+
+        for (isize width = 1; width < tasks; width *= 2)
+            for (isize task = 0; task + width < tasks; task += 2 * width)
+            {
+                It begin = first + Detail::ChunkBegin(size, tasks, task);
+                It mid = first + Detail::ChunkBegin(size, tasks, task + width);
+                It end = first
+                       + Detail::ChunkBegin(size, tasks,
+                                            Min(tasks, task + 2 * width));
+                Detail::ParallelMerge(executor, begin, mid, end, buffer.Raw(),
+                                      comp);
+            }
+    }
+}; // namespace Prism
+
+#if PRISM_USE_NAMESPACE != 0
+using Prism::AllOf;
+using Prism::AnyOf;
+using Prism::Count;
+using Prism::CountIf;
+using Prism::Find;
+using Prism::FindIf;
+using Prism::Merge;
+using Prism::NoneOf;
+using Prism::Reduce;
+using Prism::Sort;
+using Prism::StableSort;
+using Prism::Transform;
+#endif
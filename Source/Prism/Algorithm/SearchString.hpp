@@ -7,9 +7,20 @@
 #pragma once
 
 #include <Prism/Containers/Vector.hpp>
+#include <Prism/Core/Bits.hpp>
+#include <Prism/Core/Platform.hpp>
 #include <Prism/Core/Types.hpp>
+#include <Prism/Memory/Memory.hpp>
 #include <Prism/String/CharTraits.hpp>
 
+#if PRISM_TARGET_CRYPTIX == 0                                                  \
+    && (PRISM_SIMD_SSE2_PRESENT || PRISM_SIMD_NEON_PRESENT)
+    #include <Prism/Utility/SimdIntrinsics.hpp>
+    #define PRISM_SEARCH_STRING_SIMD 1
+#else
+    #define PRISM_SEARCH_STRING_SIMD 0
+#endif
+
 namespace Prism
 {
     template <typename C, typename Traits>
@@ -55,5 +66,897 @@ namespace Prism
 
             return -1;
         }
+
+        namespace Detail
+        {
+            // Needles up to this length are found by filtering candidate
+            // positions on their first and last character, which is what the
+            // vector and SWAR paths accelerate; longer needles amortize the
+            // Horspool shift table instead
+            constexpr usize SHORT_NEEDLE_LIMIT = 32;
+            constexpr usize NOT_FOUND          = usize(-1);
+
+            template <typename C>
+            constexpr bool Equal(const C* lhs, const C* rhs, usize count)
+            {
+                for (usize i = 0; i < count; ++i)
+                    if (lhs[i] != rhs[i]) return false;
+                return true;
+            }
+            inline bool EqualBytes(const u8* lhs, const u8* rhs, usize count)
+            {
+                for (; count >= 8; lhs += 8, rhs += 8, count -= 8)
+                    if (Memory::LoadUnaligned<u64>(lhs)
+                        != Memory::LoadUnaligned<u64>(rhs))
+                        return false;
+
+                return Equal(lhs, rhs, count);
+            }
+
+            template <typename C>
+            constexpr usize FindCharacterScalar(const C* haystack, usize size,
+                                                C ch)
+            {
+                for (usize i = 0; i < size; ++i)
+                    if (haystack[i] == ch) return i;
+                return NOT_FOUND;
+            }
+            template <typename C>
+            constexpr usize FindLastCharacterScalar(const C* haystack,
+                                                    usize size, C ch)
+            {
+                while (size-- > 0)
+                    if (haystack[size] == ch) return size;
+                return NOT_FOUND;
+            }
+
+            template <typename C>
+            constexpr usize FindStringScalar(const C* haystack, usize size,
+                                             const C* needle, usize length)
+            {
+                const C first = needle[0];
+                const C last  = needle[length - 1];
+
+                for (usize i = 0; i + length <= size; ++i)
+                    if (haystack[i] == first && haystack[i + length - 1] == last
+                        && Equal(haystack + i + 1, needle + 1, length - 2))
+                        return i;
+                return NOT_FOUND;
+            }
+            template <typename C>
+            constexpr usize FindLastStringScalar(const C* haystack, usize size,
+                                                 const C* needle, usize length)
+            {
+                const C first = needle[0];
+                const C last  = needle[length - 1];
+
+                for (usize i = size - length + 1; i-- > 0;)
+                    if (haystack[i] == first && haystack[i + length - 1] == last
+                        && Equal(haystack + i + 1, needle + 1, length - 2))
+                        return i;
+                return NOT_FOUND;
+            }
+
+            // Index of the lowest/highest flagged byte of a SWAR mask in
+            // memory order
+            inline usize FirstByteIndex(u64 mask)
+            {
+                if constexpr (Endian::eNative == Endian::eLittle)
+                    return CountRightZero(mask) / 8;
+                else return CountLeftZero(mask) / 8;
+            }
+            inline usize LastByteIndex(u64 mask)
+            {
+                if constexpr (Endian::eNative == Endian::eLittle)
+                    return 7 - CountLeftZero(mask) / 8;
+                else return 7 - CountRightZero(mask) / 8;
+            }
+
+            constexpr u64 SWAR_ONES = 0x0101010101010101ull;
+            constexpr u64 SWAR_HIGH = 0x8080808080808080ull;
+
+            // Flags (top bit set) every zero byte of word. Bytes above a real
+            // zero may be flagged spuriously, but a zero byte is never missed,
+            // so callers verify each candidate
+            inline u64    SwarZeroBytes(u64 word)
+            {
+                return (word - SWAR_ONES) & ~word & SWAR_HIGH;
+            }
+
+            inline usize FindByteSwar(const u8* haystack, usize size, u8 byte)
+            {
+                const u64 pattern = SWAR_ONES * byte;
+
+                usize     i       = 0;
+                for (; i + 8 <= size; i += 8)
+                {
+                    u64 mask = SwarZeroBytes(
+                        Memory::LoadUnaligned<u64>(haystack + i) ^ pattern);
+
+                    for (; mask; mask &= mask - 1)
+                    {
+                        usize candidate = i + FirstByteIndex(mask);
+                        if (haystack[candidate] == byte) return candidate;
+                    }
+                }
+
+                usize tail = FindCharacterScalar(haystack + i, size - i, byte);
+                return tail == NOT_FOUND ? NOT_FOUND : i + tail;
+            }
+            inline usize FindStringSwar(const u8* haystack, usize size,
+                                        const u8* needle, usize length)
+            {
+                const u64 first = SWAR_ONES * needle[0];
+                const u64 last  = SWAR_ONES * needle[length - 1];
+
+                usize     i     = 0;
+                for (; i + length - 1 + 8 <= size; i += 8)
+                {
+                    u64 firstBytes
+                        = Memory::LoadUnaligned<u64>(haystack + i) ^ first;
+                    u64 lastBytes = Memory::LoadUnaligned<u64>(
+                                        haystack + i + length - 1)
+                                  ^ last;
+
+                    for (u64 mask = SwarZeroBytes(firstBytes | lastBytes); mask;
+                         mask &= mask - 1)
+                    {
+                        usize candidate = i + FirstByteIndex(mask);
+                        if (haystack[candidate] == needle[0]
+                            && haystack[candidate + length - 1]
+                                   == needle[length - 1]
+                            && EqualBytes(haystack + candidate + 1, needle + 1,
+                                          length - 2))
+                            return candidate;
+                    }
+                }
+
+                usize tail = FindStringScalar(haystack + i, size - i, needle,
+                                              length);
+                return tail == NOT_FOUND ? NOT_FOUND : i + tail;
+            }
+            inline usize FindLastStringSwar(const u8* haystack, usize size,
+                                            const u8* needle, usize length)
+            {
+                const u64 first = SWAR_ONES * needle[0];
+                const u64 last  = SWAR_ONES * needle[length - 1];
+
+                // Number of starting positions not yet examined, scanned
+                // from the back in blocks of eight
+                usize     count = size - length + 1;
+                for (; count >= 8; count -= 8)
+                {
+                    usize block = count - 8;
+                    u64   firstBytes
+                        = Memory::LoadUnaligned<u64>(haystack + block) ^ first;
+                    u64 lastBytes = Memory::LoadUnaligned<u64>(
+                                        haystack + block + length - 1)
+                                  ^ last;
+
+                    u64 mask      = SwarZeroBytes(firstBytes | lastBytes);
+                    while (mask)
+                    {
+                        usize index     = LastByteIndex(mask);
+                        usize candidate = block + index;
+                        if (haystack[candidate] == needle[0]
+                            && haystack[candidate + length - 1]
+                                   == needle[length - 1]
+                            && EqualBytes(haystack + candidate + 1, needle + 1,
+                                          length - 2))
+                            return candidate;
+
+                        if constexpr (Endian::eNative == Endian::eLittle)
+                            mask &= ~(u64(0xff) << (index * 8));
+                        else mask &= ~(u64(0xff) << ((7 - index) * 8));
+                    }
+                }
+
+                return FindLastStringScalar(haystack, count + length - 1,
+                                            needle, length);
+            }
+
+#if PRISM_SEARCH_STRING_SIMD
+            // The "generic SIMD" substring search: compare sixteen candidate
+            // positions at once against the needle's first and last byte and
+            // only verify the positions where both match
+            inline usize FindByteSimd(const u8* haystack, usize size, u8 byte)
+            {
+                const u8x16 pattern = u8x16{} + byte;
+
+                usize       i       = 0;
+                for (; i + 16 <= size; i += 16)
+                {
+                    u32 mask = MoveMask(LoadVector<u8x16>(haystack + i)
+                                        == pattern);
+                    if (mask) return i + CountRightZero(mask);
+                }
+
+                usize tail = FindCharacterScalar(haystack + i, size - i, byte);
+                return tail == NOT_FOUND ? NOT_FOUND : i + tail;
+            }
+            inline usize FindLastByteSimd(const u8* haystack, usize size,
+                                          u8 byte)
+            {
+                const u8x16 pattern = u8x16{} + byte;
+
+                for (; size >= 16; size -= 16)
+                {
+                    u32 mask = MoveMask(
+                        LoadVector<u8x16>(haystack + size - 16) == pattern);
+                    if (mask) return size - 16 + 31 - CountLeftZero(mask);
+                }
+
+                return FindLastCharacterScalar(haystack, size, byte);
+            }
+            inline usize FindStringSimd(const u8* haystack, usize size,
+                                        const u8* needle, usize length)
+            {
+                const u8x16 first = u8x16{} + needle[0];
+                const u8x16 last  = u8x16{} + needle[length - 1];
+
+                usize       i     = 0;
+                for (; i + length - 1 + 16 <= size; i += 16)
+                {
+                    i8x16 firstLanes
+                        = LoadVector<u8x16>(haystack + i) == first;
+                    i8x16 lastLanes
+                        = LoadVector<u8x16>(haystack + i + length - 1) == last;
+
+                    for (u32 mask = MoveMask(firstLanes & lastLanes); mask;
+                         mask &= mask - 1)
+                    {
+                        usize candidate = i + CountRightZero(mask);
+                        if (EqualBytes(haystack + candidate + 1, needle + 1,
+                                       length - 2))
+                            return candidate;
+                    }
+                }
+
+                usize tail = FindStringScalar(haystack + i, size - i, needle,
+                                              length);
+                return tail == NOT_FOUND ? NOT_FOUND : i + tail;
+            }
+            inline usize FindLastStringSimd(const u8* haystack, usize size,
+                                            const u8* needle, usize length)
+            {
+                const u8x16 first = u8x16{} + needle[0];
+                const u8x16 last  = u8x16{} + needle[length - 1];
+
+                usize       count = size - length + 1;
+                for (; count >= 16; count -= 16)
+                {
+                    usize block = count - 16;
+                    i8x16 firstLanes
+                        = LoadVector<u8x16>(haystack + block) == first;
+                    i8x16 lastLanes
+                        = LoadVector<u8x16>(haystack + block + length - 1)
+                       == last;
+
+                    u32 mask = MoveMask(firstLanes & lastLanes);
+                    while (mask)
+                    {
+                        u32   index     = 31 - CountLeftZero(mask);
+                        usize candidate = block + index;
+                        if (EqualBytes(haystack + candidate + 1, needle + 1,
+                                       length - 2))
+                            return candidate;
+
+                        mask &= ~(1u << index);
+                    }
+                }
+
+                return FindLastStringScalar(haystack, count + length - 1,
+                                            needle, length);
+            }
+#endif
+
+            // Boyer-Moore-Horspool. Characters wider than a byte share a
+            // bucket per low byte; each bucket keeps the smallest shift of
+            // its members, which keeps the skips safe. The table lives on the
+            // stack, so searching never allocates
+            template <typename C>
+            constexpr usize FindStringHorspool(const C* haystack, usize size,
+                                               const C* needle, usize length)
+            {
+                constexpr usize MAX_SHIFT = u16(-1);
+                u16             shifts[256];
+
+                const u16       skip = static_cast<u16>(Min(length, MAX_SHIFT));
+                for (auto& shift : shifts) shift = skip;
+                for (usize i = 0; i + 1 < length; ++i)
+                    shifts[static_cast<u8>(needle[i])]
+                        = static_cast<u16>(Min(length - 1 - i, MAX_SHIFT));
+
+                const C last = needle[length - 1];
+                for (usize i = 0; i + length <= size;)
+                {
+                    const C ch = haystack[i + length - 1];
+                    if (ch == last && Equal(haystack + i, needle, length - 1))
+                        return i;
+
+                    i += shifts[static_cast<u8>(ch)];
+                }
+
+                return NOT_FOUND;
+            }
+            // Horspool mirrored: the window slides towards the front and is
+            // keyed on the character under the needle's first position
+            template <typename C>
+            constexpr usize FindLastStringHorspool(const C* haystack,
+                                                   usize size, const C* needle,
+                                                   usize length)
+            {
+                constexpr usize MAX_SHIFT = u16(-1);
+                u16             shifts[256];
+
+                const u16       skip = static_cast<u16>(Min(length, MAX_SHIFT));
+                for (auto& shift : shifts) shift = skip;
+                for (usize i = length; i-- > 1;)
+                    shifts[static_cast<u8>(needle[i])]
+                        = static_cast<u16>(Min(i, MAX_SHIFT));
+
+                const C first = needle[0];
+                for (usize i = size - length;;)
+                {
+                    const C ch = haystack[i];
+                    if (ch == first
+                        && Equal(haystack + i + 1, needle + 1, length - 1))
+                        return i;
+
+                    usize shift = shifts[static_cast<u8>(ch)];
+                    if (i < shift) break;
+                    i -= shift;
+                }
+
+                return NOT_FOUND;
+            }
+        }; // namespace Detail
+
+        /**
+         * @brief Finds the first occurrence of a character without
+         * allocating; bytes are scanned a vector or a word at a time.
+         * @return Index of the match, or usize(-1).
+         */
+        template <typename C>
+        constexpr usize FindCharacter(const C* haystack, usize size, C ch)
+        {
+            if constexpr (sizeof(C) == 1)
+            {
+                if (!IsConstantEvaluated())
+                {
+                    auto bytes = reinterpret_cast<const u8*>(haystack);
+#if PRISM_SEARCH_STRING_SIMD
+                    return Detail::FindByteSimd(bytes, size,
+                                                static_cast<u8>(ch));
+#else
+                    return Detail::FindByteSwar(bytes, size,
+                                                static_cast<u8>(ch));
+#endif
+                }
+            }
+
+            return Detail::FindCharacterScalar(haystack, size, ch);
+        }
+        /**
+         * @brief Finds the last occurrence of a character.
+         * @return Index of the match, or usize(-1).
+         */
+        template <typename C>
+        constexpr usize FindLastCharacter(const C* haystack, usize size, C ch)
+        {
+#if PRISM_SEARCH_STRING_SIMD
+            if constexpr (sizeof(C) == 1)
+            {
+                if (!IsConstantEvaluated())
+                    return Detail::FindLastByteSimd(
+                        reinterpret_cast<const u8*>(haystack), size,
+                        static_cast<u8>(ch));
+            }
+#endif
+
+            return Detail::FindLastCharacterScalar(haystack, size, ch);
+        }
+
+        /**
+         * @brief Finds the first occurrence of @p needle in @p haystack
+         * without allocating.
+         *
+         * Short needles of byte-sized characters go through a first/last
+         * character filter evaluated sixteen positions at a time with SIMD
+         * (eight with SWAR where vector registers are unavailable, e.g. in
+         * the kernel). Long needles use Boyer-Moore-Horspool.
+         *
+         * @return Index of the first match, 0 for an empty needle, or
+         * usize(-1) if there is none.
+         */
+        template <typename C, typename Traits = CharTraits<C>>
+        constexpr usize FindString(const BasicStringView<C, Traits>& haystack,
+                                   const BasicStringView<C, Traits>& needle)
+        {
+            const C* text   = haystack.Raw();
+            usize    size   = haystack.Size();
+            const C* word   = needle.Raw();
+            usize    length = needle.Size();
+
+            if (length == 0) return 0;
+            if (length > size) return Detail::NOT_FOUND;
+            if (length == 1) return FindCharacter(text, size, word[0]);
+
+            if (length > Detail::SHORT_NEEDLE_LIMIT)
+                return Detail::FindStringHorspool(text, size, word, length);
+
+            if constexpr (sizeof(C) == 1)
+            {
+                if (!IsConstantEvaluated())
+                {
+                    auto bytes   = reinterpret_cast<const u8*>(text);
+                    auto pattern = reinterpret_cast<const u8*>(word);
+#if PRISM_SEARCH_STRING_SIMD
+                    return Detail::FindStringSimd(bytes, size, pattern, length);
+#else
+                    return Detail::FindStringSwar(bytes, size, pattern, length);
+#endif
+                }
+            }
+
+            return Detail::FindStringScalar(text, size, word, length);
+        }
+        /**
+         * @brief Finds the last occurrence of @p needle in @p haystack
+         * without allocating.
+         *
+         * @return Index of the last match, haystack.Size() for an empty
+         * needle, or usize(-1) if there is none.
+         */
+        template <typename C, typename Traits = CharTraits<C>>
+        constexpr usize
+        FindLastString(const BasicStringView<C, Traits>& haystack,
+                       const BasicStringView<C, Traits>& needle)
+        {
+            const C* text   = haystack.Raw();
+            usize    size   = haystack.Size();
+            const C* word   = needle.Raw();
+            usize    length = needle.Size();
+
+            if (length == 0) return size;
+            if (length > size) return Detail::NOT_FOUND;
+            if (length == 1) return FindLastCharacter(text, size, word[0]);
+
+            if (length > Detail::SHORT_NEEDLE_LIMIT)
+                return Detail::FindLastStringHorspool(text, size, word, length);
+
+            if constexpr (sizeof(C) == 1)
+            {
+                if (!IsConstantEvaluated())
+                {
+                    auto bytes   = reinterpret_cast<const u8*>(text);
+                    auto pattern = reinterpret_cast<const u8*>(word);
+#if PRISM_SEARCH_STRING_SIMD
+                    return Detail::FindLastStringSimd(bytes, size, pattern,
+                                                      length);
+#else
+                    return Detail::FindLastStringSwar(bytes, size, pattern,
+                                                      length);
+#endif
+                }
+            }
+
+            return Detail::FindLastStringScalar(text, size, word, length);
+        }
+
+        /**
+         * @brief Knuth-Morris-Pratt searcher; the failure table is built
+         * once and reused for every haystack.
+         *
+         * The searcher references the pattern, which has to outlive it.
+         */
+        template <typename C, typename Traits = CharTraits<C>>
+        class KMPSearcher
+        {
+          public:
+            using ViewType = BasicStringView<C, Traits>;
+
+            constexpr explicit KMPSearcher(ViewType pattern)
+                : m_Pattern(pattern)
+            {
+                if (!m_Pattern.Empty()) ComputeLPSArray(m_Pattern, m_Table);
+            }
+
+            PM_NODISCARD constexpr ViewType Pattern() const PM_NOEXCEPT
+            {
+                return m_Pattern;
+            }
+
+            /**
+             * @brief Finds the first match starting at or after @p pos.
+             * @return Index of the match, or usize(-1).
+             */
+            PM_NODISCARD constexpr usize Find(ViewType haystack,
+                                              usize    pos = 0) const
+            {
+                usize result = Detail::NOT_FOUND;
+                ForEachMatch(haystack,
+                             [&result](usize index)
+                             {
+                                 result = index;
+                                 return false;
+                             },
+                             pos);
+
+                return result;
+            }
+            PM_NODISCARD constexpr bool Contains(ViewType haystack) const
+            {
+                return Find(haystack) != Detail::NOT_FOUND;
+            }
+
+            /**
+             * @brief Invokes @p callback with the index of every match,
+             * overlapping ones included, until it returns false.
+             */
+            template <typename F>
+            constexpr void ForEachMatch(ViewType haystack, F&& callback,
+                                        usize pos = 0) const
+            {
+                const usize length = m_Pattern.Size();
+                if (length == 0 || length > haystack.Size()) return;
+
+                usize matched = 0;
+                for (usize i = pos; i < haystack.Size(); ++i)
+                {
+                    while (matched > 0 && m_Pattern[matched] != haystack[i])
+                        matched = m_Table[matched - 1];
+
+                    if (m_Pattern[matched] == haystack[i]) ++matched;
+                    if (matched == length)
+                    {
+                        if (!callback(i + 1 - length)) return;
+                        matched = m_Table[matched - 1];
+                    }
+                }
+            }
+
+          private:
+            ViewType      m_Pattern;
+            Vector<isize> m_Table;
+        };
+
+        /**
+         * @brief Boyer-Moore-Horspool searcher; the bad character table is
+         * built once and reused for every haystack.
+         *
+         * Characters wider than a byte share a table slot per low byte. The
+         * searcher references the pattern, which has to outlive it.
+         */
+        template <typename C, typename Traits = CharTraits<C>>
+        class HorspoolSearcher
+        {
+          public:
+            using ViewType = BasicStringView<C, Traits>;
+
+            constexpr explicit HorspoolSearcher(ViewType pattern)
+                : m_Pattern(pattern)
+            {
+                const usize length = m_Pattern.Size();
+                for (auto& shift : m_Shifts) shift = length;
+                for (usize i = 0; i + 1 < length; ++i)
+                    m_Shifts[static_cast<u8>(m_Pattern[i])] = length - 1 - i;
+            }
+
+            PM_NODISCARD constexpr ViewType Pattern() const PM_NOEXCEPT
+            {
+                return m_Pattern;
+            }
+
+            /**
+             * @brief Finds the first match starting at or after @p pos.
+             * @return Index of the match, pos for an empty pattern, or
+             * usize(-1).
+             */
+            PM_NODISCARD constexpr usize Find(ViewType haystack,
+                                              usize    pos = 0) const
+            {
+                const usize length = m_Pattern.Size();
+                const C*    text   = haystack.Raw();
+                const C*    word   = m_Pattern.Raw();
+                if (pos > haystack.Size()) return Detail::NOT_FOUND;
+                if (length == 0) return pos;
+
+                const C last = word[length - 1];
+                for (usize i = pos; i + length <= haystack.Size();)
+                {
+                    const C ch = text[i + length - 1];
+                    if (ch == last && Detail::Equal(text + i, word, length - 1))
+                        return i;
+
+                    i += m_Shifts[static_cast<u8>(ch)];
+                }
+
+                return Detail::NOT_FOUND;
+            }
+            PM_NODISCARD constexpr bool Contains(ViewType haystack) const
+            {
+                return Find(haystack) != Detail::NOT_FOUND;
+            }
+
+            /**
+             * @brief Invokes @p callback with the index of every match,
+             * overlapping ones included, until it returns false.
+             */
+            template <typename F>
+            constexpr void ForEachMatch(ViewType haystack, F&& callback,
+                                        usize pos = 0) const
+            {
+                if (m_Pattern.Empty()) return;
+
+                for (usize index = Find(haystack, pos);
+                     index != Detail::NOT_FOUND;
+                     index = Find(haystack, index + 1))
+                    if (!callback(index)) return;
+            }
+
+          private:
+            ViewType m_Pattern;
+            usize    m_Shifts[256];
+        };
+
+        /**
+         * @brief Aho-Corasick automaton matching any number of byte strings
+         * in a single pass over the haystack.
+         *
+         * Patterns are added with AddPattern() and compiled by Build() into
+         * a complete DFA stored as one flat transition table. Bytes that no
+         * pattern uses collapse into a shared class, so a row holds one entry
+         * per distinct pattern byte rather than 256. Scanning then costs a
+         * table load per haystack byte regardless of the pattern count.
+         * Patterns are copied into the automaton; the views need not outlive
+         * AddPattern().
+         */
+        template <typename C, typename Traits = CharTraits<C>>
+            requires(sizeof(C) == 1)
+        class AhoCorasick
+        {
+          public:
+            using ViewType = BasicStringView<C, Traits>;
+
+            struct Match
+            {
+                /// Index of the pattern as returned by AddPattern()
+                usize           PatternIndex = Detail::NOT_FOUND;
+                /// Index of the first character of the match
+                usize           Position     = Detail::NOT_FOUND;
+
+                constexpr usize End(const AhoCorasick& automaton) const
+                {
+                    return Position + automaton.PatternLength(PatternIndex);
+                }
+                constexpr explicit operator bool() const
+                {
+                    return PatternIndex != Detail::NOT_FOUND;
+                }
+            };
+
+            AhoCorasick() = default;
+            AhoCorasick(InitializerList<ViewType> patterns)
+            {
+                for (auto pattern : patterns) AddPattern(pattern);
+                Build();
+            }
+
+            /**
+             * @brief Registers a non-empty pattern; takes effect on the next
+             * Build().
+             * @return Index reported for matches of this pattern.
+             */
+            usize AddPattern(ViewType pattern)
+            {
+                assert(!pattern.Empty());
+
+                m_Ready = false;
+                m_Lengths.PushBack(pattern.Size());
+                for (auto ch : pattern) m_Bytes.PushBack(static_cast<u8>(ch));
+
+                return m_Lengths.Size() - 1;
+            }
+            /**
+             * @brief Compiles the registered patterns into the automaton.
+             */
+            void Build()
+            {
+                BuildClasses();
+                BuildTrie();
+                BuildLinks();
+                m_Ready = true;
+            }
+
+            PM_NODISCARD constexpr usize PatternCount() const PM_NOEXCEPT
+            {
+                return m_Lengths.Size();
+            }
+            PM_NODISCARD constexpr usize PatternLength(usize index) const
+            {
+                return m_Lengths[index];
+            }
+            PM_NODISCARD constexpr usize StateCount() const PM_NOEXCEPT
+            {
+                return m_Outputs.Size();
+            }
+
+            /**
+             * @brief Invokes @p callback with every match in the order their
+             * last character is reached, until it returns false.
+             */
+            template <typename F>
+            void ForEachMatch(ViewType haystack, F&& callback) const
+            {
+                assert(m_Ready);
+
+                const u32*  transitions = m_Transitions.Raw();
+                const usize classCount  = m_ClassCount;
+                u32         state       = ROOT;
+
+                for (usize i = 0; i < haystack.Size(); ++i)
+                {
+                    u16 byteClass = m_Classes[static_cast<u8>(haystack[i])];
+                    state         = transitions[state * classCount + byteClass];
+
+                    u32 output    = m_Outputs[state] != NONE
+                                      ? state
+                                      : m_OutputLinks[state];
+                    for (; output != NONE; output = m_OutputLinks[output])
+                    {
+                        for (u32 pattern = m_Outputs[output]; pattern != NONE;
+                             pattern     = m_NextPattern[pattern])
+                        {
+                            Match match{pattern, i + 1 - m_Lengths[pattern]};
+                            if (!callback(match)) return;
+                        }
+                    }
+                }
+            }
+            /**
+             * @brief Finds the match whose last character comes first.
+             */
+            PM_NODISCARD Match FindFirst(ViewType haystack) const
+            {
+                Match result;
+                ForEachMatch(haystack,
+                             [&result](const Match& match)
+                             {
+                                 result = match;
+                                 return false;
+                             });
+
+                return result;
+            }
+            PM_NODISCARD bool Contains(ViewType haystack) const
+            {
+                return static_cast<bool>(FindFirst(haystack));
+            }
+
+          private:
+            static constexpr u32 ROOT = 0;
+            static constexpr u32 NONE = u32(-1);
+
+            // Pattern bytes, concatenated in insertion order
+            Vector<u8>           m_Bytes;
+            Vector<usize>        m_Lengths;
+
+            u16                  m_Classes[256]{};
+            usize                m_ClassCount = 1;
+
+            // m_Transitions[state * m_ClassCount + class]
+            Vector<u32>          m_Transitions;
+            // First pattern ending in each state, chained through
+            // m_NextPattern for duplicate patterns
+            Vector<u32>          m_Outputs;
+            Vector<u32>          m_NextPattern;
+            // Nearest proper suffix state that has an output
+            Vector<u32>          m_OutputLinks;
+            bool                 m_Ready = false;
+
+            void                 BuildClasses()
+            {
+                for (auto& byteClass : m_Classes) byteClass = 0;
+
+                m_ClassCount = 1;
+                for (u8 byte : m_Bytes)
+                    if (m_Classes[byte] == 0)
+                        m_Classes[byte] = static_cast<u16>(m_ClassCount++);
+            }
+            u32 AddState()
+            {
+                u32 state = static_cast<u32>(m_Outputs.Size());
+                m_Transitions.Resize(m_Transitions.Size() + m_ClassCount, NONE);
+                m_Outputs.PushBack(NONE);
+
+                return state;
+            }
+            void BuildTrie()
+            {
+                m_Transitions.Clear();
+                m_Outputs.Clear();
+                m_NextPattern.Clear();
+                m_NextPattern.Resize(m_Lengths.Size(), NONE);
+                AddState();
+
+                const u8* bytes = m_Bytes.Raw();
+                for (usize pattern = 0; pattern < m_Lengths.Size(); ++pattern)
+                {
+                    u32 state = ROOT;
+                    for (usize i = 0; i < m_Lengths[pattern]; ++i)
+                    {
+                        usize edge = state * m_ClassCount + m_Classes[*bytes++];
+                        if (m_Transitions[edge] == NONE)
+                        {
+                            u32 next            = AddState();
+                            m_Transitions[edge] = next;
+                        }
+                        state = m_Transitions[edge];
+                    }
+
+                    m_NextPattern[pattern] = m_Outputs[state];
+                    m_Outputs[state]       = static_cast<u32>(pattern);
+                }
+
+                // Duplicates were pushed to the front of their chain; reverse
+                // so matches are reported in insertion order
+                for (u32& head : m_Outputs)
+                {
+                    u32 previous = NONE;
+                    for (u32 pattern = head; pattern != NONE;)
+                    {
+                        u32 next               = m_NextPattern[pattern];
+                        m_NextPattern[pattern] = previous;
+                        previous               = pattern;
+                        pattern                = next;
+                    }
+                    head = previous;
+                }
+            }
+            // Breadth-first pass computing failure links, which are only
+            // needed to fill in the missing transitions of the DFA and the
+            // output links
+            void BuildLinks()
+            {
+                const usize stateCount = m_Outputs.Size();
+                Vector<u32> failure(stateCount, ROOT);
+                Vector<u32> queue;
+                queue.Reserve(stateCount);
+                m_OutputLinks.Clear();
+                m_OutputLinks.Resize(stateCount, NONE);
+
+                for (usize c = 0; c < m_ClassCount; ++c)
+                {
+                    u32& next = m_Transitions[c];
+                    if (next == NONE) next = ROOT;
+                    else queue.PushBack(next);
+                }
+
+                for (usize head = 0; head < queue.Size(); ++head)
+                {
+                    const u32 state = queue[head];
+                    const u32 link  = failure[state];
+                    m_OutputLinks[state] = m_Outputs[link] != NONE
+                                             ? link
+                                             : m_OutputLinks[link];
+
+                    for (usize c = 0; c < m_ClassCount; ++c)
+                    {
+                        u32& next = m_Transitions[state * m_ClassCount + c];
+                        const u32 fallback
+                            = m_Transitions[link * m_ClassCount + c];
+                        if (next == NONE)
+                        {
+                            next = fallback;
+                            continue;
+                        }
+
+                        failure[next] = fallback;
+                        queue.PushBack(next);
+                    }
+                }
+            }
+        };
     }; // namespace Algorithm
 }; // namespace Prism
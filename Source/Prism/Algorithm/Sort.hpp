@@ -6,11 +6,15 @@
  */
 #pragma once
 
+#include <Prism/Containers/Span.hpp>
 #include <Prism/Core/Concepts.hpp>
+#include <Prism/Core/Core.hpp>
 #include <Prism/Core/Iterator.hpp>
 #include <Prism/Utility/Compare.hpp>
 #include <Prism/Utility/Math.hpp>
 
+#include <new>
+
 namespace Prism
 {
     template <typename It, typename Compare>
@@ -39,20 +43,27 @@ namespace Prism
         }
     }
 
+    /**
+     * @brief Sifts first[root] down the max-heap of @p size elements.
+     *
+     * Moves a hole down instead of swapping at every level, and loops rather
+     * than recursing, so the heap fallback of the sorts needs no stack.
+     */
     template <typename It, typename Compare>
     void Heapify(It first, isize size, isize root, Compare comp)
     {
-        isize largest = root;
-        isize left    = 2 * root + 1;
-        isize right   = 2 * root + 2;
-
-        if (left < size && comp(first[largest], first[left])) largest = left;
-        if (right < size && comp(first[largest], first[right])) largest = right;
-        if (largest != root)
+        auto value = Move(first[root]);
+        for (isize child = 2 * root + 1; child < size; child = 2 * root + 1)
         {
-            IteratorSwap(first + root, first + largest);
-            Heapify(first, size, largest, comp);
+            if (child + 1 < size && comp(first[child], first[child + 1]))
+                ++child;
+            if (!comp(value, first[child])) break;
+
+            first[root] = Move(first[child]);
+            root        = child;
         }
+
+        first[root] = Move(value);
     }
 
     template <typename It, typename Compare>
@@ -70,39 +81,6 @@ namespace Prism
         }
     }
 
-    template <typename It, typename Compare>
-    void Merge(It first, It mid, It last, Compare comp)
-    {
-        using ValueType = typename IteratorTraits<It>::ValueType;
-        Vector<ValueType> left(first, mid);
-        Vector<ValueType> right(mid, last);
-
-        auto              l   = left.begin();
-        auto              r   = right.begin();
-        auto              out = first;
-
-        while (l != left.end() && r != right.end())
-        {
-            if (comp(*r, *l)) *out++ = Move(*r++);
-            else *out++ = Move(*l++);
-        }
-
-        while (l != left.end()) *out++ = Move(*l++);
-        while (r != right.end()) *out++ = Move(*r++);
-    }
-
-    template <typename It, typename Compare>
-    void MergeSort(It first, It last, Compare comp)
-    {
-        auto size = last - first;
-        if (size <= 1) return;
-
-        It mid = first + size / 2;
-        MergeSort(first, mid, comp);
-        MergeSort(mid, last, comp);
-        Merge(first, mid, last, comp);
-    }
-
     /**
      * @brief Reorders elements such that all elements matching the predicate
      *        precede elements that do not.
@@ -191,10 +169,1423 @@ namespace Prism
         InsertionSort(first, last, comp);
     }
 
+    namespace Detail
+    {
+        /// Partitions smaller than this are insertion sorted
+        constexpr isize PDQ_INSERTION_SORT_THRESHOLD     = 24;
+        /// Partitions larger than this take Tukey's ninther as the pivot
+        constexpr isize PDQ_NINTHER_THRESHOLD            = 128;
+        /// Moves after which an optimistic insertion sort gives up
+        constexpr isize PDQ_PARTIAL_INSERTION_SORT_LIMIT = 8;
+        /// Elements classified at a time by the branchless partition
+        constexpr isize PDQ_BLOCK_SIZE                   = 64;
+
+        template <typename It>
+        struct PartitionResult
+        {
+            It   Pivot;
+            bool AlreadyPartitioned;
+        };
+
+        /// Reverses [first, last) in place
+        template <typename It>
+        void Reverse(It first, It last)
+        {
+            while (first != last && first != --last)
+                IteratorSwap(first++, last);
+        }
+
+        /**
+         * @brief Whether comparing two values compiles down to a single
+         * instruction whose result can feed arithmetic instead of a branch.
+         */
+        template <typename T, typename Compare>
+        constexpr bool IS_BRANCHLESS_COMPARABLE
+            = (IsArithmeticV<T> || IsPointerV<T>)
+           && (IsSameV<Compare, Less<T>> || IsSameV<Compare, Less<>>
+               || IsSameV<Compare, Greater<T>> || IsSameV<Compare, Greater<>>);
+
+        /**
+         * @brief Insertion sort for a range preceded by an element no
+         * greater than any of its own, which stops the inner loop without a
+         * bounds check.
+         */
+        template <typename It, typename Compare>
+        void UnguardedInsertionSort(It first, It last, Compare comp)
+        {
+            if (first == last) return;
+
+            for (It it = first + 1; it != last; ++it)
+            {
+                It hole = it;
+                if (!comp(*hole, *(hole - 1))) continue;
+
+                auto value = Move(*hole);
+                do {
+                    *hole = Move(*(hole - 1));
+                    --hole;
+                } while (comp(value, *(hole - 1)));
+                *hole = Move(value);
+            }
+        }
+        /**
+         * @brief Insertion sort that gives up once it had to move elements
+         * too far, for ranges that are probably sorted already.
+         *
+         * @return Whether the range got sorted
+         */
+        template <typename It, typename Compare>
+        bool PartialInsertionSort(It first, It last, Compare comp)
+        {
+            if (first == last) return true;
+
+            isize moves = 0;
+            for (It it = first + 1; it != last; ++it)
+            {
+                It hole = it;
+                if (!comp(*hole, *(hole - 1))) continue;
+
+                auto value = Move(*hole);
+                do {
+                    *hole = Move(*(hole - 1));
+                    --hole;
+                } while (hole != first && comp(value, *(hole - 1)));
+                *hole = Move(value);
+
+                moves += it - hole;
+                if (moves > PDQ_PARTIAL_INSERTION_SORT_LIMIT) return false;
+            }
+
+            return true;
+        }
+
+        template <typename It, typename Compare>
+        PM_ALWAYS_INLINE void Sort2(It a, It b, Compare comp)
+        {
+            if (comp(*b, *a)) IteratorSwap(a, b);
+        }
+        template <typename It, typename Compare>
+        PM_ALWAYS_INLINE void Sort3(It a, It b, It c, Compare comp)
+        {
+            Sort2(a, b, comp);
+            Sort2(b, c, comp);
+            Sort2(a, b, comp);
+        }
+
+        /**
+         * @brief Exchanges the misplaced elements recorded by the block
+         * partition, first[left[i]] with last[-right[i]].
+         *
+         * When both sides are exhausted at once plain swaps are needed to
+         * keep descending input linear; otherwise the elements are rotated
+         * through a single temporary, one move per element.
+         */
+        template <typename It>
+        void SwapOffsets(It first, It last, const u8* left, const u8* right,
+                         isize count, bool useSwaps)
+        {
+            if (useSwaps)
+            {
+                for (isize i = 0; i < count; ++i)
+                    IteratorSwap(first + left[i], last - right[i]);
+                return;
+            }
+            if (count == 0) return;
+
+            It   l     = first + left[0];
+            It   r     = last - right[0];
+            auto value = Move(*l);
+            *l         = Move(*r);
+            for (isize i = 1; i < count; ++i)
+            {
+                l  = first + left[i];
+                *r = Move(*l);
+                r  = last - right[i];
+                *l = Move(*r);
+            }
+            *r = Move(value);
+        }
+
+        /**
+         * @brief Partitions around *first, with elements equal to the pivot
+         * going right, without branching on the comparisons.
+         *
+         * Blocks of elements are compared first and the indices of those on
+         * the wrong side are written down unconditionally, advancing the
+         * write position by the result of the comparison (BlockQuicksort).
+         * The swaps then follow without any unpredictable branch.
+         *
+         * @return The final position of the pivot and whether the range was
+         * partitioned already
+         */
+        template <typename It, typename Compare>
+        PartitionResult<It> PartitionRightBranchless(It begin, It end,
+                                                     Compare comp)
+        {
+            auto pivot = Move(*begin);
+            It   first = begin;
+            It   last  = end;
+
+            // The median of three guarantees an element not less than the
+            // pivot, which bounds this search
+            while (comp(*++first, pivot));
+            if (first - 1 == begin)
+                while (first < last && !comp(*--last, pivot));
+            else
+                while (!comp(*--last, pivot));
+
+            bool alreadyPartitioned = first >= last;
+            if (!alreadyPartitioned)
+            {
+                IteratorSwap(first, last);
+                ++first;
+
+                alignas(64) u8 offsetsLeft[PDQ_BLOCK_SIZE];
+                alignas(64) u8 offsetsRight[PDQ_BLOCK_SIZE];
+
+                It             leftBase  = first;
+                It             rightBase = last;
+                isize          leftCount = 0, rightCount = 0;
+                isize          leftStart = 0, rightStart = 0;
+
+                while (first < last)
+                {
+                    // Refill whichever side ran out, splitting what is left
+                    // between both when both did
+                    isize unknown   = last - first;
+                    isize leftSplit = 0, rightSplit = 0;
+                    if (leftCount == 0)
+                        leftSplit = rightCount == 0 ? unknown / 2 : unknown;
+                    if (rightCount == 0) rightSplit = unknown - leftSplit;
+
+                    if (leftSplit >= PDQ_BLOCK_SIZE) leftSplit = PDQ_BLOCK_SIZE;
+                    for (isize i = 0; i < leftSplit; ++i)
+                    {
+                        offsetsLeft[leftCount] = static_cast<u8>(i);
+                        leftCount += !comp(*first, pivot);
+                        ++first;
+                    }
+
+                    if (rightSplit >= PDQ_BLOCK_SIZE)
+                        rightSplit = PDQ_BLOCK_SIZE;
+                    for (isize i = 0; i < rightSplit;)
+                    {
+                        offsetsRight[rightCount] = static_cast<u8>(++i);
+                        rightCount += comp(*--last, pivot);
+                    }
+
+                    isize count = Min(leftCount, rightCount);
+                    SwapOffsets(leftBase, rightBase, offsetsLeft + leftStart,
+                                offsetsRight + rightStart, count,
+                                leftCount == rightCount);
+                    leftCount -= count;
+                    rightCount -= count;
+                    leftStart += count;
+                    rightStart += count;
+
+                    if (leftCount == 0)
+                    {
+                        leftStart = 0;
+                        leftBase  = first;
+                    }
+                    if (rightCount == 0)
+                    {
+                        rightStart = 0;
+                        rightBase  = last;
+                    }
+                }
+
+                // One side has misplaced elements left over; move them to
+                // the boundary
+                if (leftCount)
+                {
+                    const u8* offsets = offsetsLeft + leftStart;
+                    while (leftCount--)
+                        IteratorSwap(leftBase + offsets[leftCount], --last);
+                    first = last;
+                }
+                if (rightCount)
+                {
+                    const u8* offsets = offsetsRight + rightStart;
+                    while (rightCount--)
+                    {
+                        IteratorSwap(rightBase - offsets[rightCount], first);
+                        ++first;
+                    }
+                    last = first;
+                }
+            }
+
+            It pivotPosition = first - 1;
+            *begin           = Move(*pivotPosition);
+            *pivotPosition   = Move(pivot);
+
+            return {pivotPosition, alreadyPartitioned};
+        }
+        /**
+         * @brief Partitions around *first, with elements equal to the pivot
+         * going right.
+         *
+         * @return The final position of the pivot and whether the range was
+         * partitioned already
+         */
+        template <typename It, typename Compare>
+        PartitionResult<It> PartitionRight(It begin, It end, Compare comp)
+        {
+            auto pivot = Move(*begin);
+            It   first = begin;
+            It   last  = end;
+
+            while (comp(*++first, pivot));
+            if (first - 1 == begin)
+                while (first < last && !comp(*--last, pivot));
+            else
+                while (!comp(*--last, pivot));
+
+            bool alreadyPartitioned = first >= last;
+            // The pairs swapped so far guard both searches
+            while (first < last)
+            {
+                IteratorSwap(first, last);
+                while (comp(*++first, pivot));
+                while (!comp(*--last, pivot));
+            }
+
+            It pivotPosition = first - 1;
+            *begin           = Move(*pivotPosition);
+            *pivotPosition   = Move(pivot);
+
+            return {pivotPosition, alreadyPartitioned};
+        }
+        /**
+         * @brief Partitions around *first, with elements equal to the pivot
+         * going left, to dispose of a run of duplicates in one pass.
+         */
+        template <typename It, typename Compare>
+        It PartitionLeft(It begin, It end, Compare comp)
+        {
+            auto pivot = Move(*begin);
+            It   first = begin;
+            It   last  = end;
+
+            while (comp(pivot, *--last));
+            if (last + 1 == end)
+                while (first < last && !comp(pivot, *++first));
+            else
+                while (!comp(pivot, *++first));
+
+            while (first < last)
+            {
+                IteratorSwap(first, last);
+                while (comp(pivot, *--last));
+                while (!comp(pivot, *++first));
+            }
+
+            *begin = Move(*last);
+            *last  = Move(pivot);
+
+            return last;
+        }
+
+        template <bool Branchless, typename It, typename Compare>
+        void PdqSortLoop(It begin, It end, Compare comp, i32 badAllowed,
+                         bool leftmost)
+        {
+            while (true)
+            {
+                isize size = end - begin;
+                if (size < PDQ_INSERTION_SORT_THRESHOLD)
+                {
+                    if (leftmost) InsertionSort(begin, end, comp);
+                    else UnguardedInsertionSort(begin, end, comp);
+                    return;
+                }
+
+                // Median of three, or pseudomedian of nine for larger ranges
+                isize half = size / 2;
+                if (size > PDQ_NINTHER_THRESHOLD)
+                {
+                    Sort3(begin, begin + half, end - 1, comp);
+                    Sort3(begin + 1, begin + (half - 1), end - 2, comp);
+                    Sort3(begin + 2, begin + (half + 1), end - 3, comp);
+                    Sort3(begin + (half - 1), begin + half,
+                          begin + (half + 1), comp);
+                    IteratorSwap(begin, begin + half);
+                }
+                else Sort3(begin + half, begin, end - 1, comp);
+
+                // *(begin - 1) ended the right side of an earlier partition,
+                // so nothing here is smaller. A pivot equal to it means a
+                // run of equal elements, which go left and are done.
+                if (!leftmost && !comp(*(begin - 1), *begin))
+                {
+                    begin = PartitionLeft(begin, end, comp) + 1;
+                    continue;
+                }
+
+                auto [pivot, alreadyPartitioned]
+                    = Branchless ? PartitionRightBranchless(begin, end, comp)
+                                 : PartitionRight(begin, end, comp);
+
+                isize leftSize  = pivot - begin;
+                isize rightSize = end - (pivot + 1);
+                if (leftSize < size / 8 || rightSize < size / 8)
+                {
+                    // Too many bad pivots; heap sort bounds the worst case
+                    if (--badAllowed == 0)
+                    {
+                        HeapSort(begin, end, comp);
+                        return;
+                    }
+
+                    // Shuffle a few elements to break up the pattern that
+                    // produced the bad pivot
+                    if (leftSize >= PDQ_INSERTION_SORT_THRESHOLD)
+                    {
+                        IteratorSwap(begin, begin + leftSize / 4);
+                        IteratorSwap(pivot - 1, pivot - leftSize / 4);
+                        if (leftSize > PDQ_NINTHER_THRESHOLD)
+                        {
+                            IteratorSwap(begin + 1, begin + (leftSize / 4 + 1));
+                            IteratorSwap(begin + 2, begin + (leftSize / 4 + 2));
+                            IteratorSwap(pivot - 2, pivot - (leftSize / 4 + 1));
+                            IteratorSwap(pivot - 3, pivot - (leftSize / 4 + 2));
+                        }
+                    }
+                    if (rightSize >= PDQ_INSERTION_SORT_THRESHOLD)
+                    {
+                        IteratorSwap(pivot + 1, pivot + (1 + rightSize / 4));
+                        IteratorSwap(end - 1, end - rightSize / 4);
+                        if (rightSize > PDQ_NINTHER_THRESHOLD)
+                        {
+                            IteratorSwap(pivot + 2,
+                                         pivot + (2 + rightSize / 4));
+                            IteratorSwap(pivot + 3,
+                                         pivot + (3 + rightSize / 4));
+                            IteratorSwap(end - 2, end - (1 + rightSize / 4));
+                            IteratorSwap(end - 3, end - (2 + rightSize / 4));
+                        }
+                    }
+                }
+                // A balanced split of a range that needed no swaps suggests
+                // it is (nearly) sorted
+                else if (alreadyPartitioned
+                         && PartialInsertionSort(begin, pivot, comp)
+                         && PartialInsertionSort(pivot + 1, end, comp))
+                    return;
+
+                // Recurse into the left side, loop on the right one
+                PdqSortLoop<Branchless>(begin, pivot, comp, badAllowed,
+                                        leftmost);
+                begin    = pivot + 1;
+                leftmost = false;
+            }
+        }
+
+        /// A key extractor, as opposed to a comparator
+        template <typename P, typename T>
+        concept SortProjection = IsInvocableV<P&, const T&>
+                              && !IsInvocableV<P&, const T&, const T&>;
+    }; // namespace Detail
+
+    /**
+     * @brief Sorts [first, last) with pattern-defeating quicksort.
+     *
+     * An unstable O(n log n) sort that is linear on sorted, reversed and
+     * few-unique inputs. Input that is already one ascending or strictly
+     * descending run is detected in a single pass. Partitions choose their
+     * pivot by median of three or Tukey's ninther, equal keys are grouped
+     * in one pass, a split that comes out badly unbalanced shuffles a few
+     * elements to break up adversarial patterns, and after too many of
+     * those heap sort takes over. Arithmetic keys under Less or Greater use
+     * the branchless block partition.
+     */
+    template <typename It, typename Compare = Less<>>
+        requires(!Detail::SortProjection<
+                 Compare, typename IteratorTraits<It>::ValueType>)
+    void Sort(It first, It last, Compare compare = Compare{})
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+
+        isize size      = last - first;
+        if (size < 2) return;
+
+        isize run        = 2;
+        bool  descending = compare(first[1], first[0]);
+        if (descending)
+            while (run < size && compare(first[run], first[run - 1])) ++run;
+        else
+            while (run < size && !compare(first[run], first[run - 1])) ++run;
+
+        if (run == size)
+        {
+            if (descending) Detail::Reverse(first, last);
+            return;
+        }
+
+        constexpr bool Branchless
+            = Detail::IS_BRANCHLESS_COMPARABLE<ValueType, Compare>;
+        Detail::PdqSortLoop<Branchless>(
+            first, last, compare, static_cast<i32>(Math::Log2(usize(size))),
+            true);
+    }
+
+    namespace Detail
+    {
+        /// Runs shorter than this are extended with insertion sort
+        constexpr isize STABLE_MIN_RUN = 32;
+        /// Wins in a row after which a merge starts galloping
+        constexpr isize MIN_GALLOP     = 7;
+
+        /// Uninitialized storage for the elements a merge moves aside
+        template <typename T>
+        class MergeBuffer
+        {
+          public:
+            explicit MergeBuffer(isize capacity)
+            {
+                if (capacity <= 0) return;
+
+                // A failed allocation leaves no capacity, and callers fall
+                // back to algorithms that need no scratch memory
+                m_Data = reinterpret_cast<T*>(
+                    ::operator new(capacity * sizeof(T), std::nothrow));
+                if (m_Data) m_Capacity = capacity;
+            }
+            ~MergeBuffer()
+            {
+                if (m_Data) ::operator delete(m_Data);
+            }
+
+            MergeBuffer(const MergeBuffer&)            = delete;
+            MergeBuffer& operator=(const MergeBuffer&) = delete;
+
+            T*           Raw() const { return m_Data; }
+            isize        Capacity() const { return m_Capacity; }
+
+          private:
+            T*    m_Data     = nullptr;
+            isize m_Capacity = 0;
+        };
+
+        /**
+         * @brief Swaps [first, mid) and [mid, last) by three reversals.
+         *
+         * @return Where *first ended up
+         */
+        template <typename It>
+        It Rotate(It first, It mid, It last)
+        {
+            Reverse(first, mid);
+            Reverse(mid, last);
+            Reverse(first, last);
+
+            return first + (last - mid);
+        }
+        /// Insertion sorts [sorted, last) into the sorted [first, sorted)
+        template <typename It, typename Compare>
+        void InsertionSortFrom(It first, It sorted, It last, Compare comp)
+        {
+            for (It it = sorted; it != last; ++it)
+            {
+                if (!comp(*it, *(it - 1))) continue;
+
+                auto value = Move(*it);
+                It   hole  = it;
+                do {
+                    *hole = Move(*(hole - 1));
+                    --hole;
+                } while (hole != first && comp(value, *(hole - 1)));
+                *hole = Move(value);
+            }
+        }
+
+        template <typename It, typename T>
+        T* MoveToBuffer(It first, It last, T* buffer)
+        {
+            for (; first != last; ++first, ++buffer)
+                ConstructAt(buffer, Move(*first));
+            return buffer;
+        }
+        template <typename T>
+        void DestroyBuffer(T* first, T* last)
+        {
+            if constexpr (!IsTriviallyDestructibleV<T>)
+                for (; first != last; ++first) DestroyAt(first);
+        }
+        template <typename In, typename Out>
+        Out MoveForward(In first, In last, Out out)
+        {
+            for (; first != last; ++first, ++out) *out = Move(*first);
+            return out;
+        }
+        template <typename In, typename Out>
+        Out MoveBackward(In first, In last, Out out)
+        {
+            while (first != last) *--out = Move(*--last);
+            return out;
+        }
+
+        /**
+         * @brief The first element of [first, last) greater than @p value,
+         * found by probing 1, 2, 4... elements in before a binary search, so
+         * the cost grows with the distance rather than the length.
+         */
+        template <typename It, typename T, typename Compare>
+        It GallopUpper(It first, It last, const T& value, Compare comp)
+        {
+            isize size = last - first, low = 0, high = size;
+            for (isize step = 1; low + step - 1 < size; step <<= 1)
+            {
+                isize probe = low + step - 1;
+                if (comp(value, first[probe]))
+                {
+                    high = probe;
+                    break;
+                }
+                low = probe + 1;
+            }
+            while (low < high)
+            {
+                isize mid = low + (high - low) / 2;
+                if (comp(value, first[mid])) high = mid;
+                else low = mid + 1;
+            }
+
+            return first + low;
+        }
+        /// The first element of [first, last) not less than @p value
+        template <typename It, typename T, typename Compare>
+        It GallopLower(It first, It last, const T& value, Compare comp)
+        {
+            isize size = last - first, low = 0, high = size;
+            for (isize step = 1; low + step - 1 < size; step <<= 1)
+            {
+                isize probe = low + step - 1;
+                if (!comp(first[probe], value))
+                {
+                    high = probe;
+                    break;
+                }
+                low = probe + 1;
+            }
+            while (low < high)
+            {
+                isize mid = low + (high - low) / 2;
+                if (comp(first[mid], value)) low = mid + 1;
+                else high = mid;
+            }
+
+            return first + low;
+        }
+        /// GallopUpper probing from the back of the range
+        template <typename It, typename T, typename Compare>
+        It GallopUpperBack(It first, It last, const T& value, Compare comp)
+        {
+            isize low = 0, high = last - first;
+            for (isize step = 1; high - step >= low; step <<= 1)
+            {
+                isize probe = high - step;
+                if (!comp(value, first[probe]))
+                {
+                    low = probe + 1;
+                    break;
+                }
+                high = probe;
+            }
+            while (low < high)
+            {
+                isize mid = low + (high - low) / 2;
+                if (comp(value, first[mid])) high = mid;
+                else low = mid + 1;
+            }
+
+            return first + low;
+        }
+        /// GallopLower probing from the back of the range
+        template <typename It, typename T, typename Compare>
+        It GallopLowerBack(It first, It last, const T& value, Compare comp)
+        {
+            isize low = 0, high = last - first;
+            for (isize step = 1; high - step >= low; step <<= 1)
+            {
+                isize probe = high - step;
+                if (comp(first[probe], value))
+                {
+                    low = probe + 1;
+                    break;
+                }
+                high = probe;
+            }
+            while (low < high)
+            {
+                isize mid = low + (high - low) / 2;
+                if (comp(first[mid], value)) low = mid + 1;
+                else high = mid;
+            }
+
+            return first + low;
+        }
+
+        /**
+         * @brief Merges the runs [first, mid) and [mid, last), moving the
+         * shorter left one into @p buffer and filling from the front.
+         *
+         * Elements are taken one at a time until one run wins MIN_GALLOP
+         * times in a row; from then on the length of each winning streak
+         * is found by galloping and moved in bulk, until streaks get short
+         * again. Runs that interleave coarsely, as they do in mostly sorted
+         * data, so merge in far fewer comparisons.
+         */
+        template <typename It, typename T, typename Compare>
+        void MergeLow(It first, It mid, It last, T* buffer, Compare comp)
+        {
+            T*    a         = buffer;
+            T*    aEnd      = MoveToBuffer(first, mid, buffer);
+            T*    bufferEnd = aEnd;
+            It    b         = mid;
+            It    out       = first;
+
+            isize minGallop = MIN_GALLOP;
+            while (a != aEnd && b != last)
+            {
+                isize winsA = 0, winsB = 0;
+                do {
+                    if (comp(*b, *a))
+                    {
+                        *out++ = Move(*b++);
+                        ++winsB;
+                        winsA = 0;
+                    }
+                    else
+                    {
+                        *out++ = Move(*a++);
+                        ++winsA;
+                        winsB = 0;
+                    }
+                } while (a != aEnd && b != last
+                         && Max(winsA, winsB) < minGallop);
+
+                while (a != aEnd && b != last)
+                {
+                    T* aStop = GallopUpper(a, aEnd, *b, comp);
+                    winsA    = aStop - a;
+                    out      = MoveForward(a, aStop, out);
+                    a        = aStop;
+                    if (a == aEnd) break;
+
+                    It bStop = GallopLower(b, last, *a, comp);
+                    winsB    = bStop - b;
+                    out      = MoveForward(b, bStop, out);
+                    b        = bStop;
+
+                    if (minGallop > 1) --minGallop;
+                    if (winsA < MIN_GALLOP && winsB < MIN_GALLOP) break;
+                }
+                minGallop += 2;
+            }
+
+            // Whatever is left of the right run is in place already
+            MoveForward(a, aEnd, out);
+            DestroyBuffer(buffer, bufferEnd);
+        }
+        /**
+         * @brief MergeLow mirrored: moves the shorter right run into
+         * @p buffer and fills from the back.
+         */
+        template <typename It, typename T, typename Compare>
+        void MergeHigh(It first, It mid, It last, T* buffer, Compare comp)
+        {
+            T*    bEnd      = MoveToBuffer(mid, last, buffer);
+            T*    bufferEnd = bEnd;
+            It    a         = mid;
+            It    out       = last;
+
+            isize minGallop = MIN_GALLOP;
+            while (a != first && bEnd != buffer)
+            {
+                isize winsA = 0, winsB = 0;
+                do {
+                    // Ties go to the right run, which keeps them last
+                    if (comp(*(bEnd - 1), *(a - 1)))
+                    {
+                        *--out = Move(*--a);
+                        ++winsA;
+                        winsB = 0;
+                    }
+                    else
+                    {
+                        *--out = Move(*--bEnd);
+                        ++winsB;
+                        winsA = 0;
+                    }
+                } while (a != first && bEnd != buffer
+                         && Max(winsA, winsB) < minGallop);
+
+                while (a != first && bEnd != buffer)
+                {
+                    It aStop = GallopUpperBack(first, a, *(bEnd - 1), comp);
+                    winsA    = a - aStop;
+                    out      = MoveBackward(aStop, a, out);
+                    a        = aStop;
+                    if (a == first) break;
+
+                    T* bStop = GallopLowerBack(buffer, bEnd, *(a - 1), comp);
+                    winsB    = bEnd - bStop;
+                    out      = MoveBackward(bStop, bEnd, out);
+                    bEnd     = bStop;
+
+                    if (minGallop > 1) --minGallop;
+                    if (winsA < MIN_GALLOP && winsB < MIN_GALLOP) break;
+                }
+                minGallop += 2;
+            }
+
+            MoveBackward(buffer, bEnd, out);
+            DestroyBuffer(buffer, bufferEnd);
+        }
+
+        /**
+         * @brief Merges the sorted runs [first, mid) and [mid, last) stably,
+         * through @p buffer when the shorter run fits in it.
+         *
+         * Otherwise the longer run is cut in half, the matching cut in the
+         * other run found by binary search, and the pieces between the cuts
+         * rotated into place, leaving two smaller merges. With no buffer at
+         * all this merges in place in O(n log n).
+         */
+        template <typename It, typename T, typename Compare>
+        void MergeAdaptive(It first, It mid, It last, T* buffer,
+                           isize capacity, Compare comp)
+        {
+            if (first == mid || mid == last) return;
+
+            // Elements of the left run no greater than the right run's first
+            // and elements of the right run no less than the left run's last
+            // are in place already
+            first = GallopUpper(first, mid, *mid, comp);
+            if (first == mid) return;
+            last = GallopLowerBack(mid, last, *(mid - 1), comp);
+            if (mid == last) return;
+
+            isize leftSize  = mid - first;
+            isize rightSize = last - mid;
+            // A single element left over belongs at the far end
+            if (leftSize == 1 || rightSize == 1)
+            {
+                Rotate(first, mid, last);
+                return;
+            }
+            if (leftSize <= rightSize && leftSize <= capacity)
+                return MergeLow(first, mid, last, buffer, comp);
+            if (rightSize <= capacity)
+                return MergeHigh(first, mid, last, buffer, comp);
+
+            It leftCut, rightCut;
+            if (leftSize > rightSize)
+            {
+                leftCut  = first + leftSize / 2;
+                rightCut = GallopLower(mid, last, *leftCut, comp);
+            }
+            else
+            {
+                rightCut = mid + rightSize / 2;
+                leftCut  = GallopUpper(first, mid, *rightCut, comp);
+            }
+
+            It newMid = Rotate(leftCut, mid, rightCut);
+            MergeAdaptive(first, leftCut, newMid, buffer, capacity, comp);
+            MergeAdaptive(newMid, rightCut, last, buffer, capacity, comp);
+        }
+
+        /**
+         * @brief Finds the run starting at @p first: the longest ascending
+         * or strictly descending (then reversed) prefix, extended to
+         * STABLE_MIN_RUN elements by insertion sort.
+         *
+         * @return The length of the run
+         */
+        template <typename It, typename Compare>
+        isize NextRun(It first, It last, Compare comp)
+        {
+            isize remaining = last - first;
+            if (remaining < 2) return remaining;
+
+            isize length = 2;
+            if (comp(first[1], first[0]))
+            {
+                while (length < remaining
+                       && comp(first[length], first[length - 1]))
+                    ++length;
+                Reverse(first, first + length);
+            }
+            else
+                while (length < remaining
+                       && !comp(first[length], first[length - 1]))
+                    ++length;
+
+            if (length < STABLE_MIN_RUN)
+            {
+                isize extended = Min(STABLE_MIN_RUN, remaining);
+                InsertionSortFrom(first, first + length, first + extended,
+                                  comp);
+                length = extended;
+            }
+
+            return length;
+        }
+
+        /**
+         * @brief Powersort's priority for merging the adjacent runs starting
+         * at @p begin1 and @p begin1 + @p length1: the depth of the node
+         * above their boundary in a near-optimal merge tree over @p size
+         * elements, i.e. the first bit in which the binary fractions of the
+         * runs' midpoints differ.
+         */
+        inline i32 NodePower(isize begin1, isize length1, isize length2,
+                             isize size)
+        {
+            // Twice the midpoints, as fractions of size
+            isize a     = 2 * begin1 + length1;
+            isize b     = a + length1 + length2;
+
+            i32   power = 0;
+            while (true)
+            {
+                ++power;
+                if (a >= size)
+                {
+                    a -= size;
+                    b -= size;
+                }
+                else if (b >= size) break;
+
+                a <<= 1;
+                b <<= 1;
+            }
+
+            return power;
+        }
+
+        /**
+         * @brief Sorts stably by merging natural runs in powersort order.
+         *
+         * Runs are found left to right. Each boundary between two runs gets
+         * a power; runs on the stack whose boundary power exceeds the new
+         * one are merged first, which keeps merges balanced and makes the
+         * total cost within a small margin of optimal for the run lengths
+         * found, so presorted input costs close to linear time.
+         */
+        template <typename It, typename T, typename Compare>
+        void PowerSort(It first, It last, T* buffer, isize capacity,
+                       Compare comp)
+        {
+            struct Run
+            {
+                It    Begin;
+                isize Length;
+                // Power of the boundary after the run
+                i32   Power;
+            };
+
+            isize size = last - first;
+            // Powers on the stack increase, and cannot exceed log2(size) + 1
+            Run   runs[sizeof(isize) * 8 + 1];
+            isize count     = 0;
+
+            It    runBegin  = first;
+            isize runLength = NextRun(first, last, comp);
+            while (runBegin + runLength != last)
+            {
+                It    nextBegin  = runBegin + runLength;
+                isize nextLength = NextRun(nextBegin, last, comp);
+                i32   power = NodePower(runBegin - first, runLength, nextLength,
+                                        size);
+
+                while (count > 0 && runs[count - 1].Power > power)
+                {
+                    Run& top = runs[--count];
+                    MergeAdaptive(top.Begin, runBegin, runBegin + runLength,
+                                  buffer, capacity, comp);
+                    runBegin = top.Begin;
+                    runLength += top.Length;
+                }
+
+                runs[count++] = {runBegin, runLength, power};
+                runBegin      = nextBegin;
+                runLength     = nextLength;
+            }
+
+            while (count > 0)
+            {
+                Run& top = runs[--count];
+                MergeAdaptive(top.Begin, runBegin, runBegin + runLength, buffer,
+                              capacity, comp);
+                runBegin = top.Begin;
+                runLength += top.Length;
+            }
+        }
+    }; // namespace Detail
+
+    /**
+     * @brief Sorts [first, last) keeping equal elements in their order.
+     *
+     * Natural runs, ascending or strictly descending, are detected and
+     * merged in powersort order with galloping merges, so mostly ordered
+     * input sorts in close to linear time. A single scratch buffer of half
+     * the range is allocated up front.
+     */
+    template <typename It, typename Compare = Less<>>
+    void StableSort(It first, It last, Compare comp = Compare{})
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+
+        isize size      = last - first;
+        if (size < 2) return;
+
+        Detail::MergeBuffer<ValueType> buffer(
+            size <= Detail::STABLE_MIN_RUN ? 0 : size / 2);
+        Detail::PowerSort(first, last, buffer.Raw(), buffer.Capacity(), comp);
+    }
+    /**
+     * @brief StableSort without allocating: merges rotate elements in place
+     * instead, for O(n log^2 n) time.
+     */
     template <typename It, typename Compare = Less<>>
-    void Sort(It first, It last, Compare compare)
+    void StableSortInPlace(It first, It last, Compare comp = Compare{})
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+        if (last - first < 2) return;
+
+        Detail::PowerSort<It, ValueType>(first, last, nullptr, 0, comp);
+    }
+
+    /**
+     * @brief Stably merges the sorted ranges [first, mid) and [mid, last),
+     * with a buffer the size of the shorter one.
+     */
+    template <typename It, typename Compare>
+    void Merge(It first, It mid, It last, Compare comp)
+    {
+        using ValueType = typename IteratorTraits<It>::ValueType;
+        if (first == mid || mid == last) return;
+
+        Detail::MergeBuffer<ValueType> buffer(Min(mid - first, last - mid));
+        Detail::MergeAdaptive(first, mid, last, buffer.Raw(),
+                              buffer.Capacity(), comp);
+    }
+
+    template <typename It, typename Compare>
+    void MergeSort(It first, It last, Compare comp)
+    {
+        StableSort(first, last, comp);
+    }
+
+    namespace Detail
+    {
+        /// Ranges shorter than this are insertion sorted by the radix sorts
+        constexpr isize RADIX_SORT_THRESHOLD      = 64;
+        /// Ranges from this size up take 11 bit digits instead of 8 bit ones
+        constexpr isize RADIX_WIDE_DIGIT_THRESHOLD = 1 << 16;
+
+        struct IdentityProjection
+        {
+            template <typename T>
+            constexpr T&& operator()(T&& value) const
+            {
+                return Forward<T>(value);
+            }
+        };
+
+        template <typename P, typename T>
+        using ProjectedType = RemoveCvRefType<InvokeResultType<P&, const T&>>;
+
+        /// Integers sortable digit by digit
+        template <typename K>
+        concept RadixIntegerKey = Integral<K> && !IsSameV<K, bool>;
+        /// Byte strings sortable character by character
+        template <typename K>
+        concept RadixStringKey = requires(const K& key) {
+            { key.Size() } -> ConvertibleTo<usize>;
+            { key.Raw() } -> PointerType;
+            requires sizeof(*key.Raw()) == 1;
+        };
+
+        /**
+         * @brief The unsigned key ordered like @p key: signed keys get their
+         * sign bit flipped, so negative values come first.
+         */
+        template <RadixIntegerKey K>
+        constexpr typename MakeUnsigned<K>::Type ToRadixKey(K key)
+        {
+            using U = typename MakeUnsigned<K>::Type;
+            if constexpr (IsSignedV<K>)
+                return static_cast<U>(key) ^ (U(1) << (sizeof(U) * 8 - 1));
+            else return static_cast<U>(key);
+        }
+
+        /**
+         * @brief Moves every element of [first, last) to out[position],
+         * where positions come from the prefix sums in @p offsets, which are
+         * advanced. Constructs the destination when it is raw storage.
+         */
+        template <bool Construct, usize DigitBits, typename In, typename Out,
+                  typename Projection>
+        void RadixScatter(In first, In last, Out out, usize* offsets,
+                          usize shift, Projection& proj)
+        {
+            constexpr usize MASK = (usize(1) << DigitBits) - 1;
+            for (; first != last; ++first)
+            {
+                usize digit = (ToRadixKey(proj(*first)) >> shift) & MASK;
+                if constexpr (Construct)
+                    ConstructAt(&out[offsets[digit]++], Move(*first));
+                else out[offsets[digit]++] = Move(*first);
+            }
+        }
+
+        /**
+         * @brief Least significant digit first radix sort through
+         * @p buffer, which holds @p bufferLive constructed elements or is raw
+         * storage.
+         *
+         * The histograms of all digits are taken in a single read pass.
+         * A digit in which every key agrees cannot change the order, so its
+         * pass is skipped; keys that only use their low bits cost as many
+         * passes as they have significant digits.
+         *
+         * @return Whether @p buffer holds constructed elements afterwards
+         */
+        template <usize DigitBits, typename It, typename T,
+                  typename Projection>
+        bool LsdRadixSort(It first, It last, T* buffer, bool bufferLive,
+                          Projection& proj)
+        {
+            using KeyType            = ProjectedType<Projection, T>;
+            constexpr usize RADIX    = usize(1) << DigitBits;
+            constexpr usize KEY_BITS = sizeof(KeyType) * 8;
+            constexpr usize PASSES   = (KEY_BITS + DigitBits - 1) / DigitBits;
+            constexpr usize MASK     = RADIX - 1;
+
+            usize           size     = last - first;
+
+            // Byte digits count on the stack; the wide digit histograms are
+            // too large for it, and without memory for them bytes do
+            constexpr bool  ON_STACK = DigitBits <= 8;
+            usize           stackCounts[ON_STACK ? PASSES * RADIX : 1];
+            MergeBuffer<usize> histograms(ON_STACK ? 0 : PASSES * RADIX);
+            if constexpr (!ON_STACK)
+                if (histograms.Capacity() == 0)
+                    return LsdRadixSort<8>(first, last, buffer, bufferLive,
+                                           proj);
+
+            usize* counts = ON_STACK ? stackCounts : histograms.Raw();
+            for (usize i = 0; i < PASSES * RADIX; ++i) counts[i] = 0;
+
+            for (It it = first; it != last; ++it)
+            {
+                auto key = ToRadixKey(proj(*it));
+                for (usize pass = 0; pass < PASSES; ++pass)
+                {
+                    usize digit = (key >> (pass * DigitBits)) & MASK;
+                    ++counts[pass * RADIX + digit];
+                }
+            }
+
+            auto firstKey = ToRadixKey(proj(*first));
+            bool inBuffer = false;
+            for (usize pass = 0; pass < PASSES; ++pass)
+            {
+                usize* offsets = counts + pass * RADIX;
+                usize  shift   = pass * DigitBits;
+                if (offsets[(firstKey >> shift) & MASK] == size) continue;
+
+                usize sum = 0;
+                for (usize digit = 0; digit < RADIX; ++digit)
+                {
+                    usize count     = offsets[digit];
+                    offsets[digit] = sum;
+                    sum += count;
+                }
+
+                if (inBuffer)
+                    RadixScatter<false, DigitBits>(buffer, buffer + size, first,
+                                                   offsets, shift, proj);
+                else if (bufferLive)
+                    RadixScatter<false, DigitBits>(first, last, buffer,
+                                                   offsets, shift, proj);
+                else
+                {
+                    RadixScatter<true, DigitBits>(first, last, buffer, offsets,
+                                                  shift, proj);
+                    bufferLive = true;
+                }
+                inBuffer = !inBuffer;
+            }
+
+            if (inBuffer) MoveForward(buffer, buffer + size, first);
+            return bufferLive;
+        }
+
+        /**
+         * @brief Radix sorts [first, last) through @p buffer, with wide
+         * digits for large ranges when @p wideDigits allows allocating their
+         * histograms.
+         */
+        template <typename It, typename T, typename Projection>
+        bool RadixSortDispatch(It first, It last, T* buffer, bool bufferLive,
+                               bool wideDigits, Projection& proj)
+        {
+            using KeyType = ProjectedType<Projection, T>;
+
+            // Presorted input is common enough to be worth one extra look
+            It it = first + 1;
+            while (it != last && !(proj(*it) < proj(*(it - 1)))) ++it;
+            if (it == last) return bufferLive;
+
+            if (wideDigits && sizeof(KeyType) >= 4
+                && last - first >= RADIX_WIDE_DIGIT_THRESHOLD)
+                return LsdRadixSort<11>(first, last, buffer, bufferLive, proj);
+            return LsdRadixSort<8>(first, last, buffer, bufferLive, proj);
+        }
+        /**
+         * @brief Radix sorts [first, last) through a copy it allocates.
+         *
+         * @return Whether there was memory for the copy; if not, the range
+         * is left untouched
+         */
+        template <typename It, typename Projection>
+        bool RadixSortAllocating(It first, It last, Projection& proj)
+        {
+            using ValueType = typename IteratorTraits<It>::ValueType;
+
+            usize size      = last - first;
+            MergeBuffer<ValueType> buffer(size);
+            if (buffer.Capacity() == 0) return false;
+
+            bool live = RadixSortDispatch(first, last, buffer.Raw(), false,
+                                          true, proj);
+            if (live) DestroyBuffer(buffer.Raw(), buffer.Raw() + size);
+            return true;
+        }
+
+        /// Byte @p depth of @p key plus one, or 0 past its end
+        template <typename K>
+        PM_ALWAYS_INLINE usize FlagBucket(const K& key, usize depth)
+        {
+            if (depth >= static_cast<usize>(key.Size())) return 0;
+            return static_cast<usize>(static_cast<u8>(key.Raw()[depth])) + 1;
+        }
+        /// Compares @p lhs and @p rhs bytewise from @p depth on
+        template <typename K>
+        bool SuffixLess(const K& lhs, const K& rhs, usize depth)
+        {
+            usize lhsSize = lhs.Size(), rhsSize = rhs.Size();
+            for (usize i = depth; i < lhsSize && i < rhsSize; ++i)
+            {
+                u8 l = static_cast<u8>(lhs.Raw()[i]);
+                u8 r = static_cast<u8>(rhs.Raw()[i]);
+                if (l != r) return l < r;
+            }
+
+            return lhsSize < rhsSize;
+        }
+
+        /**
+         * @brief Permutes [first, last) into buckets by byte @p depth of the
+         * keys, in place: each element is swapped straight into the next
+         * free slot of its bucket until every bucket is full.
+         *
+         * @return Whether the keys spread over more than one bucket
+         */
+        template <typename It, typename Projection>
+        bool FlagPartition(It first, It last, usize depth, Projection& proj)
+        {
+            constexpr usize BUCKETS = 257;
+
+            usize           size    = last - first;
+            usize           counts[BUCKETS] = {};
+            for (It it = first; it != last; ++it)
+                ++counts[FlagBucket(proj(*it), depth)];
+            if (counts[FlagBucket(proj(*first), depth)] == size) return false;
+
+            usize heads[BUCKETS], tails[BUCKETS];
+            usize sum = 0;
+            for (usize bucket = 0; bucket < BUCKETS; ++bucket)
+            {
+                heads[bucket] = sum;
+                sum += counts[bucket];
+                tails[bucket] = sum;
+            }
+
+            for (usize bucket = 0; bucket < BUCKETS; ++bucket)
+                while (heads[bucket] < tails[bucket])
+                {
+                    It    it     = first + heads[bucket];
+                    usize target = FlagBucket(proj(*it), depth);
+                    if (target == bucket) ++heads[bucket];
+                    else IteratorSwap(it, first + heads[target]++);
+                }
+
+            return true;
+        }
+
+        /**
+         * @brief Most significant digit first radix sort of byte strings
+         * sharing their first @p depth bytes (American flag sort).
+         *
+         * Needs no memory besides the bucket counts of one level at a time.
+         * Only buckets smaller than the largest one are recursed into, each
+         * at most half the range, and the largest is sorted by the loop, so
+         * the stack depth is logarithmic in the number of elements however
+         * long the shared prefixes are.
+         */
+        template <typename It, typename Projection>
+        void AmericanFlagSort(It first, It last, usize depth,
+                              Projection& proj)
+        {
+            while (last - first >= RADIX_SORT_THRESHOLD)
+            {
+                if (!FlagPartition(first, last, depth, proj))
+                {
+                    // All keys share this byte, or all of them ended here
+                    if (FlagBucket(proj(*first), depth) == 0) return;
+                    ++depth;
+                    continue;
+                }
+
+                // Strings that ended are equal; every other bucket is sorted
+                // on the next byte
+                It largestBegin = first, largestEnd = first;
+                for (It bucket = first; bucket != last;)
+                {
+                    usize value = FlagBucket(proj(*bucket), depth);
+                    It    end   = bucket + 1;
+                    while (end != last
+                           && FlagBucket(proj(*end), depth) == value)
+                        ++end;
+
+                    if (value != 0
+                        && end - bucket > largestEnd - largestBegin)
+                    {
+                        // The largest so far now has a larger bucket after it
+                        if (largestBegin != largestEnd)
+                            AmericanFlagSort(largestBegin, largestEnd,
+                                             depth + 1, proj);
+                        largestBegin = bucket;
+                        largestEnd   = end;
+                    }
+                    else if (value != 0)
+                        AmericanFlagSort(bucket, end, depth + 1, proj);
+                    bucket = end;
+                }
+                if (largestBegin == largestEnd) return;
+
+                first = largestBegin;
+                last  = largestEnd;
+                ++depth;
+            }
+
+            InsertionSort(first, last,
+                          [&proj, depth](const auto& lhs, const auto& rhs)
+                          { return SuffixLess(proj(lhs), proj(rhs), depth); });
+        }
+    }; // namespace Detail
+
+    /**
+     * @brief Sorts [first, last) stably by the integer key @p proj
+     * returns, one 8 or 11 bit digit at a time, through @p scratch.
+     *
+     * @p scratch holds at least last - first constructed elements, whose
+     * values are left unspecified; reusing it across calls keeps repeated
+     * sorts from allocating the copy. Digits stay 8 bits wide so that the
+     * histograms fit on the stack and nothing is allocated at all.
+     */
+    template <typename It, typename Projection = Detail::IdentityProjection>
+        requires Detail::RadixIntegerKey<Detail::ProjectedType<
+            Projection, typename IteratorTraits<It>::ValueType>>
+    void RadixSort(It first, It last,
+                   Span<typename IteratorTraits<It>::ValueType> scratch,
+                   Projection                                   proj = {})
+    {
+        isize size = last - first;
+        assert(scratch.Size() >= static_cast<usize>(size));
+
+        if (size < Detail::RADIX_SORT_THRESHOLD)
+            return InsertionSort(first, last,
+                                 [&proj](const auto& lhs, const auto& rhs)
+                                 { return proj(lhs) < proj(rhs); });
+        Detail::RadixSortDispatch(first, last, scratch.Raw(), true, false,
+                                  proj);
+    }
+    /**
+     * @brief Sorts [first, last) stably by the integer key @p proj
+     * returns, one 8 or 11 bit digit at a time.
+     *
+     * Runs in O(n) for a fixed key width, with digit passes the keys all
+     * agree on skipped. Allocates a copy of the range; without memory for
+     * it, falls back to StableSort.
+     */
+    template <typename It, typename Projection = Detail::IdentityProjection>
+        requires Detail::RadixIntegerKey<Detail::ProjectedType<
+            Projection, typename IteratorTraits<It>::ValueType>>
+    void RadixSort(It first, It last, Projection proj = {})
     {
-        IntroSort(first, last, compare);
+        using ValueType = typename IteratorTraits<It>::ValueType;
+
+        isize size      = last - first;
+        if (size < Detail::RADIX_SORT_THRESHOLD)
+            return InsertionSort(first, last,
+                                 [&proj](const auto& lhs, const auto& rhs)
+                                 { return proj(lhs) < proj(rhs); });
+
+        if (!Detail::RadixSortAllocating(first, last, proj))
+            StableSort(first, last,
+                       [&proj](const ValueType& lhs, const ValueType& rhs)
+                       { return proj(lhs) < proj(rhs); });
+    }
+    /**
+     * @brief Sorts [first, last) in place by the byte string @p proj
+     * returns, comparing bytes as unsigned, with American flag sort.
+     *
+     * Not stable. Each element is looked at once per byte of the prefix
+     * that tells it apart, instead of once per comparison.
+     */
+    template <typename It, typename Projection = Detail::IdentityProjection>
+        requires Detail::RadixStringKey<Detail::ProjectedType<
+            Projection, typename IteratorTraits<It>::ValueType>>
+    void RadixSort(It first, It last, Projection proj = {})
+    {
+        Detail::AmericanFlagSort(first, last, 0, proj);
+    }
+
+    /**
+     * @brief Sorts [first, last) by the key @p proj returns.
+     *
+     * Integer keys are radix sorted, byte string keys American flag
+     * sorted; any other key, or an integer key without memory for the radix
+     * sort's copy, is compared with operator<.
+     */
+    template <typename It, typename Projection>
+        requires Detail::SortProjection<Projection,
+                                        typename IteratorTraits<It>::ValueType>
+    void Sort(It first, It last, Projection proj)
+    {
+        using KeyType
+            = Detail::ProjectedType<Projection,
+                                    typename IteratorTraits<It>::ValueType>;
+        auto byKey = [&proj](const auto& lhs, const auto& rhs)
+        { return proj(lhs) < proj(rhs); };
+
+        if constexpr (Detail::RadixIntegerKey<KeyType>)
+        {
+            if (last - first < Detail::RADIX_SORT_THRESHOLD
+                || !Detail::RadixSortAllocating(first, last, proj))
+                Sort(first, last, byKey);
+        }
+        else if constexpr (Detail::RadixStringKey<KeyType>)
+            RadixSort(first, last, proj);
+        else Sort(first, last, byKey);
     }
 }; // namespace Prism
 
@@ -204,5 +1595,8 @@ using Prism::InsertionSort;
 using Prism::IntroSort;
 using Prism::MergeSort;
 using Prism::QuickSort;
+using Prism::RadixSort;
 using Prism::Sort;
+using Prism::StableSort;
+using Prism::StableSortInPlace;
 #endif
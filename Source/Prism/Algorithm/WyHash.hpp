@@ -0,0 +1,382 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Core/Bits.hpp>
+#include <Prism/Core/Types.hpp>
+#include <Prism/Memory/Memory.hpp>
+
+#if PRISM_TARGET_CRYPTIX == 0                                                  \
+    && (PRISM_SIMD_SSE2_PRESENT || PRISM_SIMD_NEON_PRESENT)
+    #include <Prism/Utility/SimdIntrinsics.hpp>
+    #define PRISM_WYHASH_SIMD 1
+#else
+    #define PRISM_WYHASH_SIMD 0
+#endif
+
+namespace Prism
+{
+    /**
+     * @brief A fast, high-quality 64-bit hash for strings and byte buffers.
+     *
+     * Inputs up to LONG_INPUT bytes are hashed exactly as wyhash (final
+     * version 4) does: a few overlapping word loads folded together with
+     * 64x64->128 bit multiplies. Longer inputs are consumed the way XXH3
+     * consumes them, in 64-byte stripes feeding eight independent
+     * accumulators with 32x32->64 bit multiplies, which map directly onto
+     * SSE2 and NEON lanes. The two halves use their own keys, so hashes are
+     * not interchangeable with either reference implementation.
+     *
+     * Everything is constexpr, so hashes of keys known at compile time
+     * cost nothing at runtime. Bytes are read in little-endian order on
+     * every target, so a hash does not depend on the host.
+     */
+    namespace WyHash
+    {
+        /// Inputs longer than this take the striped bulk path
+        inline constexpr usize LONG_INPUT = 512;
+
+        namespace Detail
+        {
+            inline constexpr u64 SECRET[4] = {
+                0x2d35'8dcc'aa6c'78a5zu,
+                0x8bb8'4b93'962e'acc9zu,
+                0x4b33'a62e'd433'd4a3zu,
+                0x4d5a'2da5'1de1'aa47zu,
+            };
+
+            /// Replaces @p a and @p b with the low and high half of a * b
+            PM_ALWAYS_INLINE constexpr void Multiply(u64& a, u64& b)
+            {
+#ifdef __SIZEOF_INT128__
+                unsigned __int128 product = a;
+                product *= b;
+
+                a = static_cast<u64>(product);
+                b = static_cast<u64>(product >> 64);
+#else
+                u64 ha = a >> 32, hb = b >> 32;
+                u64 la = static_cast<u32>(a), lb = static_cast<u32>(b);
+                u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+                u64 t  = rl + (rm0 << 32);
+                u64 c  = t < rl;
+                u64 lo = t + (rm1 << 32);
+                c += lo < t;
+
+                a = lo;
+                b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+            }
+            PM_ALWAYS_INLINE constexpr u64 Mix(u64 a, u64 b)
+            {
+                Multiply(a, b);
+                return a ^ b;
+            }
+
+            // The loads take any code unit type; wider units are read as
+            // their little-endian bytes
+            template <typename T>
+            PM_ALWAYS_INLINE constexpr u64 ByteAt(const T* data, usize offset)
+            {
+                auto unit = static_cast<u64>(data[offset / sizeof(T)]);
+                return static_cast<u8>(unit >> (offset % sizeof(T) * 8));
+            }
+            template <typename Word, typename T>
+            PM_ALWAYS_INLINE constexpr u64 Read(const T* data, usize offset)
+            {
+                if (!IsConstantEvaluated())
+                {
+                    Word word = Memory::LoadUnaligned<Word>(
+                        reinterpret_cast<const u8*>(data) + offset);
+                    if constexpr (Endian::eNative != Endian::eLittle)
+                        word = ByteSwap(word);
+
+                    return word;
+                }
+
+                u64 word = 0;
+                for (usize i = 0; i < sizeof(Word); ++i)
+                    word |= ByteAt(data, offset + i) << (i * 8);
+
+                return word;
+            }
+            template <typename T>
+            PM_ALWAYS_INLINE constexpr u64 Read8(const T* data, usize offset)
+            {
+                return Read<u64>(data, offset);
+            }
+            template <typename T>
+            PM_ALWAYS_INLINE constexpr u64 Read4(const T* data, usize offset)
+            {
+                return Read<u32>(data, offset);
+            }
+            // One to three bytes: the first, the middle and the last one
+            template <typename T>
+            PM_ALWAYS_INLINE constexpr u64 Read3(const T* data, usize size)
+            {
+                return ByteAt(data, 0) << 16 | ByteAt(data, size >> 1) << 8
+                     | ByteAt(data, size - 1);
+            }
+
+            template <typename T>
+            constexpr u64 HashShort(const T* data, usize size, u64 seed)
+            {
+                seed ^= Mix(seed ^ SECRET[0], SECRET[1]);
+
+                u64 a = 0, b = 0;
+                if (size <= 16)
+                {
+                    if (size >= 4)
+                    {
+                        usize middle = (size >> 3) << 2;
+                        a = Read4(data, 0) << 32 | Read4(data, middle);
+                        b = Read4(data, size - 4) << 32
+                          | Read4(data, size - 4 - middle);
+                    }
+                    else if (size > 0) a = Read3(data, size);
+                }
+                else
+                {
+                    usize offset = 0, remaining = size;
+                    if (remaining >= 48)
+                    {
+                        u64 see1 = seed, see2 = seed;
+                        do {
+                            seed = Mix(Read8(data, offset) ^ SECRET[1],
+                                       Read8(data, offset + 8) ^ seed);
+                            see1 = Mix(Read8(data, offset + 16) ^ SECRET[2],
+                                       Read8(data, offset + 24) ^ see1);
+                            see2 = Mix(Read8(data, offset + 32) ^ SECRET[3],
+                                       Read8(data, offset + 40) ^ see2);
+                            offset += 48;
+                            remaining -= 48;
+                        } while (remaining >= 48);
+                        seed ^= see1 ^ see2;
+                    }
+                    while (remaining > 16)
+                    {
+                        seed = Mix(Read8(data, offset) ^ SECRET[1],
+                                   Read8(data, offset + 8) ^ seed);
+                        offset += 16;
+                        remaining -= 16;
+                    }
+
+                    a = Read8(data, offset + remaining - 16);
+                    b = Read8(data, offset + remaining - 8);
+                }
+
+                a ^= SECRET[1];
+                b ^= seed;
+                Multiply(a, b);
+
+                return Mix(a ^ SECRET[0] ^ size, b ^ SECRET[1]);
+            }
+
+            inline constexpr usize STRIPE_SIZE       = 64;
+            inline constexpr usize LANE_COUNT        = 8;
+            inline constexpr usize STRIPES_PER_BLOCK = 16;
+            inline constexpr usize BLOCK_SIZE = STRIPE_SIZE * STRIPES_PER_BLOCK;
+            // Stripe s is keyed with KEYS[s, s + 8), the scramble at the end
+            // of a block with the last eight
+            inline constexpr usize KEY_COUNT = STRIPES_PER_BLOCK + LANE_COUNT;
+
+            inline constexpr u32   PRIME32_1 = 0x9e37'79b1;
+            inline constexpr u64   PRIME64_1 = 0x9e37'79b1'85eb'ca87zu;
+
+            struct KeyTable
+            {
+                u64 Keys[KEY_COUNT];
+            };
+            // Key material from SplitMix64, whose outputs are well spread
+            consteval KeyTable MakeKeys()
+            {
+                KeyTable table{};
+                u64      state = 0x243f'6a88'85a3'08d3zu;
+                for (usize i = 0; i < KEY_COUNT; ++i)
+                {
+                    u64 z = (state += 0x9e37'79b9'7f4a'7c15zu);
+                    z     = (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9zu;
+                    z     = (z ^ (z >> 27)) * 0x94d0'49bb'1331'11ebzu;
+                    table.Keys[i] = z ^ (z >> 31);
+                }
+
+                return table;
+            }
+            inline constexpr KeyTable KEYS = MakeKeys();
+
+            template <typename T>
+            PM_ALWAYS_INLINE constexpr void
+            AccumulateScalar(u64* acc, const T* data, usize offset,
+                             const u64* keys)
+            {
+                for (usize i = 0; i < LANE_COUNT; ++i)
+                {
+                    u64 word  = Read8(data, offset + i * 8);
+                    u64 keyed = word ^ keys[i];
+
+                    acc[i ^ 1] += word;
+                    acc[i] += static_cast<u32>(keyed) * (keyed >> 32);
+                }
+            }
+            PM_ALWAYS_INLINE constexpr void ScrambleScalar(u64*       acc,
+                                                           const u64* keys)
+            {
+                for (usize i = 0; i < LANE_COUNT; ++i)
+                {
+                    u64 lane = acc[i];
+                    lane ^= lane >> 47;
+                    lane ^= keys[i];
+                    acc[i] = lane * PRIME32_1;
+                }
+            }
+
+#if PRISM_WYHASH_SIMD
+            // The same lane operations, two lanes per vector
+            PM_ALWAYS_INLINE u64x2 MultiplyLow32(u64x2 a, u64x2 b)
+            {
+    #if PRISM_SIMD_SSE2_PRESENT
+                return BitCast<u64x2>(
+                    _mm_mul_epu32(BitCast<__m128i>(a), BitCast<__m128i>(b)));
+    #else
+                return BitCast<u64x2>(
+                    vmull_u32(vmovn_u64(BitCast<uint64x2_t>(a)),
+                              vmovn_u64(BitCast<uint64x2_t>(b))));
+    #endif
+            }
+            PM_ALWAYS_INLINE void AccumulateSimd(u64x2* acc, const u8* data,
+                                                 const u64* keys)
+            {
+                for (usize i = 0; i < LANE_COUNT / 2; ++i)
+                {
+                    auto word = Memory::LoadUnaligned<u64x2>(data + i * 16);
+                    auto keyed
+                        = word ^ Memory::LoadUnaligned<u64x2>(keys + i * 2);
+
+                    acc[i] += __builtin_shufflevector(word, word, 1, 0);
+                    acc[i] += MultiplyLow32(keyed, keyed >> 32);
+                }
+            }
+            PM_ALWAYS_INLINE void ScrambleSimd(u64x2* acc, const u64* keys)
+            {
+                const u64x2 prime = u64x2{} + PRIME32_1;
+                for (usize i = 0; i < LANE_COUNT / 2; ++i)
+                {
+                    u64x2 lane = acc[i];
+                    lane ^= lane >> 47;
+                    lane ^= Memory::LoadUnaligned<u64x2>(keys + i * 2);
+                    acc[i] = MultiplyLow32(lane, prime)
+                           + (MultiplyLow32(lane >> 32, prime) << 32);
+                }
+            }
+#endif
+
+            template <typename T>
+            constexpr u64 HashLong(const T* data, usize size, u64 seed)
+            {
+                u64 acc[LANE_COUNT] = {
+                    0xc2b2'ae3d,
+                    0x9e37'79b1'85eb'ca87zu,
+                    0xc2b2'ae3d'27d4'eb4fzu,
+                    0x1656'67b1'9e37'79f9zu,
+                    0x85eb'ca77'c2b2'ae63zu,
+                    0x85eb'ca77,
+                    0x27d4'eb2f'1656'67c5zu,
+                    0x9e37'79b1,
+                };
+                // Seeding the keys rather than the accumulators keeps the
+                // seed in every multiply
+                u64 keys[KEY_COUNT];
+                for (usize i = 0; i < KEY_COUNT; ++i)
+                    keys[i] = KEYS.Keys[i] + (i & 1 ? -seed : seed);
+
+                const usize blockCount = (size - 1) / BLOCK_SIZE;
+                const usize tailStripes
+                    = (size - 1 - blockCount * BLOCK_SIZE) / STRIPE_SIZE;
+                const u64* scrambleKeys = keys + STRIPES_PER_BLOCK;
+
+#if PRISM_WYHASH_SIMD
+                if (!IsConstantEvaluated())
+                {
+                    auto  bytes = reinterpret_cast<const u8*>(data);
+                    u64x2 lanes[LANE_COUNT / 2];
+                    Memory::Copy(lanes, acc, sizeof(acc));
+
+                    usize offset = 0;
+                    for (usize block = 0; block < blockCount; ++block)
+                    {
+                        for (usize s = 0; s < STRIPES_PER_BLOCK; ++s)
+                            AccumulateSimd(lanes, bytes + offset
+                                                      + s * STRIPE_SIZE,
+                                           keys + s);
+                        ScrambleSimd(lanes, scrambleKeys);
+                        offset += BLOCK_SIZE;
+                    }
+                    for (usize s = 0; s < tailStripes; ++s)
+                        AccumulateSimd(lanes, bytes + offset + s * STRIPE_SIZE,
+                                       keys + s);
+                    AccumulateSimd(lanes, bytes + size - STRIPE_SIZE,
+                                   keys + LANE_COUNT - 1);
+
+                    Memory::Copy(acc, lanes, sizeof(acc));
+                }
+                else
+#endif
+                {
+                    usize offset = 0;
+                    for (usize block = 0; block < blockCount; ++block)
+                    {
+                        for (usize s = 0; s < STRIPES_PER_BLOCK; ++s)
+                            AccumulateScalar(acc, data,
+                                             offset + s * STRIPE_SIZE,
+                                             keys + s);
+                        ScrambleScalar(acc, scrambleKeys);
+                        offset += BLOCK_SIZE;
+                    }
+                    for (usize s = 0; s < tailStripes; ++s)
+                        AccumulateScalar(acc, data, offset + s * STRIPE_SIZE,
+                                         keys + s);
+                    AccumulateScalar(acc, data, size - STRIPE_SIZE,
+                                     keys + LANE_COUNT - 1);
+                }
+
+                u64 result = size * PRIME64_1 ^ seed;
+                for (usize i = 0; i < LANE_COUNT / 2; ++i)
+                    result += Mix(acc[2 * i] ^ keys[2 * i + 1],
+                                  acc[2 * i + 1] ^ keys[2 * i + 2]);
+
+                // XXH3's avalanche
+                result ^= result >> 37;
+                result *= 0x1656'6791'9e37'79f9zu;
+                return result ^ (result >> 32);
+            }
+        }; // namespace Detail
+
+        /**
+         * @brief Hashes the @p size code units at @p data.
+         *
+         * Code units wider than a byte are hashed as their little-endian
+         * bytes, so e.g. a UTF-16 string and its raw bytes hash the same.
+         */
+        template <typename T>
+            requires(IsIntegralV<T>)
+        constexpr u64 Hash(const T* data, usize size, u64 seed = 0)
+        {
+            usize bytes = size * sizeof(T);
+            if (bytes > LONG_INPUT) return Detail::HashLong(data, bytes, seed);
+
+            return Detail::HashShort(data, bytes, seed);
+        }
+        inline u64 Hash(const void* data, usize size, u64 seed = 0)
+        {
+            return Hash(static_cast<const u8*>(data), size, seed);
+        }
+    }; // namespace WyHash
+}; // namespace Prism
+
+#if PRISM_TARGET_CRYPTIX != 0
+namespace WyHash = Prism::WyHash;
+#endif
@@ -0,0 +1,448 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Algorithm/Find.hpp>
+#include <Prism/Containers/KeyValuePair.hpp>
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/Core/Core.hpp>
+#include <Prism/Core/Iterator.hpp>
+#include <Prism/Core/Types.hpp>
+#include <Prism/Utility/Compare.hpp>
+
+namespace Prism
+{
+    namespace Detail
+    {
+        /// Bytes of keys one B+tree node holds: four cache lines
+        constexpr usize BTREE_NODE_KEY_BYTES = 256;
+
+        template <typename K>
+        constexpr usize BTreeCapacity()
+        {
+            usize capacity = BTREE_NODE_KEY_BYTES / sizeof(K);
+            return capacity < 4 ? 4 : capacity;
+        }
+
+        /**
+         * @brief Index of the first of the @p count sorted keys at @p keys
+         * not ordered before @p key, or, if @p Upper, ordered after it.
+         *
+         * A node spans only a few cache lines, which the first probes pull
+         * in together, so the search is bound by its dependent comparisons;
+         * without branches, none of them is mispredicted.
+         */
+        template <bool Upper, typename K, typename Compare>
+        PM_ALWAYS_INLINE usize BTreeRank(const K* keys, usize count,
+                                         const K& key, const Compare& comp)
+        {
+            auto before = [&](const K& other)
+            {
+                if constexpr (Upper) return !comp(key, other);
+                else return comp(other, key);
+            };
+            return BranchlessPartitionPoint(keys, count, before) - keys;
+        }
+
+        struct BTreeEmptyValue
+        {
+        };
+    }; // namespace Detail
+
+    template <typename K, typename Compare>
+    class BTreeSet;
+
+    /**
+     * @brief Ordered map kept in a B+tree whose nodes hold a few cache
+     * lines of keys each.
+     *
+     * Keys sit contiguously in every node and are searched without
+     * branches, so a lookup costs one short scan per level instead of a
+     * pointer chase per comparison; with 64 bit keys the tree is a quarter
+     * as deep as a red-black tree over the same keys and allocates once
+     * per 16 to 32 entries. All entries live in the leaves, which are
+     * linked in key order for range iteration.
+     *
+     * Offers the RedBlackTree interface plus bounds and a linear time bulk
+     * load, which also makes copies. Keys and values have to be default constructible and movable;
+     * insertions and erasures invalidate iterators.
+     */
+    template <typename K, typename V, typename Compare = Less<K>>
+    class BTree
+    {
+        struct Node;
+        struct Leaf;
+        struct Inner;
+
+      public:
+        using KeyType                        = K;
+        using ValueType                      = V;
+
+        /// Entries per leaf, and separator keys per inner node
+        static constexpr usize LEAF_CAPACITY  = Detail::BTreeCapacity<K>();
+        static constexpr usize INNER_CAPACITY = Detail::BTreeCapacity<K>();
+
+        template <bool IsConst>
+        struct EntryReference
+        {
+            const K&                               Key;
+            ConditionalType<IsConst, const V&, V&> Value;
+        };
+
+        template <bool IsConst>
+        class BaseIterator
+        {
+          public:
+            using Reference = EntryReference<IsConst>;
+            struct Arrow
+            {
+                Reference  Entry;
+                Reference* operator->() { return &Entry; }
+            };
+            using ValueType        = Reference;
+            using DifferenceType   = isize;
+            using Pointer          = Arrow;
+            using IteratorCategory = BidirectionalIteratorTag;
+
+            BaseIterator() = default;
+            template <bool OtherIsConst>
+                requires(IsConst && !OtherIsConst)
+            BaseIterator(const BaseIterator<OtherIsConst>& other)
+                : m_Tree(other.m_Tree)
+                , m_Leaf(other.m_Leaf)
+                , m_Index(other.m_Index)
+            {
+            }
+
+            bool operator==(const BaseIterator& other) const
+            {
+                return m_Leaf == other.m_Leaf && m_Index == other.m_Index;
+            }
+            bool operator!=(const BaseIterator& other) const
+            {
+                return !(*this == other);
+            }
+
+            BaseIterator& operator++()
+            {
+                if (++m_Index == m_Leaf->Count)
+                {
+                    m_Leaf  = m_Leaf->Next;
+                    m_Index = 0;
+                }
+
+                return *this;
+            }
+            BaseIterator operator++(int)
+            {
+                BaseIterator copy = *this;
+                ++*this;
+                return copy;
+            }
+            BaseIterator& operator--()
+            {
+                if (!m_Leaf || m_Index == 0)
+                {
+                    m_Leaf  = m_Leaf ? m_Leaf->Previous : m_Tree->m_Last;
+                    m_Index = m_Leaf->Count;
+                }
+
+                --m_Index;
+                return *this;
+            }
+            BaseIterator operator--(int)
+            {
+                BaseIterator copy = *this;
+                --*this;
+                return copy;
+            }
+
+            Reference operator*() const
+            {
+                return {m_Leaf->Keys[m_Index], m_Leaf->Values[m_Index]};
+            }
+            Arrow operator->() const { return {**this}; }
+
+          private:
+            using TreeType = ConditionalType<IsConst, const BTree, BTree>;
+
+            BaseIterator(TreeType* tree, Leaf* leaf, usize index)
+                : m_Tree(tree)
+                , m_Leaf(leaf)
+                , m_Index(index)
+            {
+            }
+
+            friend BTree;
+            friend BaseIterator<!IsConst>;
+
+            TreeType* m_Tree  = nullptr;
+            /// nullptr past the last entry
+            Leaf*     m_Leaf  = nullptr;
+            usize     m_Index = 0;
+        };
+
+        using Iterator      = BaseIterator<false>;
+        using ConstIterator = BaseIterator<true>;
+
+        BTree()             = default;
+        explicit BTree(const Compare& comp)
+            : m_Compare(comp)
+        {
+        }
+        BTree(const BTree& other);
+        BTree(BTree&& other);
+        ~BTree();
+
+        BTree&        operator=(const BTree& other);
+        BTree&        operator=(BTree&& other);
+
+        V&            At(const K& key);
+        const V&      At(const K& key) const;
+
+        V&            operator[](const K& key);
+        V&            operator[](K&& key);
+
+        Iterator      begin() { return Iterator(this, m_First, 0); }
+        ConstIterator begin() const { return ConstIterator(this, m_First, 0); }
+        Iterator      end() { return Iterator(this, nullptr, 0); }
+        ConstIterator end() const { return ConstIterator(this, nullptr, 0); }
+
+        Prism::ReverseIterator<Iterator> rbegin()
+        {
+            return Prism::ReverseIterator<Iterator>(end());
+        }
+        Prism::ReverseIterator<ConstIterator> rbegin() const
+        {
+            return Prism::ReverseIterator<ConstIterator>(end());
+        }
+        Prism::ReverseIterator<Iterator> rend()
+        {
+            return Prism::ReverseIterator<Iterator>(begin());
+        }
+        Prism::ReverseIterator<ConstIterator> rend() const
+        {
+            return Prism::ReverseIterator<ConstIterator>(begin());
+        }
+
+        constexpr bool  IsEmpty() const { return m_Size == 0; }
+        constexpr usize GetSize() const { return m_Size; }
+
+        void            Clear();
+        /// Inserts @p key, or assigns @p value to it if it exists
+        Iterator        Insert(K key, V& value);
+        /// @copydoc Insert(K, V&)
+        Iterator        Insert(K key, V&& value);
+        bool            Erase(const K& key);
+
+        /**
+         * @brief Replaces the contents with the entries of [first, last),
+         * whose Key and Value members are taken in strictly increasing key
+         * order, in O(n).
+         *
+         * Leaves are filled evenly and as far as they go, which suits
+         * tables that are rebuilt more often than they are modified.
+         */
+        template <typename It>
+        void          BuildFromSorted(It first, It last);
+
+        /// The entry with the greatest key not above @p key, or end()
+        Iterator      FindLargestNotAbove(const K& key);
+        Iterator      Find(const K& key);
+        ConstIterator Find(const K& key) const;
+        /// The first entry whose key is not ordered before @p key
+        Iterator      LowerBound(const K& key);
+        ConstIterator LowerBound(const K& key) const;
+        /// The first entry whose key is ordered after @p key
+        Iterator      UpperBound(const K& key);
+        ConstIterator UpperBound(const K& key) const;
+
+        bool          Contains(const K& key) const;
+
+      private:
+        static constexpr usize MIN_LEAF  = LEAF_CAPACITY / 2;
+        static constexpr usize MIN_INNER = (INNER_CAPACITY - 1) / 2;
+
+        struct Node
+        {
+            u32  Count  = 0;
+            bool IsLeaf = false;
+        };
+        struct Leaf : Node
+        {
+            K     Keys[LEAF_CAPACITY];
+            V     Values[LEAF_CAPACITY];
+            Leaf* Previous = nullptr;
+            Leaf* Next     = nullptr;
+
+            Leaf() { this->IsLeaf = true; }
+        };
+        struct Inner : Node
+        {
+            /// All keys under Children[i] are ordered before Keys[i], and
+            /// all under Children[i + 1] are not
+            K     Keys[INNER_CAPACITY];
+            Node* Children[INNER_CAPACITY + 1];
+        };
+
+        Node*                        m_Root    = nullptr;
+        Leaf*                        m_First   = nullptr;
+        Leaf*                        m_Last    = nullptr;
+        usize                        m_Size    = 0;
+        PM_NO_UNIQUE_ADDRESS Compare m_Compare = Compare{};
+
+        friend class BTreeSet<K, Compare>;
+
+        usize LowerRank(const K* keys, usize count, const K& key) const
+        {
+            return Detail::BTreeRank<false>(keys, count, key, m_Compare);
+        }
+        usize UpperRank(const K* keys, usize count, const K& key) const
+        {
+            return Detail::BTreeRank<true>(keys, count, key, m_Compare);
+        }
+
+        Leaf*                 FindLeaf(const K& key) const;
+        /// Iterator to slot @p index of @p leaf, or past its end
+        template <typename Self>
+        static auto           MakeIterator(Self* tree, Leaf* leaf, usize index);
+
+        template <typename Value>
+        Iterator              InsertOrAssign(K&& key, Value&& value);
+        bool                  IsFull(const Node* node) const;
+        void                  SplitChild(Inner* parent, usize index);
+
+        usize                 FixChild(Inner* parent, usize index);
+        void                  BorrowFromLeft(Inner* parent, usize index);
+        void                  BorrowFromRight(Inner* parent, usize index);
+        void                  MergeChildren(Inner* parent, usize index);
+
+        template <typename It, typename KeyOf, typename ValueOf>
+        void Build(It first, It last, KeyOf keyOf, ValueOf valueOf);
+
+        static void           Destroy(Node* node);
+    };
+
+    /**
+     * @brief Ordered set kept in a B+tree; see BTree.
+     */
+    template <typename K, typename Compare = Less<K>>
+    class BTreeSet
+    {
+        using TreeType = BTree<K, Detail::BTreeEmptyValue, Compare>;
+
+      public:
+        using KeyType   = K;
+        using ValueType = K;
+
+        class Iterator
+        {
+          public:
+            using ValueType        = K;
+            using DifferenceType   = isize;
+            using Pointer          = const K*;
+            using Reference        = const K&;
+            using IteratorCategory = BidirectionalIteratorTag;
+
+            Iterator() = default;
+
+            bool operator==(const Iterator& other) const
+            {
+                return m_It == other.m_It;
+            }
+            bool operator!=(const Iterator& other) const
+            {
+                return m_It != other.m_It;
+            }
+
+            Iterator& operator++()
+            {
+                ++m_It;
+                return *this;
+            }
+            Iterator& operator--()
+            {
+                --m_It;
+                return *this;
+            }
+
+            const K& operator*() const { return (*m_It).Key; }
+            const K* operator->() const { return &(*m_It).Key; }
+
+          private:
+            explicit Iterator(typename TreeType::ConstIterator it)
+                : m_It(it)
+            {
+            }
+
+            friend BTreeSet;
+            typename TreeType::ConstIterator m_It;
+        };
+        using ConstIterator = Iterator;
+
+        BTreeSet()          = default;
+        explicit BTreeSet(const Compare& comp)
+            : m_Tree(comp)
+        {
+        }
+
+        bool     IsEmpty() const { return m_Tree.IsEmpty(); }
+        usize    GetSize() const { return m_Tree.GetSize(); }
+        void     Clear() { m_Tree.Clear(); }
+
+        Iterator begin() const { return Iterator(m_Tree.begin()); }
+        Iterator end() const { return Iterator(m_Tree.end()); }
+        Prism::ReverseIterator<Iterator> rbegin() const
+        {
+            return Prism::ReverseIterator<Iterator>(end());
+        }
+        Prism::ReverseIterator<Iterator> rend() const
+        {
+            return Prism::ReverseIterator<Iterator>(begin());
+        }
+
+        KeyValuePair<Iterator, bool> Insert(const K& key)
+        {
+            usize size = m_Tree.GetSize();
+            auto  it   = m_Tree.Insert(key, Detail::BTreeEmptyValue{});
+            return {Iterator(it), m_Tree.GetSize() != size};
+        }
+        usize    Erase(const K& key) { return m_Tree.Erase(key) ? 1 : 0; }
+
+        /// Replaces the contents with the strictly increasing [first, last)
+        template <typename It>
+        void BuildFromSorted(It first, It last)
+        {
+            m_Tree.Build(
+                first, last, [](const K& key) -> const K& { return key; },
+                [](const K&) { return Detail::BTreeEmptyValue{}; });
+        }
+
+        Iterator Find(const K& key) const { return Iterator(m_Tree.Find(key)); }
+        bool     Contains(const K& key) const { return m_Tree.Contains(key); }
+        usize    Count(const K& key) const { return Contains(key) ? 1 : 0; }
+
+        Iterator LowerBound(const K& key) const
+        {
+            return Iterator(m_Tree.LowerBound(key));
+        }
+        Iterator UpperBound(const K& key) const
+        {
+            return Iterator(m_Tree.UpperBound(key));
+        }
+
+      private:
+        TreeType m_Tree;
+    };
+}; // namespace Prism
+
+#if PRISM_USE_NAMESPACE != 0
+using Prism::BTree;
+using Prism::BTreeSet;
+#endif
+
+#include <Prism/Containers/BTree.inl>
@@ -0,0 +1,590 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/BTree.hpp> // NOLINT(misc-header-include-cycle)
+
+namespace Prism
+{
+    namespace Detail
+    {
+        /// Moves [index, count) of @p data one slot up
+        template <typename T>
+        constexpr void BTreeOpenSlot(T* data, usize index, usize count)
+        {
+            for (usize i = count; i > index; --i) data[i] = Move(data[i - 1]);
+        }
+        /// Moves (index, count) of @p data one slot down
+        template <typename T>
+        constexpr void BTreeCloseSlot(T* data, usize index, usize count)
+        {
+            for (usize i = index + 1; i < count; ++i)
+                data[i - 1] = Move(data[i]);
+        }
+    }; // namespace Detail
+
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::BTree(const BTree& other)
+        : m_Compare(other.m_Compare)
+    {
+        BuildFromSorted(other.begin(), other.end());
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::BTree(BTree&& other)
+        : m_Root(other.m_Root)
+        , m_First(other.m_First)
+        , m_Last(other.m_Last)
+        , m_Size(other.m_Size)
+        , m_Compare(Move(other.m_Compare))
+    {
+        other.m_Root  = nullptr;
+        other.m_First = other.m_Last = nullptr;
+        other.m_Size  = 0;
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::~BTree()
+    {
+        Clear();
+    }
+
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>& BTree<K, V, Compare>::operator=(const BTree& other)
+    {
+        if (this == &other) return *this;
+
+        m_Compare = other.m_Compare;
+        BuildFromSorted(other.begin(), other.end());
+        return *this;
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>& BTree<K, V, Compare>::operator=(BTree&& other)
+    {
+        if (this == &other) return *this;
+        Clear();
+
+        m_Root        = other.m_Root;
+        m_First       = other.m_First;
+        m_Last        = other.m_Last;
+        m_Size        = other.m_Size;
+        m_Compare     = Move(other.m_Compare);
+
+        other.m_Root  = nullptr;
+        other.m_First = other.m_Last = nullptr;
+        other.m_Size  = 0;
+        return *this;
+    }
+
+    template <typename K, typename V, typename Compare>
+    V& BTree<K, V, Compare>::At(const K& key)
+    {
+        auto it = Find(key);
+        assert(it != end());
+
+        return it->Value;
+    }
+    template <typename K, typename V, typename Compare>
+    const V& BTree<K, V, Compare>::At(const K& key) const
+    {
+        auto it = Find(key);
+        assert(it != end());
+
+        return it->Value;
+    }
+
+    template <typename K, typename V, typename Compare>
+    V& BTree<K, V, Compare>::operator[](const K& key)
+    {
+        auto it = Find(key);
+        if (it != end()) return it->Value;
+
+        return InsertOrAssign(K(key), V())->Value;
+    }
+    template <typename K, typename V, typename Compare>
+    V& BTree<K, V, Compare>::operator[](K&& key)
+    {
+        auto it = Find(key);
+        if (it != end()) return it->Value;
+
+        return InsertOrAssign(Move(key), V())->Value;
+    }
+
+    template <typename K, typename V, typename Compare>
+    void BTree<K, V, Compare>::Clear()
+    {
+        if (m_Root) Destroy(m_Root);
+
+        m_Root  = nullptr;
+        m_First = m_Last = nullptr;
+        m_Size  = 0;
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Iterator BTree<K, V, Compare>::Insert(K key,
+                                                                V& value)
+    {
+        return InsertOrAssign(Move(key), value);
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Iterator BTree<K, V, Compare>::Insert(K    key,
+                                                                V&& value)
+    {
+        return InsertOrAssign(Move(key), Move(value));
+    }
+
+    template <typename K, typename V, typename Compare>
+    bool BTree<K, V, Compare>::Erase(const K& key)
+    {
+        if (!m_Root) return false;
+
+        // Tops up every node on the way down before entering it, so the
+        // leaf can lose an entry without anything above it underflowing
+        Node* node = m_Root;
+        while (!node->IsLeaf)
+        {
+            Inner* inner = static_cast<Inner*>(node);
+            usize  index = UpperRank(inner->Keys, inner->Count, key);
+            node         = inner->Children[FixChild(inner, index)];
+        }
+
+        Leaf* leaf  = static_cast<Leaf*>(node);
+        usize index = LowerRank(leaf->Keys, leaf->Count, key);
+        bool  found = index < leaf->Count && !m_Compare(key, leaf->Keys[index]);
+        if (found)
+        {
+            Detail::BTreeCloseSlot(leaf->Keys, index, leaf->Count);
+            Detail::BTreeCloseSlot(leaf->Values, index, leaf->Count);
+            --leaf->Count;
+            --m_Size;
+        }
+
+        // Merging the last two children of the root leaves it empty
+        while (!m_Root->IsLeaf && m_Root->Count == 0)
+        {
+            Inner* root = static_cast<Inner*>(m_Root);
+            m_Root      = root->Children[0];
+            delete root;
+        }
+        if (m_Size == 0) Clear();
+
+        return found;
+    }
+
+    template <typename K, typename V, typename Compare>
+    template <typename It>
+    void BTree<K, V, Compare>::BuildFromSorted(It first, It last)
+    {
+        Build(
+            first, last,
+            [](const auto& entry) -> const K& { return entry.Key; },
+            [](const auto& entry) -> const V& { return entry.Value; });
+    }
+
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Iterator
+    BTree<K, V, Compare>::FindLargestNotAbove(const K& key)
+    {
+        auto it = UpperBound(key);
+        if (it == begin()) return end();
+
+        return --it;
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Iterator BTree<K, V, Compare>::Find(const K& key)
+    {
+        auto it = LowerBound(key);
+        if (it == end() || m_Compare(key, it->Key)) return end();
+
+        return it;
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::ConstIterator
+    BTree<K, V, Compare>::Find(const K& key) const
+    {
+        auto it = LowerBound(key);
+        if (it == end() || m_Compare(key, it->Key)) return end();
+
+        return it;
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Iterator
+    BTree<K, V, Compare>::LowerBound(const K& key)
+    {
+        if (!m_Root) return end();
+
+        Leaf* leaf = FindLeaf(key);
+        return MakeIterator(this, leaf,
+                            LowerRank(leaf->Keys, leaf->Count, key));
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::ConstIterator
+    BTree<K, V, Compare>::LowerBound(const K& key) const
+    {
+        if (!m_Root) return end();
+
+        Leaf* leaf = FindLeaf(key);
+        return MakeIterator(this, leaf,
+                            LowerRank(leaf->Keys, leaf->Count, key));
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Iterator
+    BTree<K, V, Compare>::UpperBound(const K& key)
+    {
+        if (!m_Root) return end();
+
+        Leaf* leaf = FindLeaf(key);
+        return MakeIterator(this, leaf,
+                            UpperRank(leaf->Keys, leaf->Count, key));
+    }
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::ConstIterator
+    BTree<K, V, Compare>::UpperBound(const K& key) const
+    {
+        if (!m_Root) return end();
+
+        Leaf* leaf = FindLeaf(key);
+        return MakeIterator(this, leaf,
+                            UpperRank(leaf->Keys, leaf->Count, key));
+    }
+
+    template <typename K, typename V, typename Compare>
+    bool BTree<K, V, Compare>::Contains(const K& key) const
+    {
+        return Find(key) != end();
+    }
+
+    template <typename K, typename V, typename Compare>
+    BTree<K, V, Compare>::Leaf*
+    BTree<K, V, Compare>::FindLeaf(const K& key) const
+    {
+        // Every separator not above the key routes one child further right
+        Node* node = m_Root;
+        while (!node->IsLeaf)
+        {
+            const Inner* inner = static_cast<const Inner*>(node);
+            node = inner->Children[UpperRank(inner->Keys, inner->Count, key)];
+        }
+
+        return static_cast<Leaf*>(node);
+    }
+    template <typename K, typename V, typename Compare>
+    template <typename Self>
+    auto BTree<K, V, Compare>::MakeIterator(Self* tree, Leaf* leaf,
+                                            usize index)
+    {
+        if (index == leaf->Count)
+        {
+            leaf  = leaf->Next;
+            index = 0;
+        }
+
+        return BaseIterator<IsSameV<Self, const BTree>>(tree, leaf,
+                                                          index);
+    }
+
+    template <typename K, typename V, typename Compare>
+    template <typename Value>
+    BTree<K, V, Compare>::Iterator
+    BTree<K, V, Compare>::InsertOrAssign(K&& key, Value&& value)
+    {
+        if (!m_Root) m_Root = m_First = m_Last = new Leaf;
+        if (IsFull(m_Root))
+        {
+            Inner* root       = new Inner;
+            root->Children[0] = m_Root;
+            m_Root            = root;
+            SplitChild(root, 0);
+        }
+
+        // Splits every full node on the way down before entering it, so the
+        // leaf always has room and a split never has to go back up
+        Node* node = m_Root;
+        while (!node->IsLeaf)
+        {
+            Inner* inner = static_cast<Inner*>(node);
+            usize  index = UpperRank(inner->Keys, inner->Count, key);
+            if (IsFull(inner->Children[index]))
+            {
+                SplitChild(inner, index);
+                if (!m_Compare(key, inner->Keys[index])) ++index;
+            }
+
+            node = inner->Children[index];
+        }
+
+        Leaf* leaf  = static_cast<Leaf*>(node);
+        usize index = LowerRank(leaf->Keys, leaf->Count, key);
+        if (index < leaf->Count && !m_Compare(key, leaf->Keys[index]))
+        {
+            leaf->Values[index] = Forward<Value>(value);
+            return Iterator(this, leaf, index);
+        }
+
+        Detail::BTreeOpenSlot(leaf->Keys, index, leaf->Count);
+        Detail::BTreeOpenSlot(leaf->Values, index, leaf->Count);
+        leaf->Keys[index]   = Move(key);
+        leaf->Values[index] = Forward<Value>(value);
+        ++leaf->Count;
+        ++m_Size;
+
+        return Iterator(this, leaf, index);
+    }
+    template <typename K, typename V, typename Compare>
+    bool BTree<K, V, Compare>::IsFull(const Node* node) const
+    {
+        return node->Count == (node->IsLeaf ? LEAF_CAPACITY : INNER_CAPACITY);
+    }
+    template <typename K, typename V, typename Compare>
+    void BTree<K, V, Compare>::SplitChild(Inner* parent, usize index)
+    {
+        Node* child = parent->Children[index];
+        Node* sibling;
+        K     separator;
+        if (child->IsLeaf)
+        {
+            Leaf* left  = static_cast<Leaf*>(child);
+            Leaf* right = new Leaf;
+            usize keep  = (LEAF_CAPACITY + 1) / 2;
+            for (usize i = keep; i < left->Count; ++i)
+            {
+                right->Keys[i - keep]   = Move(left->Keys[i]);
+                right->Values[i - keep] = Move(left->Values[i]);
+            }
+            right->Count    = left->Count - keep;
+            left->Count     = keep;
+
+            right->Previous = left;
+            right->Next     = left->Next;
+            if (left->Next) left->Next->Previous = right;
+            else m_Last = right;
+            left->Next = right;
+
+            // Leaves keep every key, so the separator is a copy
+            separator  = right->Keys[0];
+            sibling    = right;
+        }
+        else
+        {
+            Inner* left   = static_cast<Inner*>(child);
+            Inner* right  = new Inner;
+            usize  middle = INNER_CAPACITY / 2;
+            for (usize i = middle + 1; i < left->Count; ++i)
+                right->Keys[i - middle - 1] = Move(left->Keys[i]);
+            for (usize i = middle + 1; i <= left->Count; ++i)
+                right->Children[i - middle - 1] = left->Children[i];
+            right->Count = left->Count - middle - 1;
+            left->Count  = middle;
+
+            separator    = Move(left->Keys[middle]);
+            sibling      = right;
+        }
+
+        Detail::BTreeOpenSlot(parent->Keys, index, parent->Count);
+        Detail::BTreeOpenSlot(parent->Children, index + 1, parent->Count + 1);
+        parent->Keys[index]         = Move(separator);
+        parent->Children[index + 1] = sibling;
+        ++parent->Count;
+    }
+
+    template <typename K, typename V, typename Compare>
+    usize BTree<K, V, Compare>::FixChild(Inner* parent, usize index)
+    {
+        Node* child = parent->Children[index];
+        usize min   = child->IsLeaf ? MIN_LEAF : MIN_INNER;
+        if (child->Count > min) return index;
+
+        Node* left  = index > 0 ? parent->Children[index - 1] : nullptr;
+        Node* right = index < parent->Count ? parent->Children[index + 1]
+                                            : nullptr;
+        if (left && left->Count > min) BorrowFromLeft(parent, index);
+        else if (right && right->Count > min) BorrowFromRight(parent, index);
+        else if (right) MergeChildren(parent, index);
+        else MergeChildren(parent, --index);
+
+        return index;
+    }
+    template <typename K, typename V, typename Compare>
+    void BTree<K, V, Compare>::BorrowFromLeft(Inner* parent, usize index)
+    {
+        Node* child = parent->Children[index];
+        if (child->IsLeaf)
+        {
+            Leaf* to   = static_cast<Leaf*>(child);
+            Leaf* from = static_cast<Leaf*>(parent->Children[index - 1]);
+            Detail::BTreeOpenSlot(to->Keys, 0, to->Count);
+            Detail::BTreeOpenSlot(to->Values, 0, to->Count);
+            to->Keys[0]   = Move(from->Keys[from->Count - 1]);
+            to->Values[0] = Move(from->Values[from->Count - 1]);
+            parent->Keys[index - 1] = to->Keys[0];
+            --from->Count;
+            ++to->Count;
+            return;
+        }
+
+        // The separator comes down and the sibling's last key goes up
+        Inner* to   = static_cast<Inner*>(child);
+        Inner* from = static_cast<Inner*>(parent->Children[index - 1]);
+        Detail::BTreeOpenSlot(to->Keys, 0, to->Count);
+        Detail::BTreeOpenSlot(to->Children, 0, to->Count + 1);
+        to->Keys[0]             = Move(parent->Keys[index - 1]);
+        to->Children[0]         = from->Children[from->Count];
+        parent->Keys[index - 1] = Move(from->Keys[from->Count - 1]);
+        --from->Count;
+        ++to->Count;
+    }
+    template <typename K, typename V, typename Compare>
+    void BTree<K, V, Compare>::BorrowFromRight(Inner* parent, usize index)
+    {
+        Node* child = parent->Children[index];
+        if (child->IsLeaf)
+        {
+            Leaf* to   = static_cast<Leaf*>(child);
+            Leaf* from = static_cast<Leaf*>(parent->Children[index + 1]);
+            to->Keys[to->Count]   = Move(from->Keys[0]);
+            to->Values[to->Count] = Move(from->Values[0]);
+            Detail::BTreeCloseSlot(from->Keys, 0, from->Count);
+            Detail::BTreeCloseSlot(from->Values, 0, from->Count);
+            parent->Keys[index] = from->Keys[0];
+            --from->Count;
+            ++to->Count;
+            return;
+        }
+
+        Inner* to   = static_cast<Inner*>(child);
+        Inner* from = static_cast<Inner*>(parent->Children[index + 1]);
+        to->Keys[to->Count]         = Move(parent->Keys[index]);
+        to->Children[to->Count + 1] = from->Children[0];
+        parent->Keys[index]         = Move(from->Keys[0]);
+        Detail::BTreeCloseSlot(from->Keys, 0, from->Count);
+        Detail::BTreeCloseSlot(from->Children, 0, from->Count + 1);
+        --from->Count;
+        ++to->Count;
+    }
+    template <typename K, typename V, typename Compare>
+    void BTree<K, V, Compare>::MergeChildren(Inner* parent, usize index)
+    {
+        Node* child = parent->Children[index];
+        if (child->IsLeaf)
+        {
+            Leaf* to   = static_cast<Leaf*>(child);
+            Leaf* from = static_cast<Leaf*>(parent->Children[index + 1]);
+            for (usize i = 0; i < from->Count; ++i)
+            {
+                to->Keys[to->Count + i]   = Move(from->Keys[i]);
+                to->Values[to->Count + i] = Move(from->Values[i]);
+            }
+            to->Count += from->Count;
+
+            to->Next = from->Next;
+            if (from->Next) from->Next->Previous = to;
+            else m_Last = to;
+            delete from;
+        }
+        else
+        {
+            // The separator comes down between the two halves
+            Inner* to   = static_cast<Inner*>(child);
+            Inner* from = static_cast<Inner*>(parent->Children[index + 1]);
+            to->Keys[to->Count] = Move(parent->Keys[index]);
+            for (usize i = 0; i < from->Count; ++i)
+                to->Keys[to->Count + 1 + i] = Move(from->Keys[i]);
+            for (usize i = 0; i <= from->Count; ++i)
+                to->Children[to->Count + 1 + i] = from->Children[i];
+            to->Count += from->Count + 1;
+            delete from;
+        }
+
+        Detail::BTreeCloseSlot(parent->Keys, index, parent->Count);
+        Detail::BTreeCloseSlot(parent->Children, index + 1, parent->Count + 1);
+        --parent->Count;
+    }
+
+    template <typename K, typename V, typename Compare>
+    template <typename It, typename KeyOf, typename ValueOf>
+    void BTree<K, V, Compare>::Build(It first, It last, KeyOf keyOf,
+                                     ValueOf valueOf)
+    {
+        Clear();
+        usize count = 0;
+        for (It it = first; it != last; ++it) ++count;
+        if (count == 0) return;
+
+        // Spreading the entries evenly over as few leaves as hold them
+        // keeps every leaf above half full
+        Vector<Node*> level;
+        Vector<K>     minimums;
+        usize         leafCount = (count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+        Leaf*         previous  = nullptr;
+        for (usize i = 0; i < leafCount; ++i)
+        {
+            Leaf* leaf  = new Leaf;
+            leaf->Count = count / leafCount + (i < count % leafCount);
+            for (usize j = 0; j < leaf->Count; ++j, ++first)
+            {
+                leaf->Keys[j]   = keyOf(*first);
+                leaf->Values[j] = valueOf(*first);
+                assert((j == 0 && !previous)
+                       || m_Compare(j == 0 ? previous->Keys[previous->Count - 1]
+                                           : leaf->Keys[j - 1],
+                                    leaf->Keys[j]));
+            }
+
+            leaf->Previous = previous;
+            if (previous) previous->Next = leaf;
+            else m_First = leaf;
+            previous = leaf;
+
+            level.PushBack(leaf);
+            minimums.PushBack(leaf->Keys[0]);
+        }
+        m_Last = previous;
+        m_Size = count;
+
+        // Each level up is built the same way, a child's smallest key
+        // separating it from its left neighbour
+        while (level.Size() > 1)
+        {
+            Vector<Node*> parents;
+            Vector<K>     parentMinimums;
+            usize         children    = level.Size();
+            usize         parentCount
+                = (children + INNER_CAPACITY) / (INNER_CAPACITY + 1);
+            usize         next        = 0;
+            for (usize i = 0; i < parentCount; ++i)
+            {
+                Inner* inner = new Inner;
+                usize  size
+                    = children / parentCount + (i < children % parentCount);
+                for (usize j = 0; j < size; ++j)
+                {
+                    inner->Children[j] = level[next + j];
+                    if (j > 0) inner->Keys[j - 1] = Move(minimums[next + j]);
+                }
+                inner->Count = size - 1;
+
+                parents.PushBack(inner);
+                parentMinimums.PushBack(Move(minimums[next]));
+                next += size;
+            }
+
+            level    = Move(parents);
+            minimums = Move(parentMinimums);
+        }
+
+        m_Root = level[0];
+    }
+
+    template <typename K, typename V, typename Compare>
+    void BTree<K, V, Compare>::Destroy(Node* node)
+    {
+        if (node->IsLeaf)
+        {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+
+        Inner* inner = static_cast<Inner*>(node);
+        for (usize i = 0; i <= inner->Count; ++i) Destroy(inner->Children[i]);
+        delete inner;
+    }
+}; // namespace Prism
@@ -0,0 +1,220 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Core/Bits.hpp>
+#include <Prism/Core/Core.hpp>
+#include <Prism/Core/Iterator.hpp>
+#include <Prism/Core/Types.hpp>
+#include <Prism/Utility/Compare.hpp>
+
+namespace Prism
+{
+    /**
+     * @brief A read-only sorted set of values laid out in breadth first
+     * order of the implicit binary search tree over them (Eytzinger layout).
+     *
+     * Slot k holds the root of the subtree whose children sit in slots 2k
+     * and 2k + 1, so a search walks down from slot 1 touching the top of
+     * the tree, which stays in cache, and reads one cache line per level
+     * below it. The storage is cache line aligned, which puts all sixteen
+     * great-great-grandchildren of a 4 byte slot on one line; it is
+     * prefetched while the four levels above it are compared.
+     *
+     * Searches beat LowerBound on a sorted array once the array no longer
+     * fits in cache. The layout cannot be modified in place, so it suits
+     * tables built once and searched many times.
+     */
+    template <typename T, typename Compare = Less<>>
+    class EytzingerArray
+    {
+      public:
+        using ValueType = T;
+
+        EytzingerArray()
+            requires(IsDefaultConstructibleV<Compare>)
+        = default;
+        /**
+         * @brief Lays out the values of the sorted range [first, last).
+         */
+        template <typename It>
+        EytzingerArray(It first, It last, Compare comp = Compare{})
+            : m_Compare(comp)
+        {
+            Allocate(static_cast<usize>(Distance(first, last)));
+            ForEachSlot(
+                [&](usize k)
+                {
+                    ConstructAt(m_Data + k, *first);
+                    ++first;
+                });
+        }
+        EytzingerArray(const EytzingerArray& other)
+            : m_Compare(other.m_Compare)
+        {
+            Allocate(other.m_Size);
+            for (usize k = 1; k <= m_Size; ++k)
+                ConstructAt(m_Data + k, other.m_Data[k]);
+        }
+        EytzingerArray(EytzingerArray&& other)
+            : m_Storage(Exchange(other.m_Storage, nullptr))
+            , m_Data(Exchange(other.m_Data, nullptr))
+            , m_Size(Exchange(other.m_Size, 0))
+            , m_Compare(Move(other.m_Compare))
+        {
+        }
+        ~EytzingerArray() { Clear(); }
+
+        EytzingerArray& operator=(const EytzingerArray& other)
+        {
+            if (this == &other) return *this;
+            EytzingerArray copy(other);
+            return *this = Move(copy);
+        }
+        EytzingerArray& operator=(EytzingerArray&& other)
+        {
+            if (this == &other) return *this;
+            Clear();
+
+            m_Storage = Exchange(other.m_Storage, nullptr);
+            m_Data    = Exchange(other.m_Data, nullptr);
+            m_Size    = Exchange(other.m_Size, 0);
+            m_Compare = Move(other.m_Compare);
+            return *this;
+        }
+
+        constexpr usize Size() const { return m_Size; }
+        constexpr bool  Empty() const { return m_Size == 0; }
+
+        void            Clear()
+        {
+            for (usize k = 1; k <= m_Size; ++k) DestroyAt(m_Data + k);
+            if (m_Storage) ::operator delete(m_Storage);
+
+            m_Storage = nullptr;
+            m_Data    = nullptr;
+            m_Size    = 0;
+        }
+
+        /**
+         * @brief The smallest value not ordered before @p value, or nullptr.
+         */
+        template <typename U>
+        const T* LowerBound(const U& value) const
+        {
+            return Slot(Descend([&](const T& element)
+                                { return m_Compare(element, value); }));
+        }
+        /**
+         * @brief The smallest value ordered after @p value, or nullptr.
+         */
+        template <typename U>
+        const T* UpperBound(const U& value) const
+        {
+            return Slot(Descend([&](const T& element)
+                                { return !m_Compare(value, element); }));
+        }
+        /**
+         * @brief The value equivalent to @p value, or nullptr.
+         */
+        template <typename U>
+        const T* Find(const U& value) const
+        {
+            const T* found = LowerBound(value);
+            return found && !m_Compare(value, *found) ? found : nullptr;
+        }
+        template <typename U>
+        bool Contains(const U& value) const
+        {
+            return Find(value) != nullptr;
+        }
+
+        /**
+         * @brief Calls @p visitor with every value, in sorted order.
+         */
+        template <typename Visitor>
+        void ForEach(Visitor&& visitor) const
+        {
+            ForEachSlot([&](usize k) { visitor(m_Data[k]); });
+        }
+
+      private:
+        static constexpr usize CACHE_LINE_SIZE = 64;
+        /// How far below the current slot the prefetched line lies
+        static constexpr usize PREFETCH_STRIDE
+            = sizeof(T) <= CACHE_LINE_SIZE ? CACHE_LINE_SIZE / sizeof(T) : 0;
+
+        void*                  m_Storage       = nullptr;
+        /// Slot 0 is never constructed; the tree starts at m_Data[1]
+        T*                     m_Data          = nullptr;
+        usize                  m_Size          = 0;
+        PM_NO_UNIQUE_ADDRESS Compare m_Compare = Compare{};
+
+        void                   Allocate(usize size)
+        {
+            m_Size = size;
+            if (size == 0) return;
+
+            m_Storage = ::operator new((size + 1) * sizeof(T)
+                                       + CACHE_LINE_SIZE);
+            upointer aligned
+                = (reinterpret_cast<upointer>(m_Storage) + CACHE_LINE_SIZE - 1)
+                & ~(CACHE_LINE_SIZE - 1);
+            m_Data = reinterpret_cast<T*>(aligned);
+        }
+
+        /// Calls @p visitor with every slot index, in sorted order
+        template <typename Visitor>
+        void ForEachSlot(Visitor&& visitor) const
+        {
+            if (m_Size == 0) return;
+
+            // The leftmost slot, then in order successors: the leftmost
+            // slot of the right subtree, or the parent of the first left
+            // child up the path
+            usize k = 1;
+            while (2 * k <= m_Size) k *= 2;
+            for (;;)
+            {
+                visitor(k);
+                if (2 * k + 1 <= m_Size)
+                {
+                    k = 2 * k + 1;
+                    while (2 * k <= m_Size) k *= 2;
+                    continue;
+                }
+
+                k >>= CountRightOne(k) + 1;
+                if (k == 0) return;
+            }
+        }
+
+        /**
+         * @brief Walks from the root to past a leaf, going right wherever
+         * @p goRight holds, and returns the last slot it went left at.
+         */
+        template <typename Predicate>
+        usize Descend(Predicate goRight) const
+        {
+            usize k = 1;
+            while (k <= m_Size)
+            {
+                if constexpr (PREFETCH_STRIDE != 0)
+                    PmPrefetch(m_Data + k * PREFETCH_STRIDE);
+                k = 2 * k + goRight(m_Data[k]);
+            }
+
+            // Undo the trailing right turns and the last left one
+            return k >> (CountRightOne(k) + 1);
+        }
+        const T* Slot(usize k) const { return k ? m_Data + k : nullptr; }
+    };
+}; // namespace Prism
+
+#if PRISM_TARGET_CRYPTIX != 0
+using Prism::EytzingerArray;
+#endif
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <Prism/Containers/RedBlackTree.hpp>
+#include <Prism/Core/Bits.hpp>
 #include <Prism/Debug/Assertions.hpp>
 #include <Prism/Memory/Ref.hpp>
+#include <Prism/Utility/Math.hpp>
 
 namespace Prism
 {
@@ -49,8 +51,12 @@ namespace Prism
                              public NonMovable<BaseRedBlackTree<K>>
     {
       public:
-        PM_NODISCARD usize Size() const { return m_Size; }
-        PM_NODISCARD bool  IsEmpty() const { return m_Size == 0; }
+        PM_NODISCARD usize Size() const
+        {
+            if (m_Size == UNKNOWN_SIZE) m_Size = CountNodes(m_Root);
+            return m_Size;
+        }
+        PM_NODISCARD bool IsEmpty() const { return !m_Root; }
 
         enum class Color : bool
         {
@@ -179,6 +185,12 @@ namespace Prism
         void Insert(Node* node)
         {
             assert(node);
+            // The node may have been in a tree before, so start it afresh
+            node->Parent     = nullptr;
+            node->LeftChild  = nullptr;
+            node->RightChild = nullptr;
+            node->Color      = Color::Red;
+
             Node* Parent = nullptr;
             Node* temp   = m_Root;
             while (temp)
@@ -197,7 +209,7 @@ namespace Prism
                 return;
             }
             // we are the left child
-            if (node->Key < Parent->key) Parent->LeftChild = node;
+            if (node->Key < Parent->Key) Parent->LeftChild = node;
             // we are the right child
             else Parent->RightChild = node;
             node->Parent = Parent;
@@ -205,11 +217,13 @@ namespace Prism
             // no fixups to be done for a height <= 2 tree
             if (node->Parent->Parent) InsertFixups(node);
 
-            m_Size++;
+            if (m_Size != UNKNOWN_SIZE) m_Size++;
             if (m_Minimum->LeftChild == node) m_Minimum = node;
         }
 
-        void InsertFixups(Node* node)
+        // Returns whether the root had turned red, i.e. whether blackening it
+        // grew the black height of the tree
+        bool InsertFixups(Node* node)
         {
             assert(node && node->Color == Color::Red);
             while (node->Parent && node->Parent->Color == Color::Red)
@@ -258,24 +272,32 @@ namespace Prism
                 }
             }
             // the root should always be black
+            bool grew     = m_Root->Color == Color::Red;
             m_Root->Color = Color::Black;
+            return grew;
         }
 
         void Remove(Node* node)
         {
             assert(node);
 
+            if (m_Minimum == node) m_Minimum = Successor(node);
+            Unlink(node);
+
+            if (m_Size != UNKNOWN_SIZE) m_Size--;
+        }
+
+        // Takes the node out of the tree below m_Root, leaving m_Minimum and
+        // m_Size to the caller
+        void Unlink(Node* node)
+        {
             // special case: deleting the only node
-            if (m_Size == 1)
+            if (node == m_Root && !node->LeftChild && !node->RightChild)
             {
-                m_Root    = nullptr;
-                m_Minimum = nullptr;
-                m_Size    = 0;
+                m_Root = nullptr;
                 return;
             }
 
-            if (m_Minimum == node) m_Minimum = Successor(node);
-
             // removal assumes the node has 0 or 1 child, so if we have 2,
             // relink with the successor first (by definition the successor has
             // no left child)
@@ -343,8 +365,6 @@ namespace Prism
             // the node with its child should result in a valid tree (no change
             // to black height)
             if (node->Color != Color::Red) RemoveFixups(child, node->Parent);
-
-            m_Size--;
         }
 
         // We maintain Parent as a separate argument since node might be null
@@ -463,10 +483,283 @@ namespace Prism
             return temp;
         }
 
-        Node* m_Root{nullptr};
-        usize m_Size{0};
+        // A detached subtree and the number of black nodes on each of its
+        // paths down to a null child
+        struct Subtree
+        {
+            Node* Root        = nullptr;
+            usize BlackHeight = 0;
+        };
+        struct SplitSubtrees
+        {
+            Subtree Below;
+            Subtree NotBelow;
+        };
+
+        static usize BlackHeight(Node* node)
+        {
+            usize height = 0;
+            for (; node; node = node->LeftChild)
+                height += node->Color == Color::Black;
+            return height;
+        }
+        static Node* Leftmost(Node* node)
+        {
+            while (node && node->LeftChild) node = node->LeftChild;
+            return node;
+        }
+        static usize CountNodes(Node* node)
+        {
+            if (!node) return 0;
+            return 1 + CountNodes(node->LeftChild)
+                 + CountNodes(node->RightChild);
+        }
+
+        // Links the next count nodes next returns, in key order,
+        // into a subtree as balanced as possible without any rotations.
+        //
+        // Halving the count at every level leaves all null children on the
+        // last two levels; coloring the nodes of the deepest level,
+        // redDepth, red and every other one black then gives every path
+        // the same number of black nodes.
+        template <typename NextNode>
+        static Node* BuildSubtree(usize count, usize depth, usize redDepth,
+                                  NextNode& next)
+        {
+            if (count == 0) return nullptr;
+
+            usize leftCount  = (count - 1) / 2;
+            usize rightCount = count - 1 - leftCount;
+            Node* left  = BuildSubtree(leftCount, depth + 1, redDepth, next);
+            Node* node  = next();
+            Node* right = BuildSubtree(rightCount, depth + 1, redDepth, next);
+
+            node->LeftChild  = left;
+            node->RightChild = right;
+            if (left) left->Parent = node;
+            if (right) right->Parent = node;
+            node->Color = depth == redDepth ? Color::Red : Color::Black;
+
+            return node;
+        }
+        // Replaces the contents with the count nodes next returns
+        template <typename NextNode>
+        void Build(usize count, NextNode&& next)
+        {
+            if (count == 0) return;
+
+            usize redDepth = BitWidth(count) - 1;
+            m_Root         = BuildSubtree(count, 0, redDepth, next);
+            m_Root->Parent = nullptr;
+            m_Root->Color  = Color::Black;
+            m_Minimum      = Leftmost(m_Root);
+            m_Size         = count;
+        }
+
+        // Joins left, pivot and right, whose keys follow each other
+        // in that order, into one subtree in O(1 + the difference of their
+        // black heights).
+        //
+        // The pivot goes in red where the spine of the taller side reaches
+        // the black height of the other, and the usual insertion fixups
+        // repair the red parent it may have. m_Root is used as scratch.
+        Subtree JoinSubtrees(Subtree left, Node* pivot, Subtree right)
+        {
+            auto detach = [](Subtree& tree)
+            {
+                if (!tree.Root) return;
+
+                tree.Root->Parent = nullptr;
+                if (tree.Root->Color == Color::Red)
+                {
+                    tree.Root->Color = Color::Black;
+                    ++tree.BlackHeight;
+                }
+            };
+            detach(left);
+            detach(right);
+
+            pivot->Parent = nullptr;
+            if (left.BlackHeight == right.BlackHeight)
+            {
+                pivot->LeftChild  = left.Root;
+                pivot->RightChild = right.Root;
+                if (left.Root) left.Root->Parent = pivot;
+                if (right.Root) right.Root->Parent = pivot;
+                pivot->Color = Color::Black;
+
+                return {pivot, left.BlackHeight + 1};
+            }
+
+            bool  leftTaller = left.BlackHeight > right.BlackHeight;
+            usize height = Max(left.BlackHeight, right.BlackHeight);
+            usize target = Min(left.BlackHeight, right.BlackHeight);
+            Node* parent = nullptr;
+            Node* node   = leftTaller ? left.Root : right.Root;
+            while (height > target || (node && node->Color == Color::Red))
+            {
+                height -= node->Color == Color::Black;
+                parent = node;
+                node   = leftTaller ? node->RightChild : node->LeftChild;
+            }
+
+            pivot->Color  = Color::Red;
+            pivot->Parent = parent;
+            if (node) node->Parent = pivot;
+            if (leftTaller)
+            {
+                pivot->LeftChild  = node;
+                pivot->RightChild = right.Root;
+                if (right.Root) right.Root->Parent = pivot;
+                parent->RightChild = pivot;
+                m_Root             = left.Root;
+            }
+            else
+            {
+                pivot->LeftChild  = left.Root;
+                pivot->RightChild = node;
+                if (left.Root) left.Root->Parent = pivot;
+                parent->LeftChild = pivot;
+                m_Root            = right.Root;
+            }
+
+            height = Max(left.BlackHeight, right.BlackHeight);
+            if (InsertFixups(pivot)) ++height;
+            return {m_Root, height};
+        }
+        // Joins two subtrees without a pivot by taking the smallest node of
+        // right out first
+        Subtree ConcatenateSubtrees(Subtree left, Subtree right)
+        {
+            if (!left.Root) return right;
+            if (!right.Root) return left;
+
+            Node* pivot = Leftmost(right.Root);
+            m_Root      = right.Root;
+            Unlink(pivot);
+
+            return JoinSubtrees(left, pivot, {m_Root, BlackHeight(m_Root)});
+        }
+
+        // Divides tree into the nodes with keys below key and the
+        // rest in O(log n).
+        //
+        // Walking back up the search path for key, every node is joined,
+        // together with the subtree off the path, onto the side it belongs
+        // to; the pieces only grow as they go up, so the joins' costs
+        // telescope. m_Root is used as scratch.
+        SplitSubtrees SplitSubtree(Subtree tree, K key)
+        {
+            SplitSubtrees result;
+            if (!tree.Root) return result;
+
+            Node* node   = tree.Root;
+            usize height = tree.BlackHeight;
+            for (;;)
+            {
+                Node* next = key <= node->Key ? node->LeftChild
+                                              : node->RightChild;
+                if (!next) break;
+
+                height -= node->Color == Color::Black;
+                node = next;
+            }
+
+            // Both children of a node have the same black height
+            usize childHeight = height - (node->Color == Color::Black);
+            while (node)
+            {
+                Node* parent = node->Parent;
+                bool  black  = node->Color == Color::Black;
+                if (key <= node->Key)
+                    result.NotBelow = JoinSubtrees(
+                        result.NotBelow, node, {node->RightChild, childHeight});
+                else
+                    result.Below = JoinSubtrees({node->LeftChild, childHeight},
+                                                node, result.Below);
+
+                childHeight += black;
+                node = parent;
+            }
+
+            return result;
+        }
+
+        // Moves every node of other, whose keys must not be below any of
+        // this tree's, into this tree
+        void JoinTree(BaseRedBlackTree& other)
+        {
+            if (!other.m_Root) return;
+            if (!m_Root)
+            {
+                Swap(m_Root, other.m_Root);
+                Swap(m_Minimum, other.m_Minimum);
+                Swap(m_Size, other.m_Size);
+                return;
+            }
+
+            usize size = m_Size;
+            if (size != UNKNOWN_SIZE && other.m_Size != UNKNOWN_SIZE)
+                size += other.m_Size;
+            else size = UNKNOWN_SIZE;
+
+            Node* pivot   = other.m_Minimum;
+            Node* maximum = m_Root;
+            while (maximum->RightChild) maximum = maximum->RightChild;
+            assert(!(pivot->Key < maximum->Key));
+            other.Remove(pivot);
+
+            m_Root = JoinSubtrees({m_Root, BlackHeight(m_Root)}, pivot,
+                                  {other.m_Root, BlackHeight(other.m_Root)})
+                         .Root;
+            m_Size          = size;
+            other.m_Root    = nullptr;
+            other.m_Minimum = nullptr;
+            other.m_Size    = 0;
+        }
+        // Moves the nodes with keys not below key into the empty rest
+        void SplitTree(K key, BaseRedBlackTree& rest)
+        {
+            assert(!rest.m_Root);
+            if (!m_Root) return;
+
+            auto [below, notBelow]
+                = SplitSubtree({m_Root, BlackHeight(m_Root)}, key);
+            m_Root         = below.Root;
+            rest.m_Root    = notBelow.Root;
+            rest.m_Minimum = below.Root ? Leftmost(notBelow.Root) : m_Minimum;
+            if (!below.Root) m_Minimum = nullptr;
+
+            // Either side's size would take counting its nodes
+            if (!below.Root || !notBelow.Root)
+            {
+                rest.m_Size = below.Root ? 0 : m_Size;
+                m_Size      = below.Root ? m_Size : 0;
+            }
+            else m_Size = rest.m_Size = UNKNOWN_SIZE;
+        }
+        // Unlinks the nodes with keys in [lo, hi) in O(log n), returning
+        // them as a subtree
+        Node* DetachRange(K lo, K hi)
+        {
+            if (!m_Root || !(lo < hi)) return nullptr;
+
+            auto [below, rest]
+                = SplitSubtree({m_Root, BlackHeight(m_Root)}, lo);
+            auto [range, above] = SplitSubtree(rest, hi);
+            m_Root              = ConcatenateSubtrees(below, above).Root;
+            if (!below.Root) m_Minimum = Leftmost(m_Root);
+
+            return range.Root;
+        }
+
+        static constexpr usize UNKNOWN_SIZE = usize(-1);
+
+        Node*                  m_Root{nullptr};
+        // UNKNOWN_SIZE after a split, until Size() counts the nodes
+        mutable usize          m_Size{0};
         // maintained for O(1) begin()
-        Node* m_Minimum{nullptr};
+        Node*                  m_Minimum{nullptr};
     };
 
     namespace Details
@@ -532,15 +825,61 @@ namespace Prism
             {
                 auto& node = value.*Member;
                 assert(!node.m_In_tree);
-                static_cast<typename BaseTree::Node&>(node).key = key;
+                static_cast<typename BaseTree::Node&>(node).Key = key;
                 BaseTree::Insert(&node);
                 // Note: Self-reference ensures that the
                 // object will keep a ref to itself when the
                 // Container is a smart pointer.
-                if constexpr (!TreeNode::IsRaw) node.m_Self.reference = &value;
+                if constexpr (!TreeNode::IsRaw) node.m_Self.Reference = &value;
                 node.m_In_tree = true;
             }
 
+            // Replaces the contents with [first, last), whose Key members
+            // must not decrease and whose Value members point to the values,
+            // in O(n) and without a single rotation. Suits cloning a whole
+            // tree, e.g. an address space on fork.
+            template <typename It>
+            void BuildFromSorted(It first, It last)
+            {
+                Clear();
+
+                usize count = 0;
+                for (It it = first; it != last; ++it) ++count;
+
+                typename BaseTree::Node* previous = nullptr;
+                BaseTree::Build(
+                    count,
+                    [&]() -> typename BaseTree::Node*
+                    {
+                        V&    value = *first->Value;
+                        auto& node  = value.*Member;
+                        assert(!node.m_In_tree);
+                        assert(!previous || !(first->Key < previous->Key));
+
+                        static_cast<typename BaseTree::Node&>(node).Key
+                            = first->Key;
+                        if constexpr (!TreeNode::IsRaw)
+                            node.m_Self.Reference = &value;
+                        node.m_In_tree = true;
+
+                        ++first;
+                        return previous = &node;
+                    });
+            }
+
+            // Moves every value of other, whose keys must not be below any
+            // in this tree, to the end of this tree in O(log n)
+            void Join(IntrusiveRedBlackTree& other)
+            {
+                BaseTree::JoinTree(other);
+            }
+            // Moves the values with keys not below key to the empty rest in
+            // O(log n); both sizes are counted on their next Size() call
+            void Split(K key, IntrusiveRedBlackTree& rest)
+            {
+                BaseTree::SplitTree(key, rest);
+            }
+
             template <typename ElementType>
             class BaseIterator
             {
@@ -581,7 +920,7 @@ namespace Prism
                 }
                 PM_NODISCARD bool IsEnd() const { return !m_Node; }
                 PM_NODISCARD bool IsBegin() const { return !m_Prev; }
-                PM_NODISCARD auto Key() const { return m_Node->key; }
+                PM_NODISCARD auto Key() const { return m_Node->Key; }
 
               private:
                 friend class IntrusiveRedBlackTree;
@@ -616,13 +955,25 @@ namespace Prism
             ConstIterator BeginFrom(K key) const
             {
                 return ConstIterator(
-                    static_cast<TreeNode*>(BaseTree::Find(this->m_RootF, key)));
+                    static_cast<TreeNode*>(BaseTree::Find(this->m_Root, key)));
             }
             ConstIterator BeginFrom(V const& value) const
             {
                 return Iterator(&(value.*Member));
             }
 
+            // Removes the values with keys in [lo, hi) in O(k + log n) for k
+            // of them, returning k
+            usize EraseRange(K lo, K hi)
+            {
+                usize erased = ClearNodes(
+                    static_cast<TreeNode*>(BaseTree::DetachRange(lo, hi)));
+                if (this->m_Size != BaseTree::UNKNOWN_SIZE)
+                    this->m_Size -= erased;
+
+                return erased;
+            }
+
             bool Remove(K key)
             {
                 auto* node
@@ -631,11 +982,13 @@ namespace Prism
 
                 BaseTree::Remove(node);
 
+                node->Parent     = nullptr;
                 node->RightChild = nullptr;
                 node->LeftChild  = nullptr;
+                node->Color      = BaseTree::Color::Red;
                 node->m_In_tree  = false;
                 if constexpr (!TreeNode::IsRaw)
-                    node->m_Self.reference = nullptr;
+                    node->m_Self.Reference = nullptr;
 
                 return true;
             }
@@ -649,16 +1002,22 @@ namespace Prism
             }
 
           private:
-            static void ClearNodes(TreeNode* node)
+            // Returns the number of nodes released
+            static usize ClearNodes(TreeNode* node)
             {
-                if (!node) return;
-                ClearNodes(static_cast<TreeNode*>(node->RightChild));
+                if (!node) return 0;
+                usize count
+                    = ClearNodes(static_cast<TreeNode*>(node->RightChild));
                 node->RightChild = nullptr;
-                ClearNodes(static_cast<TreeNode*>(node->LeftChild));
+                count += ClearNodes(static_cast<TreeNode*>(node->LeftChild));
                 node->LeftChild = nullptr;
+                node->Parent    = nullptr;
+                node->Color     = BaseTree::Color::Red;
                 node->m_In_tree = false;
                 if constexpr (!TreeNode::IsRaw)
-                    node->m_Self.reference = nullptr;
+                    node->m_Self.Reference = nullptr;
+
+                return count + 1;
             }
 
             static V* NodeToValue(TreeNode& node)
@@ -727,7 +1086,7 @@ namespace Prism
         */
     }; // namespace Details
 
-    template <Integral K, typename V, typename Container = RawPtr<K>>
+    template <Integral K, typename V, typename Container = RawPtr<V>>
     using IntrusiveRedBlackTreeNode
         = Details::SubstitutedIntrusiveRedBlackTreeNode<K, V, Container>;
 
@@ -42,22 +42,41 @@ namespace Prism
     }
     usize RingBuffer::Write(const u8* const buffer, usize count)
     {
-        usize free = Free();
-        if (free == 0 || !buffer) return 0;
-
-        count            = Min(count, free);
+        if (!buffer) return 0;
 
-        auto  tail       = m_Tail.Load();
-        auto  tailMod    = tail % m_Capacity;
+        auto  region     = WritableRegion();
+        count            = Min(count, region.Size());
 
-        usize firstPart  = Min(count, m_Capacity - tailMod);
+        usize firstPart  = Min(count, region.First.Size());
         usize secondPart = count - firstPart;
 
-        Memory::Copy(m_Buffer + tailMod, buffer, firstPart);
+        Memory::Copy(region.First.Raw(), buffer, firstPart);
         if (secondPart > 0)
-            Memory::Copy(m_Buffer, buffer + firstPart, secondPart);
+            Memory::Copy(region.Second.Raw(), buffer + firstPart, secondPart);
+
+        CommitWrite(count);
+        return count;
+    }
+
+    RingBuffer::Region RingBuffer::WritableRegion()
+    {
+        usize free = Free();
+        if (free == 0) return {};
+
+        auto  tailMod   = m_Tail.Load() % m_Capacity;
+        usize firstPart = Min(free, m_Capacity - tailMod);
+
+        return {
+            Span<u8>(m_Buffer + tailMod, firstPart),
+            Span<u8>(m_Buffer, free - firstPart),
+        };
+    }
+    void RingBuffer::CommitWrite(usize count)
+    {
+        assert(count <= Free());
+        if (count == 0) return;
 
+        auto tail = m_Tail.Load();
         m_Tail.Store((tail + count) % (m_Capacity * 2));
-        return static_cast<isize>(count);
     }
 }; // namespace Prism
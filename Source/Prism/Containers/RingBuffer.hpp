@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Prism/Containers/Span.hpp>
 #include <Prism/Core/Types.hpp>
 #include <Prism/Utility/Atomic.hpp>
 
@@ -8,6 +9,18 @@ namespace Prism
     class RingBuffer
     {
       public:
+        /// Free space of the buffer; Second is non-empty when it wraps
+        struct Region
+        {
+            Span<u8>        First;
+            Span<u8>        Second;
+
+            constexpr usize Size() const
+            {
+                return First.Size() + Second.Size();
+            }
+        };
+
         constexpr RingBuffer() = default;
         explicit RingBuffer(usize capacity);
         ~RingBuffer();
@@ -19,8 +32,10 @@ namespace Prism
         {
             auto head = m_Head.Load();
             auto tail = m_Tail.Load(MemoryOrder::eRelaxed);
+            // Indices run modulo twice the capacity, which tells a full
+            // buffer apart from an empty one
             return (tail >= head) ? (tail - head)
-                                  : (m_Capacity - (tail - head));
+                                  : (2 * m_Capacity - (head - tail));
         }
         constexpr usize Free() const { return m_Capacity - Used(); }
 
@@ -29,6 +44,17 @@ namespace Prism
         usize           Read(u8* const buffer, usize size);
         usize           Write(const u8* const data, usize size);
 
+        /**
+         * @brief Exposes the free space for writing in place; nothing
+         * becomes readable until CommitWrite().
+         */
+        Region          WritableRegion();
+        /**
+         * @brief Publishes the first @p count bytes of the region returned
+         * by WritableRegion().
+         */
+        void            CommitWrite(usize count);
+
       private:
         u8*           m_Buffer   = nullptr;
         usize         m_Capacity = 0;
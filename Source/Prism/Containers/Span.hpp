@@ -160,8 +160,8 @@ namespace Prism
                      || Extent == N)
                      && (IsArrayConvertible<T, U>::Value)
         constexpr explicit(Extent != DynamicExtent && N == DynamicExtent)
-            Span(const Span<U, N>& s) PM_NOEXCEPT : m_Extent(s.Size()),
-                                                    m_Data(s.Raw())
+            Span(const Span<U, N>& s) PM_NOEXCEPT : m_Data(s.Raw()),
+                                                    m_Extent(s.Size())
         {
             if constexpr (Extent != DynamicExtent) assert(s.Size() == Extent);
         }
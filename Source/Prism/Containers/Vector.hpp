@@ -506,6 +506,26 @@ namespace Prism
 
             return m_Data + index;
         }
+        /**
+         * @brief Removes elements in the range [first, last).
+         * @param first Iterator to the first element to remove.
+         * @param last Iterator past the last element to remove.
+         * @return Iterator to the element following the removed range.
+         */
+        constexpr Iterator Erase(Iterator first, Iterator last)
+        {
+            assert(first >= begin() && first <= last && last <= end());
+            usize index = first - m_Data;
+            usize count = last - first;
+            if (count == 0) return first;
+
+            for (usize i = index; i + count < m_Size; i++)
+                m_Data[i] = Move(m_Data[i + count]);
+            for (usize i = m_Size - count; i < m_Size; i++) m_Data[i].~T();
+            m_Size -= count;
+
+            return m_Data + index;
+        }
 
         /**
          * @brief Adds an element to the end.
@@ -106,8 +106,8 @@ namespace Prism
     {
         constexpr auto Nd = IntegerTraits<T>::Digits;
 
-#if PrismHasBuiltin(builtin_clzg)
-        return builtin_clzg(x, Nd);
+#if PrismHasBuiltin(__builtin_clzg)
+        return __builtin_clzg(x, Nd);
 #else
         if (x == 0) return Nd;
 
@@ -118,17 +118,17 @@ namespace Prism
         if constexpr (Nd <= NdU)
         {
             constexpr i32 diff = NdU - Nd;
-            return builtin_clz(x) - diff;
+            return __builtin_clz(x) - diff;
         }
         else if constexpr (Nd <= NdUl)
         {
             constexpr i32 diff = NdUl - Nd;
-            return builtin_clzl(x) - diff;
+            return __builtin_clzl(x) - diff;
         }
         else if constexpr (Nd <= NdUll)
         {
             constexpr i32 diff = NdUll - Nd;
-            return builtin_clzll(x) - diff;
+            return __builtin_clzll(x) - diff;
         }
         else // (Nd > NdUll)
         {
@@ -60,6 +60,9 @@
     #if __has_builtin(__builtin_trap)
         #define PmTrap() __builtin_trap()
     #endif
+    #if __has_builtin(__builtin_prefetch)
+        #define PmPrefetch(address) __builtin_prefetch(address)
+    #endif
 #endif
 
 #ifndef PM_LINE
@@ -81,6 +84,9 @@
 #ifndef PmTrap
     #define PmTrap() ((void)0)
 #endif
+#ifndef PmPrefetch
+    #define PmPrefetch(address) ((void)(address))
+#endif
 
 namespace Prism
 {
@@ -296,67 +296,9 @@ namespace Prism
     {
         return ilist.size() == 0;
     }
-
-    /**
-     *  @brief  Searches for the first element in the partitioned range [first,
-     * last) which is not ordered before value.
-     *  @param  first Iterator to the beginning of the range
-     *  @param  last Iterator to the end of the range
-     *  @param  value Value to compare the elements to
-     *  @param  comparator Binary predicate which returns true if the first
-     * argument is ordered before the second
-     *
-     * @return Iterator to the first element of new range
-     */
-    template <typename ForwardIterator, typename T, typename Comparator>
-    constexpr ForwardIterator LowerBound(ForwardIterator first,
-                                         ForwardIterator last, const T& value,
-                                         Comparator comparator)
-    {
-        using DistanceType =
-            typename IteratorTraits<ForwardIterator>::DifferenceType;
-
-        DistanceType length = Distance(first, last);
-
-        while (length > 0)
-        {
-            DistanceType    half   = length >> 1;
-            ForwardIterator middle = first;
-            Advance(middle, half);
-            if (comparator(middle, value))
-            {
-                first = middle;
-                ++first;
-                length -= half - 1;
-                continue;
-            }
-
-            length = half;
-        }
-        return first;
-    }
-
-    /**
-     *  @brief Finds the first position in which @a val could be inserted
-     *         without changing the ordering.
-     *  @param  first   An iterator.
-     *  @param  last    Another iterator.
-     *  @param  value     The search term.
-     *
-     *  @return         An iterator pointing to the first element <em>not less
-     *                  than</em> @a val, or end() if every element is less than
-     *                  @a val.
-     */
-    template <typename ForwardIterator, typename T>
-    PM_NODISCARD constexpr inline ForwardIterator
-    LowerBound(ForwardIterator first, ForwardIterator last, const T& value)
-    {
-        return LowerBound(first, last, value, IteratorLessValueType());
-    }
 }; // namespace Prism
 
 #if PRISM_TARGET_CRYPTIX != 0
 using Prism::Empty;
-using Prism::LowerBound;
 using Prism::Size;
 #endif
@@ -18,7 +18,8 @@
     #define PrismFmtFormat(...) fmt::format(__VA_ARGS__)
 #else
     #include <Prism/String/Formatter.hpp>
-    #define PrismFmtFormat(fmt, ...) Format1(__VA_ARGS__)
+    #define PrismFmtFormat(fmt, ...)                                           \
+        Prism::Format1(fmt __VA_OPT__(, ) __VA_ARGS__)
 #endif
 
 #if !defined(PRISM_TARGET_CRYPTIX) || PRISM_TARGET_CRYPTIX == 0
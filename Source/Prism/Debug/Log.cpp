@@ -66,6 +66,7 @@ namespace Prism::Log
                 value *= -1;
             }
             String str     = StringUtils::ToString(value, spec.Base);
+            if (spec.UpperCase) StringUtils::ToUpperInPlace(str);
 
             char   padding = spec.ZeroPad ? '0' : ' ';
             if (spec.Sign != Sign::eNone && spec.Length > 0) spec.Length--;
@@ -90,11 +91,7 @@ namespace Prism::Log
                 else if (spec.Base == 16) nwritten += Print("0x");
             }
 
-            for (const auto c : str)
-                LogChar(spec.UpperCase && c >= 'a' && c <= 'z'
-                            ? StringUtils::ToUpper(c)
-                            : c),
-                    ++nwritten;
+            for (const auto c : str) LogChar(c), ++nwritten;
             while (spec.JustifyLeft
                    && static_cast<isize>(str.Size()) < spec.Length)
             {
@@ -0,0 +1,204 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/WyHash.hpp>
+#include <Prism/Debug/Profiler.hpp>
+#include <Prism/String/StringBuilder.hpp>
+#include <Prism/String/StringUtils.hpp>
+#include <Prism/Utility/Math.hpp>
+
+#include <new>
+
+namespace Prism
+{
+    namespace
+    {
+        constexpr usize INITIAL_TABLE_SIZE = 256;
+
+        bool            SameFrames(const Pointer* lhs, const Pointer* rhs,
+                                   usize depth)
+        {
+            for (usize i = 0; i < depth; ++i)
+                if (lhs[i].Raw() != rhs[i].Raw()) return false;
+            return true;
+        }
+    }; // namespace
+
+    Profiler::Profiler(usize cpuCount, usize samplesPerCpu, usize maxDepth)
+        : m_CpuCount(cpuCount)
+        , m_SamplesPerCpu(samplesPerCpu)
+        , m_RecordSize(maxDepth + 1)
+    {
+        assert(samplesPerCpu > 0 && maxDepth > 0);
+
+        m_CpuStorage = ::operator new(
+            cpuCount * sizeof(CpuBuffer) + CACHE_LINE_SIZE, std::nothrow);
+        if (!m_CpuStorage)
+        {
+            m_CpuCount = 0;
+            return;
+        }
+
+        upointer aligned
+            = (reinterpret_cast<upointer>(m_CpuStorage) + CACHE_LINE_SIZE - 1)
+            & ~(CACHE_LINE_SIZE - 1);
+        m_Cpus = reinterpret_cast<CpuBuffer*>(aligned);
+        for (usize cpu = 0; cpu < cpuCount; ++cpu) new (m_Cpus + cpu) CpuBuffer;
+
+        m_Records.Resize(cpuCount * samplesPerCpu * m_RecordSize);
+    }
+    Profiler::~Profiler()
+    {
+        for (usize cpu = 0; cpu < m_CpuCount; ++cpu) m_Cpus[cpu].~CpuBuffer();
+        if (m_CpuStorage) ::operator delete(m_CpuStorage);
+    }
+
+    bool Profiler::Sample(usize cpu, Pointer frameAddress,
+                          Pointer instructionPointer, usize skipFrames)
+    {
+        if (!m_Cpus) return false;
+        assert(cpu < m_CpuCount);
+
+        CpuBuffer& buffer = m_Cpus[cpu];
+
+        usize      head   = buffer.Head.Load(MemoryOrder::eRelaxed);
+        if (head - buffer.Tail.Load(MemoryOrder::eAcquire) >= m_SamplesPerCpu)
+        {
+            buffer.Dropped.FetchAdd(1, MemoryOrder::eRelaxed);
+            return false;
+        }
+
+        Pointer* record
+            = m_Records.Raw()
+            + (cpu * m_SamplesPerCpu + head % m_SamplesPerCpu) * m_RecordSize;
+        Pointer* frames   = record + 1;
+        usize    maxDepth = m_RecordSize - 1;
+        usize    depth    = 0;
+        if (instructionPointer) frames[depth++] = instructionPointer;
+        depth += Stacktrace::Walk(frameAddress, frames + depth,
+                                  maxDepth - depth, skipFrames);
+        record[0] = depth;
+
+        buffer.Head.Store(head + 1, MemoryOrder::eRelease);
+        return true;
+    }
+
+    void Profiler::Drain()
+    {
+        for (usize cpu = 0; cpu < m_CpuCount; ++cpu)
+        {
+            CpuBuffer& buffer = m_Cpus[cpu];
+            usize      tail   = buffer.Tail.Load(MemoryOrder::eRelaxed);
+            usize      head   = buffer.Head.Load(MemoryOrder::eAcquire);
+
+            for (; tail != head; ++tail)
+            {
+                const Pointer* record
+                    = m_Records.Raw()
+                    + (cpu * m_SamplesPerCpu + tail % m_SamplesPerCpu)
+                          * m_RecordSize;
+                Count(record + 1, record[0].Raw());
+            }
+
+            // Hands the drained slots back to the sampled CPU
+            buffer.Tail.Store(tail, MemoryOrder::eRelease);
+        }
+    }
+    void Profiler::Reset()
+    {
+        m_Table.Clear();
+        m_Stacks.Clear();
+        m_StackCount  = 0;
+        m_SampleCount = 0;
+    }
+
+    usize Profiler::DroppedCount() const
+    {
+        usize dropped = 0;
+        for (usize cpu = 0; cpu < m_CpuCount; ++cpu)
+            dropped += m_Cpus[cpu].Dropped.Load(MemoryOrder::eRelaxed);
+
+        return dropped;
+    }
+
+    String Profiler::ExportFolded(const Stacktrace& symbols) const
+    {
+        StringBuilder builder;
+        ForEachStack(
+            [&](Span<const Pointer> frames, usize count)
+            {
+                for (usize i = frames.Size(); i-- > 0;)
+                {
+                    PhysAddr      address = frames[i].Raw();
+                    const auto*   symbol  = symbols.GetSymbol(address);
+                    if (symbol) builder << symbols.DemangledName(*symbol);
+                    else
+                    {
+                        // 0x and at most 16 hexadecimal digits
+                        char  buffer[18] = {'0', 'x'};
+                        char* end        = StringUtils::ToChars(
+                                        buffer + 2, buffer + sizeof(buffer),
+                                        address, 16)
+                                        .End;
+                        builder << StringView(buffer, end - buffer);
+                    }
+
+                    if (i != 0) builder << ';';
+                }
+
+                builder << ' ' << static_cast<u64>(count) << '\n';
+            });
+
+        return Move(builder).ToString();
+    }
+
+    void Profiler::Count(const Pointer* frames, usize depth)
+    {
+        if ((m_StackCount + 1) * 4 > m_Table.Size() * 3) Grow();
+
+        u64   hash = WyHash::Hash(frames, depth * sizeof(Pointer));
+        usize mask = m_Table.Size() - 1;
+        for (usize slot = hash & mask;; slot = (slot + 1) & mask)
+        {
+            StackEntry& entry = m_Table[slot];
+            if (entry.Count == 0)
+            {
+                entry.Hash   = hash;
+                entry.Offset = m_Stacks.Size();
+                entry.Depth  = depth;
+                entry.Count  = 1;
+                for (usize i = 0; i < depth; ++i) m_Stacks.PushBack(frames[i]);
+
+                ++m_StackCount;
+                break;
+            }
+
+            if (entry.Hash == hash && entry.Depth == depth
+                && SameFrames(m_Stacks.Raw() + entry.Offset, frames, depth))
+            {
+                ++entry.Count;
+                break;
+            }
+        }
+
+        ++m_SampleCount;
+    }
+    void Profiler::Grow()
+    {
+        usize              size = Max(m_Table.Size() * 2, INITIAL_TABLE_SIZE);
+        Vector<StackEntry> table(size);
+        for (const auto& entry : m_Table)
+        {
+            if (entry.Count == 0) continue;
+
+            usize slot = entry.Hash & (size - 1);
+            while (table[slot].Count != 0) slot = (slot + 1) & (size - 1);
+            table[slot] = entry;
+        }
+
+        m_Table = Move(table);
+    }
+}; // namespace Prism
@@ -0,0 +1,144 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Containers/Span.hpp>
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/Core/Types.hpp>
+#include <Prism/Debug/Stacktrace.hpp>
+#include <Prism/Memory/Pointer.hpp>
+#include <Prism/String/String.hpp>
+#include <Prism/Utility/Atomic.hpp>
+
+namespace Prism
+{
+    /**
+     * @brief Sampling profiler over frame pointer stack walks.
+     *
+     * A timer interrupt or profiling signal calls Sample() on the CPU it
+     * interrupted; the stack is walked straight into that CPU's
+     * preallocated ring of samples, without allocating or locking.
+     * Drain() later folds the pending samples of every CPU into a table
+     * counting each distinct stack, from which ExportFolded() writes the
+     * folded stacks format flame graph tools read.
+     */
+    class Profiler
+    {
+      public:
+        static constexpr usize DEFAULT_SAMPLES_PER_CPU = 4096;
+        static constexpr usize DEFAULT_MAX_DEPTH       = 32;
+
+        explicit Profiler(usize cpuCount,
+                          usize samplesPerCpu = DEFAULT_SAMPLES_PER_CPU,
+                          usize maxDepth      = DEFAULT_MAX_DEPTH);
+
+        Profiler(const Profiler&)            = delete;
+        ~Profiler();
+
+        Profiler& operator=(const Profiler&) = delete;
+
+        /**
+         * @brief Records the stack of the code interrupted on @p cpu.
+         *
+         * @p frameAddress is its frame pointer and @p instructionPointer,
+         * if not null, the address it was interrupted at, which becomes
+         * the innermost frame. Only one context may sample a given CPU at
+         * a time; Drain() may run concurrently on any CPU.
+         *
+         * @return false if the CPU's ring was full and the sample dropped,
+         * or if the profiler could not allocate its counters
+         */
+        bool  Sample(usize cpu, Pointer frameAddress,
+                     Pointer instructionPointer = nullptr,
+                     usize   skipFrames         = 0);
+
+        /**
+         * @brief Moves the pending samples of every CPU into the stack
+         * counts. Allocates; must not run concurrently with itself.
+         */
+        void  Drain();
+        /// Forgets every counted stack; pending samples are kept
+        void  Reset();
+
+        /// Samples moved into the stack counts so far
+        usize SampleCount() const { return m_SampleCount; }
+        /// Distinct stacks among them
+        usize StackCount() const { return m_StackCount; }
+        /// Samples lost to full rings
+        usize DroppedCount() const;
+
+        /**
+         * @brief Calls @p visitor with every distinct stack, innermost frame
+         * first, and how many samples hit it.
+         */
+        template <typename Visitor>
+        void ForEachStack(Visitor&& visitor) const
+        {
+            for (const auto& entry : m_Table)
+                if (entry.Count != 0)
+                    visitor(Span<const Pointer>(m_Stacks.Raw() + entry.Offset,
+                                                entry.Depth),
+                            entry.Count);
+        }
+
+        /**
+         * @brief Writes every distinct stack as a line of frames from the
+         * outermost one in, separated by ';', followed by its sample count.
+         *
+         * Frames are named after their demangled symbol in @p symbols, or
+         * their hexadecimal address when none contains them.
+         */
+        String ExportFolded(const Stacktrace& symbols) const;
+
+      private:
+        static constexpr usize CACHE_LINE_SIZE = 64;
+
+        // Aligned so the counters of neighbouring CPUs never share a line;
+        // the storage is rounded up by hand, so no over-aligned operator
+        // new is needed
+        struct alignas(CACHE_LINE_SIZE) CpuBuffer
+        {
+            /// Samples written, advanced only by the sampled CPU
+            Atomic<usize> Head    = 0;
+            /// Samples drained, advanced only by Drain()
+            Atomic<usize> Tail    = 0;
+            Atomic<usize> Dropped = 0;
+        };
+        struct StackEntry
+        {
+            u64   Hash   = 0;
+            /// Index of the innermost frame in m_Stacks
+            usize Offset = 0;
+            usize Depth  = 0;
+            /// 0 for a free slot
+            usize Count  = 0;
+        };
+
+        usize              m_CpuCount;
+        usize              m_SamplesPerCpu;
+        /// A sample is its depth followed by maxDepth frame slots
+        usize              m_RecordSize;
+        void*              m_CpuStorage = nullptr;
+        /// Null if the storage could not be allocated
+        CpuBuffer*         m_Cpus       = nullptr;
+        Vector<Pointer>    m_Records;
+
+        /// Open addressing, linear probing, power of two sized
+        Vector<StackEntry> m_Table;
+        /// Frames of every distinct stack, back to back
+        Vector<Pointer>    m_Stacks;
+        usize              m_StackCount  = 0;
+        usize              m_SampleCount = 0;
+
+        void               Count(const Pointer* frames, usize depth);
+        void               Grow();
+    };
+}; // namespace Prism
+
+#if PRISM_TARGET_CRYPTIX != 0
+using Prism::Profiler;
+#endif
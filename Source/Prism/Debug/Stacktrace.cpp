@@ -4,6 +4,9 @@
  *
  * SPDX-License-Identifier: GPL-3
  */
+#include <Prism/Algorithm/Find.hpp>
+#include <Prism/Algorithm/Sort.hpp>
+#include <Prism/Core/Limits.hpp>
 #include <Prism/Debug/Stacktrace.hpp>
 #include <Prism/String/String.hpp>
 #include <Prism/Utility/Math.hpp>
@@ -14,6 +17,22 @@
 
 namespace Prism
 {
+    namespace
+    {
+        /// Longest demangled name DemangledName() produces
+        constexpr usize DEMANGLE_BUFFER_SIZE = 512;
+
+        String          DemangleName(const char* name)
+        {
+#if PRISM_TARGET_CARBONC == 0
+            char buffer[DEMANGLE_BUFFER_SIZE];
+            if (absl::debugging_internal::Demangle(name, buffer,
+                                                   sizeof(buffer)))
+                return String(buffer);
+#endif
+            return String(name);
+        }
+    }; // namespace
 
     const String Stacktrace::Symbol::Demangle() const
     {
@@ -31,32 +50,123 @@ namespace Prism
     Stacktrace::Stacktrace(Pointer frameAddress, usize skipFrames,
                            usize maxDepth)
     {
-        auto stackFrame = frameAddress.As<StackFrame>();
+        m_Frames.Resize(maxDepth);
+        m_Frames.Resize(Walk(frameAddress, m_Frames.Raw(), maxDepth,
+                             skipFrames));
+    }
 
-        for (usize i = 0; stackFrame && i < maxDepth; i++)
+    usize Stacktrace::Walk(Pointer frameAddress, Pointer* frames,
+                           usize maxDepth, usize skipFrames)
+    {
+        auto  stackFrame = frameAddress.As<StackFrame>();
+        usize depth      = 0;
+        for (usize i = 0; stackFrame && depth < maxDepth; ++i)
         {
-            while (i < skipFrames) continue;
-
-            u64 rip = stackFrame->InstructionPointer;
+            Pointer rip = stackFrame->InstructionPointer;
             if (!rip) break;
-            stackFrame = stackFrame->PreviousFrame;
+            if (i >= skipFrames) frames[depth++] = rip;
+
+            // The stack grows down, so every caller's frame lies above its
+            // callee's
+            StackFrame* previous = stackFrame->PreviousFrame;
+            if (previous <= stackFrame
+                || reinterpret_cast<upointer>(previous) % alignof(StackFrame))
+                break;
+            stackFrame = previous;
+        }
+
+        return depth;
+    }
+
+    bool Stacktrace::LoadSymbols(Vector<Symbol>&& symbols,
+                                 PhysAddr         lowestSymbolAddress,
+                                 PhysAddr         highestSymbolAddress)
+    {
+        m_Symbols              = Move(symbols);
+        m_LowestSymbolAddress  = lowestSymbolAddress;
+        m_HighestSymbolAddress = highestSymbolAddress;
+        m_Offsets.Clear();
+        m_Buckets.Clear();
+        m_DemangledNames.Clear();
 
-            m_Frames.PushBack(stackFrame);
+        auto inBoundsEnd
+            = RemoveIf(m_Symbols.begin(), m_Symbols.end(),
+                       [&](const Symbol& symbol)
+                       {
+                           PhysAddr address = symbol.Address.Raw();
+                           return address < lowestSymbolAddress
+                               || address > highestSymbolAddress;
+                       });
+        m_Symbols.Resize(inBoundsEnd - m_Symbols.begin());
+        // Symbol tables mostly come in address order already, which the
+        // radix sort notices up front
+        Sort(m_Symbols.begin(), m_Symbols.end(),
+             [](const Symbol& symbol) { return symbol.Address.Raw(); });
+        if (m_Symbols.Empty()) return true;
+
+        usize    count = m_Symbols.Size();
+        PhysAddr span  = m_Symbols.Back().Address.Raw()
+                      - m_Symbols.Front().Address.Raw();
+        if (span > NumericLimits<u32>::Max()
+            || count > NumericLimits<u32>::Max())
+        {
+            m_Symbols.Clear();
+            return false;
+        }
+
+        m_BaseAddress = m_Symbols.Front().Address.Raw();
+        m_Offsets.Resize(count);
+        for (usize i = 0; i < count; ++i)
+            m_Offsets[i]
+                = static_cast<u32>(m_Symbols[i].Address.Raw() - m_BaseAddress);
+
+        // Buckets as wide as the symbols are apart on average
+        m_BucketShift = 0;
+        while ((span >> m_BucketShift) >= count) ++m_BucketShift;
+
+        usize buckets = (span >> m_BucketShift) + 1;
+        usize symbol  = 0;
+        m_Buckets.Resize(buckets + 1);
+        for (usize bucket = 0; bucket < buckets; ++bucket)
+        {
+            u64 start = static_cast<u64>(bucket) << m_BucketShift;
+            while (symbol < count && m_Offsets[symbol] < start) ++symbol;
+            m_Buckets[bucket] = static_cast<u32>(symbol);
         }
+        m_Buckets[buckets] = static_cast<u32>(count);
+
+        return true;
     }
 
     const Stacktrace::Symbol* Stacktrace::GetSymbol(PhysAddr address) const
     {
         if (address < m_LowestSymbolAddress || address > m_HighestSymbolAddress)
             return nullptr;
+        if (m_Symbols.Empty() || address < m_BaseAddress) return nullptr;
 
-        for (auto& symbol : m_Symbols)
-        {
-            if ((&symbol + 1) == m_Symbols.end()) break;
-            if (address < (&symbol + 1)->Address.Raw()) return &symbol;
-        }
+        PhysAddr offset = address - m_BaseAddress;
+        usize    bucket = offset >> m_BucketShift;
+        if (bucket + 1 >= m_Buckets.Size()) return &m_Symbols.Back();
+
+        // The first symbol past the address is within the bucket, or the
+        // first one of the next bucket
+        const u32* offsets = m_Offsets.Raw();
+        const u32* next
+            = UpperBound(offsets + m_Buckets[bucket],
+                         offsets + m_Buckets[bucket + 1],
+                         static_cast<u32>(offset));
+
+        return &m_Symbols[next - offsets - 1];
+    }
+
+    StringView Stacktrace::DemangledName(const Symbol& symbol) const
+    {
+        usize index = &symbol - m_Symbols.Raw();
+        auto  it    = m_DemangledNames.Find(index);
+        if (it == m_DemangledNames.end())
+            it = m_DemangledNames.TryEmplace(index, DemangleName(symbol.Name));
 
-        return &m_Symbols[0];
+        return it->Value;
     }
 
     Stacktrace Stacktrace::GetCurrent()
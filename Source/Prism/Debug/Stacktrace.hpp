@@ -6,18 +6,15 @@
  */
 #pragma once
 
+#include <Prism/Containers/UnorderedMap.hpp>
 #include <Prism/Containers/Vector.hpp>
 #include <Prism/Core/Types.hpp>
 #include <Prism/Memory/Pointer.hpp>
+#include <Prism/String/String.hpp>
+#include <Prism/String/StringView.hpp>
 
 namespace Prism
 {
-    template <typename C>
-    struct CharTraits;
-    template <typename C, typename Traits>
-    class BasicString;
-    using String = BasicString<char, CharTraits<char>>;
-
     struct StackFrame
     {
         StackFrame* PreviousFrame      = nullptr;
@@ -42,31 +39,81 @@ namespace Prism
         };
 
         Stacktrace() = default;
+        /**
+         * @brief Captures the return addresses of up to @p maxDepth frames
+         * of the frame pointer chain starting at @p frameAddress, after
+         * skipping the innermost @p skipFrames.
+         */
         Stacktrace(Pointer frameAddress, usize skipFrames = 0,
                    usize maxDepth = 32);
 
-        bool LoadSymbols(Vector<Symbol>&& symbols,
-                         PhysAddr         lowestSymbolAddress  = 0x0000'0000,
-                         PhysAddr         highestSymbolAddress = 0xffff'ffff)
-        {
-            m_Symbols              = Move(symbols);
-            m_LowestSymbolAddress  = lowestSymbolAddress;
-            m_HighestSymbolAddress = highestSymbolAddress;
+        /**
+         * @brief Walks the frame pointer chain starting at @p frameAddress
+         * and stores up to @p maxDepth return addresses, innermost first,
+         * in @p frames, after skipping the innermost @p skipFrames.
+         *
+         * Neither allocates nor locks, so it can run in an interrupt or
+         * signal handler. The walk stops at a frame that does not lie
+         * above the previous one, which ends corrupt or cyclic chains.
+         *
+         * @return The number of addresses stored
+         */
+        static usize  Walk(Pointer frameAddress, Pointer* frames,
+                           usize maxDepth, usize skipFrames = 0);
 
-            return {};
-        }
-        const Symbol*          GetSymbol(PhysAddr addr) const;
+        /**
+         * @brief Takes over @p symbols, in any order, and indexes the ones
+         * within [lowestSymbolAddress, highestSymbolAddress] for GetSymbol().
+         *
+         * @return false if the symbols span more than 4 GiB, which the
+         * 32 bit offsets of the index cannot hold
+         */
+        bool          LoadSymbols(Vector<Symbol>&& symbols,
+                                  PhysAddr lowestSymbolAddress  = 0x0000'0000,
+                                  PhysAddr highestSymbolAddress = 0xffff'ffff);
+        /**
+         * @brief The symbol @p addr lies in: the one with the highest
+         * address not above it, or nullptr.
+         *
+         * Looks the address up in a bucket of the index and binary searches
+         * the few symbol offsets that bucket covers.
+         */
+        const Symbol* GetSymbol(PhysAddr addr) const;
+        /**
+         * @brief The demangled name of @p symbol, which GetSymbol() returned,
+         * or its raw name if it does not demangle.
+         *
+         * Every symbol is demangled once; the names stay valid until the
+         * next LoadSymbols(). Not safe to call from several CPUs at once.
+         */
+        StringView    DemangledName(const Symbol& symbol) const;
 
-        constexpr StackFrame** begin() { return m_Frames.begin(); }
-        constexpr StackFrame** end() { return m_Frames.end(); }
+        /// The captured return addresses, innermost first
+        constexpr Pointer* begin() { return m_Frames.begin(); }
+        constexpr Pointer* end() { return m_Frames.end(); }
 
         static Stacktrace      GetCurrent();
 
       private:
-        Vector<StackFrame*> m_Frames;
+        Vector<Pointer>     m_Frames;
 
+        /// Sorted by address
         Vector<Symbol>      m_Symbols;
         PhysAddr            m_LowestSymbolAddress  = 0x0000'0000;
         PhysAddr            m_HighestSymbolAddress = 0xffff'ffff;
+
+        /// Symbol addresses minus m_BaseAddress, 4 bytes each
+        Vector<u32>         m_Offsets;
+        /**
+         * Entry i is the number of symbols below
+         * m_BaseAddress + (i << m_BucketShift), with the symbol count last;
+         * there are about as many buckets as symbols.
+         */
+        Vector<u32>         m_Buckets;
+        PhysAddr            m_BaseAddress = 0;
+        usize               m_BucketShift = 0;
+
+        /// Demangled names, by symbol index
+        mutable UnorderedMap<usize, String> m_DemangledNames;
     }; // namespace Stacktrace
 }; // namespace Prism
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <Prism/Algorithm/Hasher.hpp>
 #include <Prism/Containers/Span.hpp>
 #include <Prism/Containers/Vector.hpp>
 #include <Prism/Core/Types.hpp>
@@ -65,6 +66,19 @@ namespace Prism
                 Memory::Copy(dest.Raw(), Raw() + offset, bytes);
             else Memory::Copy(dest, Raw() + offset, bytes);
         }
+        /// Feeds @p bytes bytes starting at @p offset to @p hasher
+        template <StreamingHasher H>
+        void Feed(H& hasher, usize offset, usize bytes) const
+        {
+            assert(offset + bytes <= m_Buffer.Size());
+            hasher.Update(Prism::Span<const Byte>(Raw() + offset, bytes));
+        }
+        template <StreamingHasher H>
+        void Feed(H& hasher) const
+        {
+            hasher.Update(Span());
+        }
+
         void Write(usize offset, const Byte* src, usize bytes)
         {
             assert((offset + bytes) <= m_Buffer.Size());
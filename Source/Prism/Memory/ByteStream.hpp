@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <Prism/Algorithm/Hasher.hpp>
 #include <Prism/Core/Types.hpp>
 #include <Prism/Memory/Endian.hpp>
 
@@ -75,6 +76,19 @@ namespace Prism
             m_Offset += size;
         }
 
+        /**
+         * @brief Feeds the next @p size bytes to @p hasher and advances past
+         * them, without copying them out of the stream.
+         */
+        template <StreamingHasher H>
+        void Feed(H& hasher, usize size)
+        {
+            assert(m_Offset + size <= m_Size);
+
+            hasher.Update(Span<const u8>(m_Data + m_Offset, size));
+            m_Offset += size;
+        }
+
         void Write(ByteStream<E>& inStream, usize size)
         {
             assert(m_Offset + size <= m_Size);
@@ -71,6 +71,21 @@ namespace Prism
         Pointer Fill(const Pointer destination, u8 value, usize count);
         Pointer Move(Pointer destination, const Pointer source, usize count);
         Pointer ScanForCharacter(const Pointer memory, u8 c, usize size);
+
+        /**
+         * @brief Reads a T from an address with no alignment requirement.
+         *
+         * Compiles down to a single load on every target we support, without
+         * calling into an out-of-line memcpy.
+         */
+        template <typename T>
+        PM_ALWAYS_INLINE T LoadUnaligned(const void* source)
+        {
+            T value;
+            __builtin_memcpy(&value, source, sizeof(T));
+
+            return value;
+        }
     }; // namespace Memory
 }; // namespace Prism
 
@@ -0,0 +1,284 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Core/HashTraits.hpp>
+#include <Prism/Core/NonCopyable.hpp>
+#include <Prism/String/StringView.hpp>
+#include <Prism/Utility/Atomic.hpp>
+#include <Prism/Utility/LockingPolicy.hpp>
+#include <Prism/Utility/Optional.hpp>
+
+namespace Prism
+{
+    namespace Detail
+    {
+        /// An interned string; the characters follow the header
+        struct AtomEntry
+        {
+            usize       Hash;
+            usize       Size;
+
+            const char* Data() const
+            {
+                return reinterpret_cast<const char*>(this + 1);
+            }
+        };
+    }; // namespace Detail
+
+    /**
+     * @brief A handle to a string interned in an AtomTable.
+     *
+     * Interning makes equal strings share one entry, so atoms compare by
+     * pointer and carry the hash of their string, computed once. An atom is
+     * valid for as long as the table that produced it. The default atom is
+     * the empty string.
+     */
+    class Atom
+    {
+      public:
+        constexpr Atom() = default;
+
+        PM_NODISCARD StringView View() const
+        {
+            return m_Entry ? StringView(m_Entry->Data(), m_Entry->Size)
+                           : StringView();
+        }
+        PM_NODISCARD const char* Raw() const { return View().Raw(); }
+        PM_NODISCARD constexpr usize Size() const
+        {
+            return m_Entry ? m_Entry->Size : 0;
+        }
+        PM_NODISCARD constexpr bool  Empty() const { return !m_Entry; }
+        /// Hash<StringView> of the string, as computed when it was interned
+        PM_NODISCARD constexpr usize Hash() const
+        {
+            return m_Entry ? m_Entry->Hash : 0;
+        }
+
+        operator StringView() const { return View(); }
+
+        constexpr bool operator==(const Atom& other) const = default;
+
+      private:
+        const Detail::AtomEntry* m_Entry = nullptr;
+
+        constexpr explicit Atom(const Detail::AtomEntry* entry)
+            : m_Entry(entry)
+        {
+        }
+
+        template <LockingPolicy>
+        friend class AtomTable;
+    };
+
+    /**
+     * @brief Interns strings, mapping each distinct string to one Atom.
+     *
+     * The strings are copied into an arena that only grows, so atoms stay
+     * valid until the table is destroyed. Lookups of strings that are
+     * already interned are lock-free: the slots are published with release
+     * stores and read with acquire loads, and a grown slot array is kept
+     * around for readers that may still be probing it. Insertions take
+     * @p Lock, which has to be a real lock once several threads intern.
+     */
+    template <LockingPolicy Lock = NoLock>
+    class AtomTable : public NonCopyable<AtomTable<Lock>>
+    {
+      public:
+        inline constexpr static usize INITIAL_CAPACITY = 64;
+        inline constexpr static usize BLOCK_SIZE       = 4096;
+
+        AtomTable() { m_Slots.Store(AllocateSlots(INITIAL_CAPACITY)); }
+        ~AtomTable()
+        {
+            for (Slots* slots = m_Slots.Load(); slots;)
+            {
+                Slots* retired = slots->Retired;
+                delete[] slots->Entries;
+                delete slots;
+
+                slots = retired;
+            }
+            while (m_Block)
+            {
+                u8* previous = *reinterpret_cast<u8**>(m_Block);
+                delete[] m_Block;
+
+                m_Block = previous;
+            }
+        }
+
+        /**
+         * @brief Returns the atom of @p str, interning a copy of it first if
+         * the table has not seen it yet.
+         */
+        Atom Intern(StringView str)
+        {
+            if (str.Empty()) return {};
+
+            const usize hash = Hash<StringView>{}(str);
+            if (auto entry = Lookup(m_Slots.Load(MemoryOrder::eAcquire), str,
+                                    hash))
+                return Atom(entry);
+
+            ScopedLock guard(m_Lock);
+            // Another thread may have interned it since the lookup above
+            Slots*      slots = m_Slots.Load(MemoryOrder::eRelaxed);
+            if (auto entry = Lookup(slots, str, hash)) return Atom(entry);
+
+            usize size = m_Size.Load(MemoryOrder::eRelaxed) + 1;
+            if (size * 4 > (slots->Mask + 1) * 3) slots = Grow(slots);
+
+            auto entry = Allocate(str, hash);
+            Insert(slots, entry, MemoryOrder::eRelease);
+            m_Size.Store(size, MemoryOrder::eRelaxed);
+
+            return Atom(entry);
+        }
+        /**
+         * @brief Returns the atom of @p str if it was interned, without
+         * interning it otherwise.
+         */
+        Optional<Atom> Find(StringView str) const
+        {
+            if (str.Empty()) return Atom();
+
+            auto entry = Lookup(m_Slots.Load(MemoryOrder::eAcquire), str,
+                                Hash<StringView>{}(str));
+            if (!entry) return NullOpt;
+
+            return Atom(entry);
+        }
+
+        /// Number of distinct non-empty strings interned
+        usize Size() const { return m_Size.Load(MemoryOrder::eRelaxed); }
+
+      private:
+        using Entry = Detail::AtomEntry;
+
+        struct Slots
+        {
+            usize                 Mask;
+            Atomic<const Entry*>* Entries;
+            // The array this one replaced, freed along with the table
+            Slots*                Retired;
+        };
+
+        Atomic<Slots*> m_Slots;
+        Lock           m_Lock;
+        Atomic<usize>  m_Size      = 0;
+
+        // The arena: each block starts with a pointer to the previous one
+        u8*            m_Block     = nullptr;
+        usize          m_BlockUsed = 0;
+        usize          m_BlockSize = 0;
+
+        static Slots*  AllocateSlots(usize capacity)
+        {
+            return new Slots{capacity - 1,
+                             new Atomic<const Entry*>[capacity](), nullptr};
+        }
+
+        static const Entry* Lookup(const Slots* slots, StringView str,
+                                   usize hash)
+        {
+            for (usize i = hash & slots->Mask;; i = (i + 1) & slots->Mask)
+            {
+                auto entry = slots->Entries[i].Load(MemoryOrder::eAcquire);
+                if (!entry) return nullptr;
+
+                if (entry->Hash == hash && entry->Size == str.Size()
+                    && CharTraits<char>::Compare(entry->Data(), str.Raw(),
+                                                 str.Size())
+                           == 0)
+                    return entry;
+            }
+        }
+        static void Insert(Slots* slots, const Entry* entry, MemoryOrder order)
+        {
+            usize i = entry->Hash & slots->Mask;
+            while (slots->Entries[i].Load(MemoryOrder::eRelaxed))
+                i = (i + 1) & slots->Mask;
+
+            slots->Entries[i].Store(entry, order);
+        }
+
+        Slots* Grow(Slots* slots)
+        {
+            usize  capacity = (slots->Mask + 1) * 2;
+            Slots* grown    = AllocateSlots(capacity);
+            for (usize i = 0; i <= slots->Mask; ++i)
+                if (auto entry = slots->Entries[i].Load(MemoryOrder::eRelaxed))
+                    Insert(grown, entry, MemoryOrder::eRelaxed);
+
+            grown->Retired = slots;
+            m_Slots.Store(grown, MemoryOrder::eRelease);
+
+            return grown;
+        }
+        const Entry* Allocate(StringView str, usize hash)
+        {
+            constexpr usize HEADER = sizeof(u8*);
+
+            usize           size
+                = (sizeof(Entry) + str.Size() + alignof(Entry) - 1)
+                & ~(alignof(Entry) - 1);
+            Entry* entry = nullptr;
+            if (HEADER + size > BLOCK_SIZE)
+            {
+                // Strings that do not fit a block get one of their own,
+                // linked behind the current block, which keeps serving the
+                // smaller ones
+                u8*  block = new u8[HEADER + size];
+                u8** next  = m_Block ? reinterpret_cast<u8**>(m_Block)
+                                     : &m_Block;
+                *reinterpret_cast<u8**>(block) = *next;
+                *next                          = block;
+
+                if (m_Block == block) m_BlockUsed = m_BlockSize = HEADER + size;
+                entry = reinterpret_cast<Entry*>(block + HEADER);
+            }
+            else
+            {
+                if (m_BlockUsed + size > m_BlockSize)
+                {
+                    u8* block = new u8[BLOCK_SIZE];
+                    *reinterpret_cast<u8**>(block) = m_Block;
+
+                    m_Block                        = block;
+                    m_BlockUsed                    = HEADER;
+                    m_BlockSize                    = BLOCK_SIZE;
+                }
+
+                entry = reinterpret_cast<Entry*>(m_Block + m_BlockUsed);
+                m_BlockUsed += size;
+            }
+
+            entry->Hash = hash;
+            entry->Size = str.Size();
+            CharTraits<char>::Copy(const_cast<char*>(entry->Data()), str.Raw(),
+                                   str.Size());
+
+            return entry;
+        }
+    };
+
+    template <>
+    struct Hash<Atom> : public HashBase<usize, Atom>
+    {
+        constexpr usize operator()(Atom atom) const PM_NOEXCEPT
+        {
+            return atom.Hash();
+        }
+    };
+}; // namespace Prism
+
+#if PRISM_USE_NAMESPACE != 0
+using Prism::Atom;
+using Prism::AtomTable;
+#endif
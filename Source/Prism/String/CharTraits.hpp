@@ -81,7 +81,7 @@ namespace Prism
             if (count == 0) return dest;
             if (IsConstantEvaluated())
             {
-                for (usize i = 0; i < count; ++i) ConstructAt(dest + i, src[i]);
+                for (usize i = 0; i < count; ++i) dest[i] = src[i];
                 return dest;
             }
             Memory::Copy(dest, src, count * sizeof(CharType));
@@ -6,7 +6,18 @@
  */
 #pragma once
 
+#include <Prism/Core/Bits.hpp>
 #include <Prism/Core/Concepts.hpp>
+#include <Prism/Core/Platform.hpp>
+#include <Prism/Memory/Memory.hpp>
+
+#if PRISM_TARGET_CRYPTIX == 0                                                  \
+    && (PRISM_SIMD_SSE2_PRESENT || PRISM_SIMD_NEON_PRESENT)
+    #include <Prism/Utility/SimdIntrinsics.hpp>
+    #define PRISM_CODE_POINTS_SIMD 1
+#else
+    #define PRISM_CODE_POINTS_SIMD 0
+#endif
 
 namespace Prism
 {
@@ -91,6 +102,1059 @@ namespace Prism
             c = ToLower(c);
             return IsHexDigit(c) ? 10 + c - 'a' : 0;
         }
+
+        template <typename T>
+        concept Utf8CodeUnit = IsIntegralV<T> && sizeof(T) == 1;
+        template <typename T>
+        concept Utf16CodeUnit = IsIntegralV<T> && sizeof(T) == 2;
+        template <typename T>
+        concept Utf32CodeUnit = IsIntegralV<T> && sizeof(T) == 4;
+        /// A string or view of UTF-8 code units, e.g. StringView or U8String
+        template <typename S>
+        concept Utf8String    = requires(const S& string) {
+            string.Size();
+            requires Utf8CodeUnit<RemoveCvRefType<decltype(*string.Raw())>>;
+        };
+
+        constexpr char32_t MAX_CODE_POINT        = 0x10ffff;
+        constexpr char32_t REPLACEMENT_CHARACTER = 0xfffd;
+
+        /**
+         * @brief Reasons a sequence of code units is not valid Unicode.
+         */
+        enum class UnicodeError
+        {
+            eNone,
+            /// A byte that can never occur in UTF-8 (0xf8...0xff)
+            eHeaderBits,
+            /// A sequence cut short by a missing continuation byte
+            eTooShort,
+            /// A continuation byte without a lead byte
+            eTooLong,
+            /// A code point encoded with more bytes than it needs
+            eOverlong,
+            /// A code point above U+10FFFF
+            eTooLarge,
+            /// An encoded surrogate, or an unpaired UTF-16 surrogate
+            eSurrogate,
+            /// The destination is too small for the converted text
+            eOutputTooSmall,
+        };
+
+        /**
+         * @brief Outcome of validating or transcoding a buffer.
+         */
+        struct UnicodeResult
+        {
+            UnicodeError   Error   = UnicodeError::eNone;
+            /// Code units consumed; on failure, where the bad sequence starts
+            usize          Read    = 0;
+            /// Code units stored in the destination
+            usize          Written = 0;
+
+            constexpr bool IsValid() const
+            {
+                return Error == UnicodeError::eNone;
+            }
+            constexpr explicit operator bool() const { return IsValid(); }
+        };
+
+        /// Number of bytes UTF-8 needs for @p codePoint
+        constexpr usize Utf8Length(char32_t codePoint)
+        {
+            return codePoint < 0x80      ? 1
+                 : codePoint < 0x800     ? 2
+                 : codePoint < 0x10000   ? 3
+                                         : 4;
+        }
+
+        namespace Detail
+        {
+            template <typename T>
+            using CodeUnitBits = ConditionalType<
+                sizeof(T) == 1, u8, ConditionalType<sizeof(T) == 2, u16, u32>>;
+
+            constexpr bool IsContinuation(u8 byte)
+            {
+                return (byte & 0xc0) == 0x80;
+            }
+
+            // Table 3-7 of the Unicode standard: the range allowed for the
+            // second byte depends on the lead byte and rules out overlong
+            // forms, surrogates and values past U+10FFFF
+            template <typename U>
+            constexpr UnicodeError DecodeUtf8(const U* units, usize size,
+                                              char32_t& codePoint,
+                                              usize&    length)
+            {
+                const u8     lead       = static_cast<u8>(units[0]);
+                u8           low        = 0x80;
+                u8           high       = 0xbf;
+                UnicodeError rangeError = UnicodeError::eNone;
+
+                if (lead < 0x80)
+                {
+                    codePoint = lead;
+                    length    = 1;
+                    return UnicodeError::eNone;
+                }
+                if (lead < 0xc0) return UnicodeError::eTooLong;
+                if (lead < 0xc2) return UnicodeError::eOverlong;
+                if (lead < 0xe0)
+                {
+                    length    = 2;
+                    codePoint = lead & 0x1f;
+                }
+                else if (lead < 0xf0)
+                {
+                    length    = 3;
+                    codePoint = lead & 0x0f;
+                    if (lead == 0xe0)
+                        low = 0xa0, rangeError = UnicodeError::eOverlong;
+                    else if (lead == 0xed)
+                        high = 0x9f, rangeError = UnicodeError::eSurrogate;
+                }
+                else if (lead < 0xf5)
+                {
+                    length    = 4;
+                    codePoint = lead & 0x07;
+                    if (lead == 0xf0)
+                        low = 0x90, rangeError = UnicodeError::eOverlong;
+                    else if (lead == 0xf4)
+                        high = 0x8f, rangeError = UnicodeError::eTooLarge;
+                }
+                else
+                    return lead < 0xf8 ? UnicodeError::eTooLarge
+                                       : UnicodeError::eHeaderBits;
+
+                const u8 second = size > 1 ? static_cast<u8>(units[1]) : 0;
+                if (!IsContinuation(second)) return UnicodeError::eTooShort;
+                if (second < low || second > high) return rangeError;
+
+                codePoint = (codePoint << 6) | (second & 0x3f);
+                for (usize i = 2; i < length; ++i)
+                {
+                    const u8 byte = i < size ? static_cast<u8>(units[i]) : 0;
+                    if (!IsContinuation(byte)) return UnicodeError::eTooShort;
+
+                    codePoint = (codePoint << 6) | (byte & 0x3f);
+                }
+
+                return UnicodeError::eNone;
+            }
+            template <typename U>
+            constexpr UnicodeError DecodeUtf16(const U* units, usize size,
+                                               char32_t& codePoint,
+                                               usize&    length)
+            {
+                const char32_t first = static_cast<u16>(units[0]);
+
+                codePoint            = first;
+                length               = 1;
+                if (first < 0xd800 || first > 0xdfff)
+                    return UnicodeError::eNone;
+                if (first > 0xdbff || size < 2) return UnicodeError::eSurrogate;
+
+                const char32_t second = static_cast<u16>(units[1]);
+                if (second < 0xdc00 || second > 0xdfff)
+                    return UnicodeError::eSurrogate;
+
+                codePoint = 0x10000 + ((first - 0xd800) << 10)
+                          + (second - 0xdc00);
+                length = 2;
+                return UnicodeError::eNone;
+            }
+            template <typename U>
+            constexpr UnicodeError DecodeUtf32(const U* units, usize,
+                                               char32_t& codePoint,
+                                               usize&    length)
+            {
+                codePoint = static_cast<u32>(units[0]);
+                length    = 1;
+
+                if (codePoint > MAX_CODE_POINT) return UnicodeError::eTooLarge;
+                if (codePoint >= 0xd800 && codePoint <= 0xdfff)
+                    return UnicodeError::eSurrogate;
+                return UnicodeError::eNone;
+            }
+            template <typename U>
+            constexpr UnicodeError Decode(const U* units, usize size,
+                                          char32_t& codePoint, usize& length)
+            {
+                if constexpr (sizeof(U) == 1)
+                    return DecodeUtf8(units, size, codePoint, length);
+                else if constexpr (sizeof(U) == 2)
+                    return DecodeUtf16(units, size, codePoint, length);
+                else return DecodeUtf32(units, size, codePoint, length);
+            }
+
+            template <typename U>
+            constexpr usize EncodedLength(char32_t codePoint)
+            {
+                if constexpr (sizeof(U) == 1) return Utf8Length(codePoint);
+                else if constexpr (sizeof(U) == 2)
+                    return codePoint < 0x10000 ? 1 : 2;
+                else return 1;
+            }
+            template <typename U>
+            constexpr usize Encode(char32_t codePoint, U* out)
+            {
+                if constexpr (sizeof(U) == 4)
+                {
+                    out[0] = static_cast<U>(codePoint);
+                    return 1;
+                }
+                else if constexpr (sizeof(U) == 2)
+                {
+                    if (codePoint < 0x10000)
+                    {
+                        out[0] = static_cast<U>(codePoint);
+                        return 1;
+                    }
+
+                    codePoint -= 0x10000;
+                    out[0] = static_cast<U>(0xd800 + (codePoint >> 10));
+                    out[1] = static_cast<U>(0xdc00 + (codePoint & 0x3ff));
+                    return 2;
+                }
+                else
+                {
+                    const usize length = Utf8Length(codePoint);
+                    if (length == 1)
+                    {
+                        out[0] = static_cast<U>(codePoint);
+                        return 1;
+                    }
+
+                    constexpr u8 LEAD_BITS[] = {0, 0, 0xc0, 0xe0, 0xf0};
+                    for (usize i = length - 1; i > 0; --i, codePoint >>= 6)
+                        out[i] = static_cast<U>(0x80 | (codePoint & 0x3f));
+                    out[0] = static_cast<U>(LEAD_BITS[length] | codePoint);
+                    return length;
+                }
+            }
+
+            constexpr u64 SWAR_ONES       = 0x0101010101010101ull;
+            constexpr u64 ASCII_HIGH_BITS = 0x8080808080808080ull;
+
+            // Sets the top bit of every byte of @p word in [low, high], an
+            // ASCII range; bytes past 0x7f never match. Adding to the low
+            // seven bits of each byte cannot carry into its neighbour
+            constexpr u64 SwarInRange(u64 word, u8 low, u8 high)
+            {
+                const u64 heptets   = word & ~ASCII_HIGH_BITS;
+                const u64 aboveLow  = heptets + SWAR_ONES * (0x80 - low);
+                const u64 aboveHigh = heptets + SWAR_ONES * (0x7f - high);
+
+                return (aboveLow ^ aboveHigh) & ~word & ASCII_HIGH_BITS;
+            }
+            // Index of the first/last byte, in memory order, whose top bit
+            // is set in @p mask
+            PM_ALWAYS_INLINE usize FirstFlaggedByte(u64 mask)
+            {
+                return (Endian::eNative == Endian::eLittle
+                            ? CountRightZero(mask)
+                            : CountLeftZero(mask))
+                     / 8;
+            }
+            PM_ALWAYS_INLINE usize LastFlaggedByte(u64 mask)
+            {
+                return (Endian::eNative == Endian::eLittle
+                            ? 63 - CountLeftZero(mask)
+                            : 63 - CountRightZero(mask))
+                     / 8;
+            }
+
+            // Length of the leading run of ASCII bytes, checked 32 or 16
+            // bytes at a time with vectors, or 8 at a time in a register
+            inline usize  AsciiPrefix(const u8* bytes, usize size)
+            {
+                usize i = 0;
+#if PRISM_CODE_POINTS_SIMD
+                for (; i + 32 <= size; i += 32)
+                {
+                    u8x16 lanes = LoadVector<u8x16>(bytes + i)
+                                | LoadVector<u8x16>(bytes + i + 16);
+                    if (MoveMask(BitCast<i8x16>(lanes))) break;
+                }
+                for (; i + 16 <= size; i += 16)
+                {
+                    u32 mask = MoveMask(LoadVector<i8x16>(bytes + i));
+                    if (mask) return i + CountRightZero(mask);
+                }
+#endif
+                for (; i + 8 <= size; i += 8)
+                {
+                    u64 word = Memory::LoadUnaligned<u64>(bytes + i)
+                             & ASCII_HIGH_BITS;
+                    if (word) return i + FirstFlaggedByte(word);
+                }
+
+                while (i < size && bytes[i] < 0x80) ++i;
+                return i;
+            }
+
+#if PRISM_CODE_POINTS_SIMD
+            template <typename V>
+            PM_ALWAYS_INLINE bool IsAsciiVector(V lanes)
+            {
+                constexpr ElementOfType<V> NON_ASCII
+                    = static_cast<ElementOfType<V>>(~0x7f);
+
+                return MoveMask(BitCast<i8x16>((lanes & NON_ASCII) == 0))
+                    == 0xffff;
+            }
+
+            // Converts whole blocks of sixteen ASCII code units to another
+            // width, stopping at the first block with anything else in it
+            template <typename From, typename To>
+            inline usize ConvertAsciiBlocks(const From* source, usize size,
+                                            To* destination)
+            {
+                constexpr usize LANES = 16 / sizeof(From);
+                using FromVector      = VectorOfType<From, LANES>;
+
+                usize i               = 0;
+                for (; i + 16 <= size; i += 16)
+                {
+                    FromVector blocks[sizeof(From)];
+                    for (usize b = 0; b < sizeof(From); ++b)
+                        blocks[b]
+                            = LoadVector<FromVector>(source + i + b * LANES);
+
+                    FromVector all = blocks[0];
+                    for (usize b = 1; b < sizeof(From); ++b) all |= blocks[b];
+                    if (!IsAsciiVector(all)) break;
+
+                    To* out = destination + i;
+                    if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+                    {
+                        u16x8 widened[] = {WidenLow(all), WidenHigh(all)};
+                        __builtin_memcpy(out, widened, sizeof(widened));
+                    }
+                    else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+                    {
+                        u16x8 low       = WidenLow(all);
+                        u16x8 high      = WidenHigh(all);
+                        u32x4 widened[] = {WidenLow(low), WidenHigh(low),
+                                           WidenLow(high), WidenHigh(high)};
+                        __builtin_memcpy(out, widened, sizeof(widened));
+                    }
+                    else if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+                    {
+                        u8x16 narrowed = Narrow(blocks[0], blocks[1]);
+                        __builtin_memcpy(out, &narrowed, sizeof(narrowed));
+                    }
+                    else
+                    {
+                        static_assert(sizeof(From) == 4 && sizeof(To) == 1);
+
+                        u8x16 narrowed
+                            = Narrow(Narrow(blocks[0], blocks[1]),
+                                     Narrow(blocks[2], blocks[3]));
+                        __builtin_memcpy(out, &narrowed, sizeof(narrowed));
+                    }
+                }
+
+                return i;
+            }
+#endif
+
+            template <typename From, typename To>
+            constexpr UnicodeResult Transcode(const From* source, usize size,
+                                              To* destination, usize capacity)
+            {
+                usize read    = 0;
+                usize written = 0;
+                while (read < size)
+                {
+#if PRISM_CODE_POINTS_SIMD
+                    if (!IsConstantEvaluated()
+                        && static_cast<CodeUnitBits<From>>(source[read]) < 0x80)
+                    {
+                        usize converted = ConvertAsciiBlocks(
+                            reinterpret_cast<const CodeUnitBits<From>*>(source
+                                                                        + read),
+                            Min(size - read, capacity - written),
+                            reinterpret_cast<CodeUnitBits<To>*>(destination
+                                                                + written));
+                        read += converted;
+                        written += converted;
+                        if (read == size) break;
+                    }
+#endif
+
+                    char32_t     codePoint = 0;
+                    usize        length    = 0;
+                    UnicodeError error     = Decode(source + read, size - read,
+                                                    codePoint, length);
+                    if (error != UnicodeError::eNone)
+                        return {error, read, written};
+                    if (capacity - written < EncodedLength<To>(codePoint))
+                        return {UnicodeError::eOutputTooSmall, read, written};
+
+                    written += Encode(codePoint, destination + written);
+                    read += length;
+                }
+
+                return {UnicodeError::eNone, read, written};
+            }
+            template <typename U>
+            constexpr UnicodeResult Validate(const U* units, usize size)
+            {
+                usize read = 0;
+                while (read < size)
+                {
+                    if constexpr (sizeof(U) == 1)
+                    {
+                        if (!IsConstantEvaluated()
+                            && static_cast<u8>(units[read]) < 0x80)
+                        {
+                            read += AsciiPrefix(
+                                reinterpret_cast<const u8*>(units + read),
+                                size - read);
+                            continue;
+                        }
+                    }
+
+                    char32_t     codePoint = 0;
+                    usize        length    = 0;
+                    UnicodeError error
+                        = Decode(units + read, size - read, codePoint, length);
+                    if (error != UnicodeError::eNone) return {error, read, 0};
+
+                    read += length;
+                }
+
+                return {UnicodeError::eNone, size, 0};
+            }
+        }; // namespace Detail
+
+        /**
+         * @brief Decodes the code point at the front of @p units.
+         * @return The number of bytes it takes, or 0 when they are not valid
+         * UTF-8
+         */
+        template <Utf8CodeUnit U>
+        constexpr usize DecodeUtf8(const U* units, usize size,
+                                   char32_t& codePoint)
+        {
+            usize length = 0;
+            if (size == 0
+                || Detail::DecodeUtf8(units, size, codePoint, length)
+                       != UnicodeError::eNone)
+                return 0;
+
+            return length;
+        }
+        /**
+         * @brief Encodes @p codePoint, a Unicode scalar value, into the up to
+         * four bytes at @p out.
+         * @return The number of bytes written
+         */
+        template <Utf8CodeUnit U>
+        constexpr usize EncodeUtf8(char32_t codePoint, U* out)
+        {
+            return Detail::Encode(codePoint, out);
+        }
+
+        /**
+         * @brief Checks that @p units are well-formed UTF-8.
+         *
+         * Runs of ASCII are skipped 32 bytes at a time (8 without SIMD);
+         * other sequences are decoded following Table 3-7 of the Unicode
+         * standard, so overlong forms, surrogates and values past U+10FFFF
+         * are rejected. On failure, Read is the offset of the bad sequence.
+         */
+        template <Utf8CodeUnit U>
+        constexpr UnicodeResult ValidateUtf8(const U* units, usize size)
+        {
+            return Detail::Validate(units, size);
+        }
+        template <Utf16CodeUnit U>
+        constexpr UnicodeResult ValidateUtf16(const U* units, usize size)
+        {
+            return Detail::Validate(units, size);
+        }
+        template <Utf32CodeUnit U>
+        constexpr UnicodeResult ValidateUtf32(const U* units, usize size)
+        {
+            return Detail::Validate(units, size);
+        }
+        template <Utf8String S>
+        constexpr UnicodeResult ValidateUtf8(const S& string)
+        {
+            return Detail::Validate(string.Raw(), string.Size());
+        }
+        template <Utf8CodeUnit U>
+        constexpr bool IsValidUtf8(const U* units, usize size)
+        {
+            return Detail::Validate(units, size).IsValid();
+        }
+        template <Utf8String S>
+        constexpr bool IsValidUtf8(const S& string)
+        {
+            return ValidateUtf8(string).IsValid();
+        }
+
+        /**
+         * @brief Number of UTF-16 code units the valid UTF-8 in @p units
+         * converts to: one per lead byte, two for four-byte sequences.
+         */
+        template <Utf8CodeUnit U>
+        constexpr usize Utf16LengthFromUtf8(const U* units, usize size)
+        {
+            usize count = 0;
+            usize i     = 0;
+#if PRISM_CODE_POINTS_SIMD
+            if (!IsConstantEvaluated())
+            {
+                const auto* bytes      = reinterpret_cast<const u8*>(units);
+                // Signed, continuation bytes are -128...-65 and the leads of
+                // four-byte sequences -16...-1
+                const i8x16 continuation = i8x16{} + i8(-65);
+                const i8x16 fourByte     = i8x16{} + i8(-17);
+                const i8x16 zero         = i8x16{};
+                for (; i + 16 <= size; i += 16)
+                {
+                    i8x16 lanes = LoadVector<i8x16>(bytes + i);
+                    count += PopCount(MoveMask(lanes > continuation))
+                           + PopCount(MoveMask((lanes > fourByte)
+                                               & (lanes < zero)));
+                }
+            }
+#endif
+            for (; i < size; ++i)
+            {
+                const u8 byte = static_cast<u8>(units[i]);
+                count += !Detail::IsContinuation(byte) + (byte >= 0xf0);
+            }
+
+            return count;
+        }
+        /**
+         * @brief Number of code points in the valid UTF-8 in @p units.
+         */
+        template <Utf8CodeUnit U>
+        constexpr usize Utf32LengthFromUtf8(const U* units, usize size)
+        {
+            usize count = 0;
+            usize i     = 0;
+#if PRISM_CODE_POINTS_SIMD
+            if (!IsConstantEvaluated())
+            {
+                const auto* bytes = reinterpret_cast<const u8*>(units);
+                const i8x16 continuation = i8x16{} + i8(-65);
+                for (; i + 16 <= size; i += 16)
+                    count += PopCount(
+                        MoveMask(LoadVector<i8x16>(bytes + i) > continuation));
+            }
+#endif
+            for (; i < size; ++i)
+                count += !Detail::IsContinuation(static_cast<u8>(units[i]));
+
+            return count;
+        }
+        /// Number of bytes the valid UTF-16 in @p units converts to
+        template <Utf16CodeUnit U>
+        constexpr usize Utf8LengthFromUtf16(const U* units, usize size)
+        {
+            usize count = 0;
+            for (usize i = 0; i < size; ++i)
+            {
+                const u16 unit = static_cast<u16>(units[i]);
+                // Each half of a surrogate pair accounts for two bytes
+                count += unit < 0x80    ? 1
+                       : unit < 0x800   ? 2
+                       : (unit & 0xf800) == 0xd800 ? 2
+                                                   : 3;
+            }
+
+            return count;
+        }
+        /// Number of bytes the valid UTF-32 in @p units converts to
+        template <Utf32CodeUnit U>
+        constexpr usize Utf8LengthFromUtf32(const U* units, usize size)
+        {
+            usize count = 0;
+            for (usize i = 0; i < size; ++i)
+                count += Utf8Length(static_cast<u32>(units[i]));
+
+            return count;
+        }
+
+        /**
+         * @brief Transcodes UTF-8 to UTF-16, validating it on the way.
+         *
+         * ASCII is widened sixteen characters at a time when SIMD is
+         * available. Conversion stops at the first invalid sequence or when
+         * @p capacity is exhausted; Read and Written tell how far it got.
+         * Utf16LengthFromUtf8() sizes the destination exactly.
+         */
+        template <Utf8CodeUnit From, Utf16CodeUnit To>
+        constexpr UnicodeResult ConvertUtf8ToUtf16(const From* source,
+                                                   usize size, To* destination,
+                                                   usize capacity)
+        {
+            return Detail::Transcode(source, size, destination, capacity);
+        }
+        /// @copydoc ConvertUtf8ToUtf16
+        template <Utf8CodeUnit From, Utf32CodeUnit To>
+        constexpr UnicodeResult ConvertUtf8ToUtf32(const From* source,
+                                                   usize size, To* destination,
+                                                   usize capacity)
+        {
+            return Detail::Transcode(source, size, destination, capacity);
+        }
+        /**
+         * @brief Transcodes UTF-16 to UTF-8, rejecting unpaired surrogates.
+         * Utf8LengthFromUtf16() sizes the destination exactly.
+         */
+        template <Utf16CodeUnit From, Utf8CodeUnit To>
+        constexpr UnicodeResult ConvertUtf16ToUtf8(const From* source,
+                                                   usize size, To* destination,
+                                                   usize capacity)
+        {
+            return Detail::Transcode(source, size, destination, capacity);
+        }
+        /**
+         * @brief Transcodes UTF-32 to UTF-8, rejecting surrogates and values
+         * past U+10FFFF. Utf8LengthFromUtf32() sizes the destination exactly.
+         */
+        template <Utf32CodeUnit From, Utf8CodeUnit To>
+        constexpr UnicodeResult ConvertUtf32ToUtf8(const From* source,
+                                                   usize size, To* destination,
+                                                   usize capacity)
+        {
+            return Detail::Transcode(source, size, destination, capacity);
+        }
+
+        /**
+         * @brief ASCII character classes, combinable with '|'. Bytes past
+         * 0x7f belong to no class.
+         */
+        enum class CharacterClass : u16
+        {
+            eNone         = 0,
+            eLower        = Bit(0),
+            eUpper        = Bit(1),
+            eDigit        = Bit(2),
+            eHexDigit     = Bit(3),
+            eSpace        = Bit(4),
+            eBlank        = Bit(5),
+            ePunctuation  = Bit(6),
+            eControl      = Bit(7),
+
+            eAlpha        = eLower | eUpper,
+            eAlphanumeric = eAlpha | eDigit,
+            eGraph        = eAlphanumeric | ePunctuation,
+        };
+        constexpr CharacterClass operator|(CharacterClass lhs,
+                                           CharacterClass rhs)
+        {
+            return static_cast<CharacterClass>(ToUnderlying(lhs)
+                                               | ToUnderlying(rhs));
+        }
+        constexpr CharacterClass operator&(CharacterClass lhs,
+                                           CharacterClass rhs)
+        {
+            return static_cast<CharacterClass>(ToUnderlying(lhs)
+                                               & ToUnderlying(rhs));
+        }
+
+        namespace Detail
+        {
+            // The classes of every byte, derived from the predicates above
+            // so that the table and the bulk operations cannot disagree
+            // with them
+            struct ClassTable
+            {
+                u16                 Classes[256]{};
+
+                constexpr const u16& operator[](usize c) const
+                {
+                    return Classes[c];
+                }
+            };
+            constexpr ClassTable CHARACTER_CLASSES = []
+            {
+                ClassTable table;
+                for (u32 c = 0; c < 0x80; ++c)
+                {
+                    table.Classes[c]
+                        = (IsLower(c) ? Bit(0) : 0) | (IsUpper(c) ? Bit(1) : 0)
+                        | (IsDigit(c) ? Bit(2) : 0)
+                        | (IsHexDigit(c) ? Bit(3) : 0)
+                        | (IsSpace(c) ? Bit(4) : 0) | (IsBlank(c) ? Bit(5) : 0)
+                        | (IsPunctuation(c) ? Bit(6) : 0)
+                        | (IsControl(c) ? Bit(7) : 0);
+                }
+
+                return table;
+            }();
+
+            constexpr usize MAX_CLASS_RANGES = 16;
+            // A character class as the ranges of bytes it spans, which the
+            // vector and SWAR loops test with one subtraction each
+            struct ByteRanges
+            {
+                u8    Low[MAX_CLASS_RANGES]{};
+                u8    High[MAX_CLASS_RANGES]{};
+                usize Count = 0;
+            };
+            constexpr ByteRanges RangesOf(CharacterClass classes)
+            {
+                ByteRanges ranges;
+                for (u32 c = 0; c < 0x80; ++c)
+                {
+                    if (!(CHARACTER_CLASSES[c] & ToUnderlying(classes)))
+                        continue;
+
+                    if (ranges.Count && ranges.High[ranges.Count - 1] == c - 1)
+                        ranges.High[ranges.Count - 1] = c;
+                    else
+                    {
+                        ranges.Low[ranges.Count]    = c;
+                        ranges.High[ranges.Count++] = c;
+                    }
+                }
+
+                return ranges;
+            }
+
+            // Flips the case of the letters between @p first and @p last
+            // (either 'a'/'z' or 'A'/'Z'), 32/16 bytes per step with vectors
+            // and 8 with SWAR
+            template <u8 First, u8 Last>
+            inline void FlipCase(u8* bytes, usize size)
+            {
+                usize i = 0;
+#if PRISM_CODE_POINTS_SIMD
+                for (; i + 16 <= size; i += 16)
+                {
+                    u8x16 lanes   = LoadVector<u8x16>(bytes + i);
+                    u8x16 letters = BitCast<u8x16>(u8x16(lanes - First)
+                                                   <= u8(Last - First));
+                    lanes ^= letters & 0x20;
+                    __builtin_memcpy(bytes + i, &lanes, sizeof(lanes));
+                }
+#endif
+                for (; i + 8 <= size; i += 8)
+                {
+                    u64 word = Memory::LoadUnaligned<u64>(bytes + i);
+                    word ^= SwarInRange(word, First, Last) >> 2;
+                    __builtin_memcpy(bytes + i, &word, sizeof(word));
+                }
+                for (; i < size; ++i)
+                    if (bytes[i] >= First && bytes[i] <= Last) bytes[i] ^= 0x20;
+            }
+
+#if PRISM_CODE_POINTS_SIMD
+            PM_ALWAYS_INLINE u32 SpaceMask(u8x16 lanes)
+            {
+                return MoveMask(BitCast<i8x16>(
+                    (lanes == ' ') | (u8x16(lanes - '\t') <= u8('\r' - '\t'))));
+            }
+            PM_ALWAYS_INLINE u8x16 ToLowerVector(u8x16 lanes)
+            {
+                u8x16 upper
+                    = BitCast<u8x16>(u8x16(lanes - 'A') <= u8('Z' - 'A'));
+                return lanes | (upper & 0x20);
+            }
+#endif
+            constexpr u64 SwarSpaceMask(u64 word)
+            {
+                return SwarInRange(word, ' ', ' ')
+                     | SwarInRange(word, '\t', '\r');
+            }
+            constexpr u64 SwarToLower(u64 word)
+            {
+                return word | (SwarInRange(word, 'A', 'Z') >> 2);
+            }
+
+            inline usize FindFirstNonSpace(const u8* bytes, usize size)
+            {
+                usize i = 0;
+#if PRISM_CODE_POINTS_SIMD
+                for (; i + 16 <= size; i += 16)
+                {
+                    u32 other = ~SpaceMask(LoadVector<u8x16>(bytes + i))
+                              & 0xffff;
+                    if (other) return i + CountRightZero(other);
+                }
+#endif
+                for (; i + 8 <= size; i += 8)
+                {
+                    u64 other = ~SwarSpaceMask(Memory::LoadUnaligned<u64>(
+                                    bytes + i))
+                              & ASCII_HIGH_BITS;
+                    if (other) return i + FirstFlaggedByte(other);
+                }
+                for (; i < size; ++i)
+                    if (!IsSpace(bytes[i])) return i;
+
+                return usize(-1);
+            }
+            inline usize FindLastNonSpace(const u8* bytes, usize size)
+            {
+#if PRISM_CODE_POINTS_SIMD
+                for (; size >= 16; size -= 16)
+                {
+                    u32 other
+                        = ~SpaceMask(LoadVector<u8x16>(bytes + size - 16))
+                        & 0xffff;
+                    if (other) return size - 16 + 31 - CountLeftZero(other);
+                }
+#endif
+                for (; size >= 8; size -= 8)
+                {
+                    u64 other = ~SwarSpaceMask(Memory::LoadUnaligned<u64>(
+                                    bytes + size - 8))
+                              & ASCII_HIGH_BITS;
+                    if (other) return size - 8 + LastFlaggedByte(other);
+                }
+                while (size-- > 0)
+                    if (!IsSpace(bytes[size])) return size;
+
+                return usize(-1);
+            }
+
+            inline usize CountClass(const u8* bytes, usize size,
+                                    CharacterClass classes)
+            {
+                usize count = 0;
+                usize i     = 0;
+                if (size >= 8)
+                {
+                    const ByteRanges ranges = RangesOf(classes);
+#if PRISM_CODE_POINTS_SIMD
+                    for (; i + 16 <= size; i += 16)
+                    {
+                        u8x16 lanes = LoadVector<u8x16>(bytes + i);
+                        u8x16 match{};
+                        for (usize r = 0; r < ranges.Count; ++r)
+                            match |= BitCast<u8x16>(
+                                u8x16(lanes - ranges.Low[r])
+                                <= u8(ranges.High[r] - ranges.Low[r]));
+
+                        count += PopCount(MoveMask(BitCast<i8x16>(match)));
+                    }
+#endif
+                    for (; i + 8 <= size; i += 8)
+                    {
+                        u64 word  = Memory::LoadUnaligned<u64>(bytes + i);
+                        u64 match = 0;
+                        for (usize r = 0; r < ranges.Count; ++r)
+                            match |= SwarInRange(word, ranges.Low[r],
+                                                 ranges.High[r]);
+
+                        count += PopCount(match);
+                    }
+                }
+                for (; i < size; ++i)
+                    count
+                        += (CHARACTER_CLASSES[bytes[i]] & ToUnderlying(classes))
+                        != 0;
+
+                return count;
+            }
+
+            // Index of the first byte at which @p lhs and @p rhs differ once
+            // upper-case letters are folded, or @p size
+            inline usize MismatchIgnoreCase(const u8* lhs, const u8* rhs,
+                                            usize size)
+            {
+                usize i = 0;
+#if PRISM_CODE_POINTS_SIMD
+                for (; i + 16 <= size; i += 16)
+                {
+                    u8x16 left  = ToLowerVector(LoadVector<u8x16>(lhs + i));
+                    u8x16 right = ToLowerVector(LoadVector<u8x16>(rhs + i));
+                    u32   other
+                        = ~MoveMask(BitCast<i8x16>(left == right)) & 0xffff;
+                    if (other) return i + CountRightZero(other);
+                }
+#endif
+                for (; i + 8 <= size; i += 8)
+                {
+                    u64 difference
+                        = SwarToLower(Memory::LoadUnaligned<u64>(lhs + i))
+                        ^ SwarToLower(Memory::LoadUnaligned<u64>(rhs + i));
+                    if (!difference) continue;
+
+                    // Flag every non-zero byte without carrying into the
+                    // next one
+                    u64 nonZero = (((difference & ~ASCII_HIGH_BITS)
+                                    + ~ASCII_HIGH_BITS)
+                                   | difference)
+                                & ASCII_HIGH_BITS;
+                    return i + FirstFlaggedByte(nonZero);
+                }
+                for (; i < size; ++i)
+                    if (ToLower(lhs[i]) != ToLower(rhs[i])) return i;
+
+                return size;
+            }
+        }; // namespace Detail
+
+        /**
+         * @brief Whether @p c belongs to any of @p classes, looked up in the
+         * shared 256-entry class table.
+         */
+        template <typename T>
+        constexpr bool IsClass(T c, CharacterClass classes)
+        {
+            // Negative (signed char) values wrap around past 0x7f
+            const u64 value = static_cast<u64>(c);
+            return value < 0x80
+                && (Detail::CHARACTER_CLASSES[value] & ToUnderlying(classes));
+        }
+
+        /// A mutable string or span of single-byte characters
+        template <typename S>
+        concept MutableByteString = requires(S& string) {
+            string.Size();
+            requires Utf8CodeUnit<RemoveReferenceType<decltype(*string.Raw())>>;
+        };
+
+        /**
+         * @brief Converts the ASCII letters of @p data to upper case, leaving
+         * every other byte (including UTF-8 sequences) untouched.
+         */
+        template <Utf8CodeUnit C>
+        constexpr void ToUpperInPlace(C* data, usize size)
+        {
+            if (IsConstantEvaluated())
+            {
+                for (usize i = 0; i < size; ++i)
+                    data[i] = static_cast<C>(ToUpper(static_cast<u8>(data[i])));
+                return;
+            }
+
+            Detail::FlipCase<'a', 'z'>(reinterpret_cast<u8*>(data), size);
+        }
+        /// @copydoc ToUpperInPlace
+        template <MutableByteString S>
+        constexpr void ToUpperInPlace(S&& string)
+        {
+            ToUpperInPlace(string.Raw(), string.Size());
+        }
+        /**
+         * @brief Converts the ASCII letters of @p data to lower case, leaving
+         * every other byte (including UTF-8 sequences) untouched.
+         */
+        template <Utf8CodeUnit C>
+        constexpr void ToLowerInPlace(C* data, usize size)
+        {
+            if (IsConstantEvaluated())
+            {
+                for (usize i = 0; i < size; ++i)
+                    data[i] = static_cast<C>(ToLower(static_cast<u8>(data[i])));
+                return;
+            }
+
+            Detail::FlipCase<'A', 'Z'>(reinterpret_cast<u8*>(data), size);
+        }
+        /// @copydoc ToLowerInPlace
+        template <MutableByteString S>
+        constexpr void ToLowerInPlace(S&& string)
+        {
+            ToLowerInPlace(string.Raw(), string.Size());
+        }
+
+        /**
+         * @brief Index of the first character that is not whitespace (see
+         * IsSpace()), or usize(-1) when there is none.
+         */
+        template <Utf8CodeUnit C>
+        constexpr usize FindFirstNonSpace(const C* data, usize size)
+        {
+            if (!IsConstantEvaluated())
+                return Detail::FindFirstNonSpace(
+                    reinterpret_cast<const u8*>(data), size);
+
+            for (usize i = 0; i < size; ++i)
+                if (!IsSpace(static_cast<u8>(data[i]))) return i;
+            return usize(-1);
+        }
+        /**
+         * @brief Index of the last character that is not whitespace, or
+         * usize(-1) when there is none.
+         */
+        template <Utf8CodeUnit C>
+        constexpr usize FindLastNonSpace(const C* data, usize size)
+        {
+            if (!IsConstantEvaluated())
+                return Detail::FindLastNonSpace(
+                    reinterpret_cast<const u8*>(data), size);
+
+            while (size-- > 0)
+                if (!IsSpace(static_cast<u8>(data[size]))) return size;
+            return usize(-1);
+        }
+
+        /**
+         * @brief Number of characters in @p data belonging to any of
+         * @p classes.
+         */
+        template <Utf8CodeUnit C>
+        constexpr usize CountIf(const C* data, usize size,
+                                CharacterClass classes)
+        {
+            if (!IsConstantEvaluated())
+                return Detail::CountClass(reinterpret_cast<const u8*>(data),
+                                          size, classes);
+
+            usize count = 0;
+            for (usize i = 0; i < size; ++i) count += IsClass(data[i], classes);
+            return count;
+        }
+        template <Utf8String S>
+        constexpr usize CountIf(const S& string, CharacterClass classes)
+        {
+            return CountIf(string.Raw(), string.Size(), classes);
+        }
+
+        /**
+         * @brief Compares like BasicStringView::Compare(), treating ASCII
+         * upper- and lower-case letters as equal.
+         */
+        template <Utf8CodeUnit C>
+        constexpr i32 CompareIgnoreCase(const C* lhs, usize lhsSize,
+                                        const C* rhs, usize rhsSize)
+        {
+            const usize count    = Min(lhsSize, rhsSize);
+            usize       mismatch = 0;
+            if (IsConstantEvaluated())
+                while (mismatch < count
+                       && ToLower(static_cast<u8>(lhs[mismatch]))
+                              == ToLower(static_cast<u8>(rhs[mismatch])))
+                    ++mismatch;
+            else
+                mismatch = Detail::MismatchIgnoreCase(
+                    reinterpret_cast<const u8*>(lhs),
+                    reinterpret_cast<const u8*>(rhs), count);
+
+            if (mismatch < count)
+                return static_cast<i32>(
+                           ToLower(static_cast<u8>(lhs[mismatch])))
+                     - static_cast<i32>(
+                           ToLower(static_cast<u8>(rhs[mismatch])));
+            return lhsSize < rhsSize ? -1 : lhsSize > rhsSize;
+        }
+        template <Utf8CodeUnit C>
+        constexpr bool EqualsIgnoreCase(const C* lhs, usize lhsSize,
+                                        const C* rhs, usize rhsSize)
+        {
+            if (lhsSize != rhsSize) return false;
+            if (IsConstantEvaluated())
+                return CompareIgnoreCase(lhs, lhsSize, rhs, rhsSize) == 0;
+
+            return Detail::MismatchIgnoreCase(reinterpret_cast<const u8*>(lhs),
+                                              reinterpret_cast<const u8*>(rhs),
+                                              lhsSize)
+                == lhsSize;
+        }
     }; // namespace CodePoints
 }; // namespace Prism
 
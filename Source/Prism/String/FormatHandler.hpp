@@ -25,6 +25,8 @@ namespace Prism
         bool      PrintBasePrefix = false;
         bool      UpperCase       = false;
         bool      PrintAsAscii    = false;
+        /// The presentation type character, or 0 if none was given
+        char      Presentation    = '\0';
 
         enum Base
         {
@@ -34,23 +36,22 @@ namespace Prism
             eHexadecimal = 16,
         } Base
             = eDecimal;
+
+        /// A '0' flag without explicit alignment pads numbers with zeros
+        /// between the sign/base prefix and the digits
+        constexpr bool IsZeroPadded() const
+        {
+            return PaddingChar == '0' && Align == Alignment::eNone;
+        }
     };
 
-    struct FormatSpecParser
+    namespace Detail
     {
-        enum class State
-        {
-            eBegin,
-            eAlign,
-            eSign,
-            eHash,
-            eZero,
-            eWidth,
-            ePrecision,
-            eEnd,
-        };
+        // Deliberately not constexpr: reaching it while a format string is
+        // compiled turns the message into a compile-time error
+        inline void FormatStringError(const char* message) { (void)message; }
 
-        inline constexpr Alignment ParseAlign(char c)
+        constexpr Alignment ParseAlign(char c)
         {
             switch (c)
             {
@@ -62,182 +63,59 @@ namespace Prism
 
             return Alignment::eNone;
         }
-        inline constexpr usize ParseWidth(const char*& fmt)
-        {
-            usize width = 0;
-            while (StringUtils::IsDigit(*fmt))
-            {
-                width = width * 10 + (*fmt - '0');
-                ++fmt;
-            }
-
-            return width;
-        }
-        constexpr FormatSpec operator()(const char*& fmt)
-        {
-            struct
-            {
-                enum State     State = State::eBegin;
-
-                constexpr void operator()(enum State state)
-                {
-                    if (State >= state) assert("invalid format specifier");
-                    State = state;
-                }
-            } enterState;
-            FormatSpec spec;
-
-            for (;;)
-            {
-                switch (*fmt)
-                {
-                    case ':':
-                        enterState(State::eBegin);
-                        ++fmt;
-                        break;
-                    case '}': return spec;
-                    case '<':
-                    case '>':
-                    case '^':
-                        enterState(State::eAlign);
-                        spec.Align = ParseAlign(*fmt);
-                        ++fmt;
-                        break;
-                    case '0':
-                        enterState(State::eZero);
-                        spec.PaddingChar = '0';
-                        ++fmt;
-                        break;
-                    case '1' ... '9':
-                        enterState(State::eWidth);
-                        spec.Width = ParseWidth(fmt);
-                        break;
-                    case '#':
-                        enterState(State::eHash);
-                        spec.PrintBasePrefix = true;
-                        ++fmt;
-                        break;
-
-                    case 'c':
-                        enterState(State::eEnd);
-                        spec.PrintAsAscii = true;
-                        ++fmt;
-                        break;
-
-                    case 'b':
-                        enterState(State::eEnd);
-                        spec.Base = FormatSpec::eBinary;
-                        ++fmt;
-                        break;
-                    case 'o':
-                        enterState(State::eEnd);
-                        spec.Base = FormatSpec::eOctal;
-                        ++fmt;
-                        break;
-                    case 'X': spec.UpperCase = true; [[fallthrough]];
-                    case 'x':
-                        enterState(State::eEnd);
-                        spec.Base = FormatSpec::eHexadecimal;
-                        ++fmt;
-                        break;
-
-                    default: assert("Invalid format specifier");
-                }
-            }
-
-            return spec;
-        }
-    };
-    constexpr const char* ParseFormatSpec(const char* fmt, FormatSpec& spec)
-    {
-        FormatSpecParser parser;
-        spec = parser(fmt);
-
-        return fmt;
-    }
-
-    template <typename StringFormatter, typename Char, typename... Args>
-    struct FormatHandler
-    {
-        using ValueType = char;
-        BasicFormatterContext<ValueType> ParseContext;
-        StringFormatter&                 Formatter;
-
-        FormatHandler(StringFormatter& formatter, BasicStringView<Char> str,
-                      Args&&... args)
-            : ParseContext(str)
-            , Formatter(formatter)
-        {
-        }
-
-        void OnText(const ValueType* begin, const ValueType* end)
-        {
-            auto text = BasicStringView<ValueType>(begin, end - begin);
-            Formatter.Context() << text;
-        }
-        constexpr void OnError(const char* message) { assert(message); }
-        constexpr auto OnFormatSpecs(const Char* begin, const Char* end,
-                                     Args&&... args) -> const Char*
-        {
-            FormatSpec spec;
-            begin = ParseFormatSpec(begin, spec);
-            Formatter.VisitArgument(Forward<Args>(args)..., spec);
-            return begin;
-        }
-    };
-
-    template <typename Char, typename... Args>
-    class FormatStringChecker
+    }; // namespace Detail
+
+    /**
+     * @brief Parses the spec of a replacement field, [[fill]align][#][0]
+     * [width][type], starting after the ':'.
+     * @return Pointer to the closing '}'.
+     */
+    template <typename Char>
+    constexpr const Char* ParseFormatSpec(const Char* begin, const Char* end,
+                                          FormatSpec& spec)
     {
-      private:
-        using ParseContextType             = CompileFormatterContext<Char>;
-        static constexpr int ArgumentCount = sizeof...(Args);
-
-        using ParseFn                      = const Char* (*)(ParseContextType&);
-
-        ParseContextType m_Context;
-
-      public:
-        explicit constexpr FormatStringChecker(BasicStringView<Char> fmt)
-            : m_Context(fmt, ArgumentCount)
-
+        if (end - begin >= 2
+            && Detail::ParseAlign(begin[1]) != Alignment::eNone)
         {
+            spec.PaddingChar = static_cast<char>(begin[0]);
+            spec.Align       = Detail::ParseAlign(begin[1]);
+            begin += 2;
         }
+        else if (begin != end && Detail::ParseAlign(*begin) != Alignment::eNone)
+            spec.Align = Detail::ParseAlign(*begin++);
 
-        constexpr void OnText(const Char*, const Char*) {}
-
-        constexpr auto OnArgID() -> int { return m_Context.NextArgID(); }
-        constexpr auto OnArgID(int id) -> int
+        if (begin != end && *begin == '#')
         {
-            return m_Context.CheckArgID(id), id;
+            spec.PrintBasePrefix = true;
+            ++begin;
         }
-        constexpr auto OnArgID(BasicStringView<Char> id) -> int
+        if (begin != end && *begin == '0')
         {
-#if FMT_USE_NONTYPE_TEMPLATE_ARGS
-            auto index = GetArgIndexByName<Args...>(id);
-            if (index < 0) OnError("named argument is not found");
-            return index;
-#else
-            (void)id;
-            OnError(
-                "compile-time checks for named arguments require C++20 "
-                "support");
-            return 0;
-#endif
+            if (spec.Align == Alignment::eNone) spec.PaddingChar = '0';
+            ++begin;
         }
+        for (; begin != end && *begin >= '0' && *begin <= '9'; ++begin)
+            spec.Width = spec.Width * 10 + (*begin - '0');
 
-        constexpr void OnReplacementField(int id, const Char* begin)
+        if (begin == end) return begin;
+        switch (*begin)
         {
-            OnFormatSpecs(id, begin, begin); // Call parse() on empty specs.
+            case '}': return begin;
+            case 'c': spec.PrintAsAscii = true; break;
+            case 'b': spec.Base = FormatSpec::eBinary; break;
+            case 'o': spec.Base = FormatSpec::eOctal; break;
+            case 'X': spec.UpperCase = true; [[fallthrough]];
+            case 'x':
+            case 'p': spec.Base = FormatSpec::eHexadecimal; break;
+            case 'd':
+            case 's': break;
+
+            default:
+                Detail::FormatStringError("invalid format specifier");
+                return end;
         }
 
-        constexpr auto OnFormatSpecs(int id, const Char* begin, const Char*)
-            -> const Char*
-        {
-            m_Context.AdvanceTo(begin);
-            return begin;
-        }
-
-        constexpr void OnError(const char* message) { assert(message); }
-    };
+        spec.Presentation = static_cast<char>(*begin);
+        return begin + 1;
+    }
 }; // namespace Prism
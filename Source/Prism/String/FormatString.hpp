@@ -6,35 +6,199 @@
  */
 #pragma once
 
-#include <Prism/Algorithm/Find.hpp>
 #include <Prism/Containers/Array.hpp>
 #include <Prism/String/FormatHandler.hpp>
 #include <Prism/String/StringView.hpp>
 
 namespace Prism
 {
+    namespace Detail
+    {
+        template <typename T>
+        consteval ArgumentType GetArgumentType()
+        {
+            using U = DecayType<T>;
+
+            if constexpr (IsSameV<U, bool>) return ArgumentType::eBool;
+            else if constexpr (IsSameV<U, char>) return ArgumentType::eChar;
+            else if constexpr (IsIntegralV<U>)
+            {
+                if constexpr (sizeof(U) <= sizeof(int))
+                    return IsSignedV<U> ? ArgumentType::eInteger
+                                        : ArgumentType::eUnsignedInteger;
+                else
+                    return IsSignedV<U> ? ArgumentType::eLongLong
+                                        : ArgumentType::eUnsignedLongLong;
+            }
+            else if constexpr (IsSameV<U, const char*> || IsSameV<U, char*>)
+                return ArgumentType::eCString;
+            else if constexpr (IsConvertibleV<const U&, StringView>)
+                return ArgumentType::eString;
+            else if constexpr (IsPointerV<U> || IsNullPointerV<U>)
+                return ArgumentType::ePointer;
+            else return ArgumentType::eNone;
+        }
+
+        constexpr void CheckFormatSpec(ArgumentType      type,
+                                       const FormatSpec& spec)
+        {
+            const char presentation = spec.Presentation;
+            switch (type)
+            {
+                case ArgumentType::eNone:
+                    FormatStringError("argument type is not formattable");
+                    break;
+                case ArgumentType::eBool:
+                case ArgumentType::eCString:
+                case ArgumentType::eString:
+                    if (presentation != '\0' && presentation != 's')
+                        FormatStringError(
+                            "invalid format specifier for a string");
+                    if (spec.PrintBasePrefix || spec.IsZeroPadded())
+                        FormatStringError(
+                            "'#' and '0' require a numeric argument");
+                    break;
+                case ArgumentType::ePointer:
+                    if (presentation != '\0' && presentation != 'p'
+                        && presentation != 'x')
+                        FormatStringError(
+                            "invalid format specifier for a pointer");
+                    break;
+
+                default:
+                    if (presentation == 's' || presentation == 'p')
+                        FormatStringError(
+                            "invalid format specifier for an integer");
+                    if (type == ArgumentType::eChar
+                        && (presentation == '\0' || presentation == 'c')
+                        && (spec.PrintBasePrefix || spec.IsZeroPadded()))
+                        FormatStringError(
+                            "'#' and '0' require a numeric argument");
+                    break;
+            }
+        }
+    }; // namespace Detail
+
+    /**
+     * @brief A format string compiled while the program is compiled.
+     *
+     * The constructor is consteval: it splits the string into the literal
+     * text between replacement fields and one parsed FormatSpec per field,
+     * and checks every spec against the type of its argument. Malformed
+     * strings, a field count that differs from the argument count and specs
+     * that do not suit the argument (e.g. "{:x}" with a string) are compile
+     * errors. Formatting then only copies text and converts arguments.
+     *
+     * Fields take arguments in order ("{}" or "{:spec}"); "{{" and "}}"
+     * produce literal braces.
+     */
     template <typename Char, typename... Args>
     class BasicFormatString
     {
       public:
+        static constexpr usize ARGUMENT_COUNT = sizeof...(Args);
+
+        /// Literal text preceding a field, or trailing the last one
+        struct TextSegment
+        {
+            usize Offset  = 0;
+            usize Size    = 0;
+            /// Contains "{{" or "}}", so it has to be unescaped when written
+            bool  Escaped = false;
+        };
+
         template <usize N>
-        inline constexpr BasicFormatString(Char const (&format)[N])
-            : m_String({format, N - 1})
+        consteval BasicFormatString(Char const (&format)[N])
+            : m_String(format, N - 1)
         {
+            Compile();
         }
-
         template <typename T>
-        BasicFormatString(T const& formatString)
-            requires(requires(T t) { StringView{t}; })
+        consteval BasicFormatString(T const& formatString)
+            requires(requires(T t) { BasicStringView<Char>{t}; })
             : m_String(formatString)
         {
+            Compile();
         }
 
-        auto       View() const { return m_String; }
+        constexpr BasicStringView<Char> View() const { return m_String; }
 
-        StringView m_String = "";
+        /// Text before field @p index; index ARGUMENT_COUNT is the tail
+        constexpr const TextSegment&    Text(usize index) const
+        {
+            return m_Texts[index];
+        }
+        constexpr const FormatSpec& Spec(usize index) const
+        {
+            return m_Specs[index];
+        }
+
+      private:
+        BasicStringView<Char> m_String;
+        TextSegment           m_Texts[ARGUMENT_COUNT + 1]{};
+        FormatSpec            m_Specs[ARGUMENT_COUNT ? ARGUMENT_COUNT : 1]{};
+
+        consteval void        Compile()
+        {
+            constexpr ArgumentType types[] = {
+                Detail::GetArgumentType<Args>()...,
+                ArgumentType::eNone,
+            };
+
+            const Char* data      = m_String.Raw();
+            const usize size      = m_String.Size();
+            usize       field     = 0;
+            usize       textStart = 0;
+            bool        escaped   = false;
+
+            for (usize i = 0; i < size; ++i)
+            {
+                if (data[i] == '}')
+                {
+                    if (i + 1 == size || data[i + 1] != '}')
+                        Detail::FormatStringError(
+                            "unmatched '}' in format string");
+
+                    escaped = true;
+                    ++i;
+                    continue;
+                }
+                if (data[i] != '{') continue;
+                if (i + 1 < size && data[i + 1] == '{')
+                {
+                    escaped = true;
+                    ++i;
+                    continue;
+                }
+
+                if (field == ARGUMENT_COUNT)
+                    Detail::FormatStringError(
+                        "format string has more fields than arguments");
+                m_Texts[field] = {textStart, i - textStart, escaped};
+                escaped        = false;
+
+                FormatSpec spec;
+                ++i;
+                if (i < size && data[i] == ':')
+                    i = ParseFormatSpec(data + i + 1, data + size, spec) - data;
+                if (i == size || data[i] != '}')
+                    Detail::FormatStringError(
+                        i < size && data[i] >= '0' && data[i] <= '9'
+                            ? "manual argument indexing is not supported"
+                            : "missing '}' in format string");
+
+                Detail::CheckFormatSpec(types[field], spec);
+                m_Specs[field++] = spec;
+                textStart        = i + 1;
+            }
+
+            if (field != ARGUMENT_COUNT)
+                Detail::FormatStringError(
+                    "format string has fewer fields than arguments");
+            m_Texts[field] = {textStart, size - textStart, escaped};
+        }
     };
 
     template <typename... Args>
-    using FormatString = BasicFormatString<TypeIdentityType<Args>...>;
+    using FormatString = BasicFormatString<char, TypeIdentityType<Args>...>;
 }; // namespace Prism
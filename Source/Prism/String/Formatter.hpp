@@ -9,24 +9,14 @@
 #include <Prism/Core/TypeTraits.hpp>
 #include <Prism/String/FormatHandler.hpp>
 #include <Prism/String/FormatString.hpp>
-#include <Prism/String/StringBuilder.hpp>
+#include <Prism/String/StringUtils.hpp>
 
-#if PRISM_DISABLE_FMT != 0
+#if PRISM_DISABLE_FMT == 0
     #include <fmt/format.h>
-#else
 #endif
 
 namespace Prism
 {
-    template <bool ConstExpr, typename T, typename S = const T*>
-    constexpr auto Find(S first, S last, T value, S& out) -> bool
-    {
-        for (out = first; out != last; ++out)
-        {
-            if (*out == value) return true;
-        }
-        return false;
-    }
     template <typename OutContext>
     class Formatter
     {
@@ -39,158 +29,416 @@ namespace Prism
         template <typename T>
         constexpr void VisitArgument(const T& value, const FormatSpec& spec)
         {
-            if constexpr (IsIntegralV<T>)
-                VisitArgument(static_cast<u64>(value), spec);
-            else if constexpr (IsSameV<T, const char*>
-                               || IsSameV<T, StringView>)
-                m_Builder << value;
-            else static_assert("Unsupported format");
+            using U = DecayType<T>;
+
+            if constexpr (IsSameV<U, bool>)
+                WriteString(StringView(value ? "true" : "false"), spec);
+            else if constexpr (IsSameV<U, char>)
+            {
+                if (spec.Presentation == '\0' || spec.PrintAsAscii)
+                    WriteString(StringView(&value, 1), spec);
+                else WriteInteger(static_cast<u8>(value), spec);
+            }
+            else if constexpr (IsIntegralV<U>) WriteInteger(value, spec);
+            else if constexpr (IsSameV<U, const char*> || IsSameV<U, char*>)
+                WriteString(StringView(value), spec);
+            else if constexpr (IsConvertibleV<const U&, StringView>)
+                WriteString(static_cast<StringView>(value), spec);
+            else if constexpr (IsPointerV<U> || IsNullPointerV<U>)
+            {
+                FormatSpec pointerSpec      = spec;
+                pointerSpec.Base            = FormatSpec::eHexadecimal;
+                pointerSpec.PrintBasePrefix = true;
+                WriteInteger(reinterpret_cast<upointer>(value), pointerSpec);
+            }
+            else static_assert(sizeof(T) == 0, "Unsupported format argument");
+        }
+
+        /**
+         * @brief Writes a literal segment of a compiled format string.
+         */
+        constexpr void WriteText(StringView text, bool escaped)
+        {
+            if (!escaped) return Write(text);
+
+            // Every brace in an escaped segment is doubled
+            const char* data  = text.Raw();
+            usize       start = 0;
+            for (usize i = 0; i < text.Size(); ++i)
+            {
+                if (data[i] != '{' && data[i] != '}') continue;
+
+                Write(StringView(data + start, i + 1 - start));
+                start = ++i + 1;
+            }
+            Write(StringView(data + start, text.Size() - start));
+        }
+
+        OutContext& Context() { return m_Builder; }
+
+      private:
+        OutContext& m_Builder;
+
+        constexpr void Write(StringView text)
+        {
+            if (!text.Empty()) m_Builder << text;
         }
-        constexpr void VisitArgument(const char* s, const FormatSpec& spec)
+        constexpr void WriteFill(char fill, usize count)
         {
-            m_Builder << s;
+            for (; count > 0; --count) m_Builder << fill;
         }
-        constexpr void VisitArgument(const String& s, const FormatSpec& spec)
+        // Writes body() of the given length padded to spec.Width
+        template <typename F>
+        constexpr void WritePadded(usize length, const FormatSpec& spec,
+                                   Alignment defaultAlign, F&& body)
         {
-            m_Builder << s;
+            const usize padding
+                = spec.Width > length ? spec.Width - length : 0;
+            const Alignment align
+                = spec.Align == Alignment::eNone ? defaultAlign : spec.Align;
+
+            usize before = 0;
+            if (align == Alignment::eRight) before = padding;
+            else if (align == Alignment::eCenter) before = padding / 2;
+
+            WriteFill(spec.PaddingChar, before);
+            body();
+            WriteFill(spec.PaddingChar, padding - before);
         }
-        constexpr void VisitArgument(char c, const FormatSpec& spec)
+        constexpr void WriteString(StringView string, const FormatSpec& spec)
         {
-            m_Builder << c;
+            WritePadded(string.Size(), spec, Alignment::eLeft,
+                        [&] { Write(string); });
         }
-        constexpr void VisitArgument(u64 val, const FormatSpec& spec)
+
+        template <Integral T>
+        constexpr void WriteInteger(T value, const FormatSpec& spec)
         {
             if (spec.PrintAsAscii)
-                return VisitArgument(static_cast<char>(val), spec);
+            {
+                const char ch = static_cast<char>(value);
+                return WriteString(StringView(&ch, 1), spec);
+            }
+
+            // Digits of a u64 in binary, the widest case
+            char        buffer[64];
+            const auto  magnitude = StringUtils::Detail::Magnitude(value);
+            char*       end       = StringUtils::ToChars(
+                buffer, buffer + sizeof(buffer), magnitude, spec.Base).End;
+            StringView  digits(buffer, static_cast<usize>(end - buffer));
+            if (spec.UpperCase)
+                for (char* it = buffer; it != end; ++it)
+                    if (*it >= 'a' && *it <= 'f') *it -= 'a' - 'A';
+
+            StringView sign = value < 0 ? StringView("-") : StringView();
+            StringView prefix;
             if (spec.PrintBasePrefix)
             {
-                if (spec.Base == FormatSpec::eBinary) m_Builder.Append("0b");
-                else if (spec.Base == FormatSpec::eOctal) m_Builder.Append("0");
+                if (spec.Base == FormatSpec::eBinary) prefix = "0b";
+                else if (spec.Base == FormatSpec::eOctal) prefix = "0";
                 else if (spec.Base == FormatSpec::eHexadecimal)
-                    m_Builder.Append(spec.UpperCase ? "0X" : "0x");
+                    prefix = spec.UpperCase ? "0X" : "0x";
             }
 
-            auto  string = StringUtils::ToString<u64>(val, spec.Base);
-            usize length = string.Size();
-
-            // Padding
-            if (length < spec.Width)
-                for (usize i = 0; i < spec.Width - length; ++i)
-                    m_Builder << spec.PaddingChar;
+            const usize length = sign.Size() + prefix.Size() + digits.Size();
+            if (spec.IsZeroPadded())
+            {
+                Write(sign);
+                Write(prefix);
+                if (spec.Width > length) WriteFill('0', spec.Width - length);
+                return Write(digits);
+            }
 
-            m_Builder << string;
+            WritePadded(length, spec, Alignment::eRight,
+                        [&]
+                        {
+                            Write(sign);
+                            Write(prefix);
+                            Write(digits);
+                        });
         }
+    };
 
-        OutContext& Context() { return m_Builder; }
+    /// A destination accepting characters and string views via operator<<
+    template <typename T>
+    concept FormatSink = requires(T& sink, char ch, StringView text) {
+        sink << ch;
+        sink << text;
+    };
+    template <typename T>
+    concept FormatOutputIterator
+        = !IsArrayV<T> && !FormatSink<T> && requires(T it, char ch) {
+              *it++ = ch;
+          };
+    /// A contiguous, writable character buffer such as Span<char>
+    template <typename T>
+    concept FormatBuffer = !FormatSink<T> && requires(T& buffer) {
+        { buffer.Raw() } -> ConvertibleTo<char*>;
+        { buffer.Size() } -> ConvertibleTo<usize>;
+    };
+    /// A queue exposing its free space in place, such as RingBuffer
+    template <typename T>
+    concept FormatRegionBuffer = requires(T& queue, usize count) {
+        queue.WritableRegion().First.Raw();
+        queue.WritableRegion().Second.Raw();
+        queue.CommitWrite(count);
+    };
 
-      private:
-        OutContext& m_Builder;
+    /**
+     * @brief Outcome of formatting into a bounded buffer.
+     */
+    struct FormatToResult
+    {
+        /// Characters stored in the buffer
+        usize          Written = 0;
+        /// Characters the full output needs
+        usize          Size    = 0;
+
+        constexpr bool Truncated() const { return Written < Size; }
     };
 
-    template <typename Char, typename Handler, typename... Args>
-    constexpr auto ParseReplacementField(const Char* begin, const Char* end,
-                                         Handler&& handler, Args&&... args)
-        -> const Char*
+    namespace Detail
     {
-        ++begin;
-        if (begin == end) handler.OnError("Invalid format string");
-        if (*begin == '{') handler.OnText(begin, begin + 1);
-        // if (*begin == '}')
-        //     handler.OnReplacementField(handler.OnArgID(), begin);
-        else {
-            Char c = begin != end ? *begin : Char();
-            if (c == ':')
-            {
-                begin = handler.OnFormatSpecs(begin + 1, end,
-                                              Forward<Args>(args)...);
-                if (begin == end || *begin != '}')
-                    return handler.OnError("Unknown format specifier"), end;
+        class CountingSink
+        {
+          public:
+            constexpr CountingSink& operator<<(char)
+            {
+                ++m_Size;
+                return *this;
+            }
+            constexpr CountingSink& operator<<(StringView text)
+            {
+                m_Size += text.Size();
+                return *this;
             }
-            else return handler.OnError("Missing '}' in format string"), end;
-        }
 
-        return begin + 1;
+            constexpr usize Size() const { return m_Size; }
 
-        FormatSpec spec;
-        begin = ParseFormatSpec(begin, spec);
-        handler.Formatter.VisitArgument(Forward<Args>(args)..., spec);
-        return begin;
-    }
-    template <bool IsConstExpr, typename Char, typename Handler,
-              typename... Args>
-    constexpr inline void ParseFormatString(BasicStringView<Char> formatString,
-                                            Handler&& handler, Args&&... args)
-    {
-        auto begin = formatString.Raw();
-        auto end   = begin + formatString.Size();
+          private:
+            usize m_Size = 0;
+        };
 
-        struct Writer
+        // Fills up to two ranges in order, e.g. both halves of a wrapped
+        // ring buffer region, and counts what did not fit
+        class BufferSink
         {
-            constexpr void operator()(const Char* from, const Char* to)
+          public:
+            constexpr BufferSink(char* first, usize firstSize,
+                                 char* second = nullptr, usize secondSize = 0)
+                : m_Ranges{first, second}
+                , m_Sizes{firstSize, secondSize}
             {
-                if (from == to) return;
-                for (;;)
+            }
+
+            constexpr BufferSink& operator<<(char ch)
+            {
+                return *this << StringView(&ch, 1);
+            }
+            constexpr BufferSink& operator<<(StringView text)
+            {
+                const char* data      = text.Raw();
+                usize       remaining = text.Size();
+                m_Size += remaining;
+
+                while (remaining > 0 && m_Range < 2)
                 {
-                    const Char* p = nullptr;
-                    if (!Find<IsConstExpr>(from, to, Char('}'), p))
-                        return Dispatcher.OnText(from, to);
-                    ++p;
-                    if (p == to || *p != '}')
-                        return Dispatcher.OnError(
-                            "unmatched '}' in format string");
-                    Dispatcher.OnText(from, p);
-                    from = p + 1;
+                    usize count = Min(remaining, m_Sizes[m_Range] - m_Offset);
+                    for (usize i = 0; i < count; ++i)
+                        m_Ranges[m_Range][m_Offset + i] = data[i];
+
+                    data += count;
+                    remaining -= count;
+                    m_Offset += count;
+                    m_Written += count;
+                    if (remaining == 0) break;
+
+                    ++m_Range;
+                    m_Offset = 0;
                 }
+
+                return *this;
+            }
+
+            constexpr FormatToResult Result() const
+            {
+                return {m_Written, m_Size};
+            }
+
+          private:
+            char* m_Ranges[2];
+            usize m_Sizes[2];
+            usize m_Range   = 0;
+            usize m_Offset  = 0;
+            usize m_Written = 0;
+            usize m_Size    = 0;
+        };
+
+        template <typename It>
+        class IteratorSink
+        {
+          public:
+            constexpr explicit IteratorSink(It out)
+                : m_Out(Move(out))
+            {
+            }
+
+            constexpr IteratorSink& operator<<(char ch)
+            {
+                *m_Out++ = ch;
+                return *this;
             }
-            Handler& Dispatcher;
-        } write = {handler};
-        while (begin != end)
+            constexpr IteratorSink& operator<<(StringView text)
+            {
+                for (char ch : text) *m_Out++ = ch;
+                return *this;
+            }
+
+            constexpr It Out() { return Move(m_Out); }
+
+          private:
+            It m_Out;
+        };
+    }; // namespace Detail
+
+    namespace Detail
+    {
+        // The compiled format string expands to its text segments and
+        // argument conversions in order, with no parsing left to do
+        template <typename Sink, typename Char, typename... FmtArgs,
+                  typename... Args>
+        constexpr void
+        WriteFormatted(Sink&                                      sink,
+                       const BasicFormatString<Char, FmtArgs...>& fmt,
+                       const Args&... args)
         {
-            const char* p = begin;
-            if (*p != '{'
-                && !Find<IsConstantEvaluated()>(begin + 1, end, '{', p))
-                return write(begin, p);
-            write(begin, p);
-
-            begin = ParseReplacementField(p, end, handler,
-                                          Forward<Args>(args)...);
+            Formatter   formatter(sink);
+            const Char* string    = fmt.View().Raw();
+            auto        writeText = [&](usize index)
+            {
+                const auto& text = fmt.Text(index);
+                formatter.WriteText(
+                    StringView(string + text.Offset, text.Size), text.Escaped);
+            };
+
+            [&]<usize... I>(IndexSequence<I...>)
+            {
+                ((writeText(I), formatter.VisitArgument(args, fmt.Spec(I))),
+                 ...);
+            }(MakeIndexSequence<sizeof...(Args)>{});
+            writeText(sizeof...(Args));
         }
+    }; // namespace Detail
+
+    /**
+     * @brief Formats @p args into @p context, which accepts characters and
+     * string views through operator<<.
+     */
+    template <FormatSink Context, typename... Args>
+    constexpr void FormatTo(Context& context, FormatString<Args...> fmt,
+                            Args&&... args)
+    {
+        Detail::WriteFormatted(context, fmt, args...);
     }
-    template <typename Context, typename... Args>
-    void FormatTo(Context& context, StringView fmt, Args&&... args)
+    /**
+     * @brief Formats into @p buffer without allocating, stopping at its end.
+     * No terminator is written.
+     */
+    template <typename Buffer, typename... Args>
+        requires FormatBuffer<RemoveCvRefType<Buffer>>
+    constexpr FormatToResult FormatTo(Buffer&&              buffer,
+                                      FormatString<Args...> fmt,
+                                      Args&&... args)
     {
-        Formatter     formatter(context);
-        FormatHandler handler(formatter, fmt, Forward<Args>(args)...);
-        ParseFormatString<false>(fmt, handler, Forward<Args>(args)...);
+        Detail::BufferSink sink(buffer.Raw(), buffer.Size());
+        Detail::WriteFormatted(sink, fmt, args...);
+
+        return sink.Result();
     }
+    template <usize N, typename... Args>
+    constexpr FormatToResult FormatTo(char (&buffer)[N],
+                                      FormatString<Args...> fmt, Args&&... args)
+    {
+        Detail::BufferSink sink(buffer, N);
+        Detail::WriteFormatted(sink, fmt, args...);
 
-    template <typename... Args>
-    String Format1(StringView fmt, Args&&... args)
+        return sink.Result();
+    }
+    /**
+     * @brief Formats into the free space of @p queue (e.g. a RingBuffer) and
+     * publishes what fit in one step, so readers never observe a message
+     * while it is being written. Output that does not fit is cut off at the
+     * queue's capacity and the truncated message is still published; check
+     * the result's Truncated().
+     */
+    template <FormatRegionBuffer Queue, typename... Args>
+    FormatToResult FormatTo(Queue& queue, FormatString<Args...> fmt,
+                            Args&&... args)
+    {
+        auto               region = queue.WritableRegion();
+        Detail::BufferSink sink(reinterpret_cast<char*>(region.First.Raw()),
+                                region.First.Size(),
+                                reinterpret_cast<char*>(region.Second.Raw()),
+                                region.Second.Size());
+        Detail::WriteFormatted(sink, fmt, args...);
+
+        auto result = sink.Result();
+        queue.CommitWrite(result.Written);
+        return result;
+    }
+    /**
+     * @brief Formats through an output iterator.
+     * @return The iterator past the last written character.
+     */
+    template <typename It, typename... Args>
+        requires FormatOutputIterator<RemoveCvRefType<It>>
+    constexpr RemoveCvRefType<It> FormatTo(It&& out, FormatString<Args...> fmt,
+                                           Args&&... args)
     {
-        StringBuilder<char> context;
-        Formatter           formatter(context);
+        Detail::IteratorSink<RemoveCvRefType<It>> sink(Forward<It>(out));
+        Detail::WriteFormatted(sink, fmt, args...);
 
-        FormatTo(formatter, fmt.begin(), Forward<Args>(args)...);
-        return context;
+        return sink.Out();
     }
 
+    /**
+     * @brief Number of characters Format() would produce, for sizing a
+     * buffer up front.
+     */
     template <typename... Args>
-    void Print(FormatString<Args...>&& fmt, Args const&... parameters)
+    constexpr usize FormattedSize(FormatString<Args...> fmt, Args&&... args)
     {
+        Detail::CountingSink sink;
+        Detail::WriteFormatted(sink, fmt, args...);
+
+        return sink.Size();
     }
 
     template <typename... Args>
-    consteval FormatString<Args...> MakeFormatString(StringView fmt, Args&&...)
+    String Format1(FormatString<Args...> fmt, Args&&... args)
     {
-        return FormatString<Args...>(fmt);
+        // Most messages fit the stack buffer and are copied out once; longer
+        // ones are measured by that pass and formatted again in place
+        char               buffer[256];
+        Detail::BufferSink sink(buffer, sizeof(buffer));
+        Detail::WriteFormatted(sink, fmt, args...);
+
+        auto result = sink.Result();
+        if (!result.Truncated()) return String(buffer, result.Written);
+
+        String string;
+        string.Resize(result.Size);
+
+        Detail::BufferSink fullSink(string.Raw(), string.Size());
+        Detail::WriteFormatted(fullSink, fmt, args...);
+        return string;
     }
+
     template <typename... Args>
-    PM_NODISCARD inline constexpr String DoFormat(StringView fmt,
-                                                  Args&&... args)
+    void Print(FormatString<Args...>&& fmt, Args const&... parameters)
     {
-        constexpr auto checked = MakeFormatString(fmt, args...);
-        return Format1(fmt, Forward<Args>(args)...);
     }
+
 #if PRISM_DISABLE_FMT == 0
     template <typename... Args>
     PM_NODISCARD inline auto Format(fmt::format_string<Args...> fmt,
@@ -198,6 +446,13 @@ namespace Prism
     {
         return fmt::format(fmt, Forward<Args>(args)...);
     }
+#else
+    template <typename... Args>
+    PM_NODISCARD inline String Format(FormatString<Args...> fmt,
+                                      Args&&... args)
+    {
+        return Format1(fmt, Forward<Args>(args)...);
+    }
 #endif
 }; // namespace Prism
 
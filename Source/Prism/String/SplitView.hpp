@@ -0,0 +1,318 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#pragma once
+
+#include <Prism/Core/Iterator.hpp>
+#include <Prism/String/StringView.hpp>
+
+namespace Prism
+{
+    /**
+     * @brief Whether splitting yields the empty tokens found between
+     * adjacent delimiters and at either end of the text.
+     */
+    enum class SplitBehavior
+    {
+        eKeepEmpty,
+        eSkipEmpty,
+    };
+
+    namespace Detail
+    {
+        template <typename C, typename Traits>
+        struct CharacterDelimiter
+        {
+            C               Character;
+
+            constexpr usize Size() const { return 1; }
+            constexpr usize Find(BasicStringView<C, Traits> text,
+                                 usize                      pos) const
+            {
+                return text.Find(Character, pos);
+            }
+        };
+        template <typename C, typename Traits>
+        struct StringDelimiter
+        {
+            BasicStringView<C, Traits> Needle;
+
+            constexpr usize Size() const { return Needle.Size(); }
+            constexpr usize Find(BasicStringView<C, Traits> text,
+                                 usize                      pos) const
+            {
+                return text.Find(Needle, pos);
+            }
+        };
+        /// Any one character out of a set; byte sets become a 256-bit map
+        template <typename C, typename Traits>
+        struct CharacterSetDelimiter
+        {
+            BasicStringView<C, Traits> Set;
+            u64                        Map[4]{};
+
+            constexpr CharacterSetDelimiter() = default;
+            constexpr explicit CharacterSetDelimiter(
+                BasicStringView<C, Traits> set)
+                : Set(set)
+            {
+                if constexpr (sizeof(C) == 1)
+                    for (C ch : set)
+                    {
+                        const u8 byte = static_cast<u8>(ch);
+                        Map[byte / 64] |= Bit(byte % 64);
+                    }
+            }
+
+            constexpr usize Size() const { return 1; }
+            constexpr bool  Contains(C ch) const
+            {
+                if constexpr (sizeof(C) == 1)
+                {
+                    const u8 byte = static_cast<u8>(ch);
+                    return Map[byte / 64] & Bit(byte % 64);
+                }
+                else return Traits::Find(Set.Raw(), Set.Size(), ch);
+            }
+            constexpr usize Find(BasicStringView<C, Traits> text,
+                                 usize                      pos) const
+            {
+                for (; pos < text.Size(); ++pos)
+                    if (Contains(text[pos])) return pos;
+
+                return BasicStringView<C, Traits>::NPos;
+            }
+        };
+    }; // namespace Detail
+
+    /**
+     * @brief A lazy range over the tokens of a string view.
+     *
+     * Tokens are views into the original text, found one at a time as the
+     * range is iterated, so splitting never allocates. The text has to
+     * outlive the range; iterators carry their own copy of the split state
+     * and stay valid after the range itself is gone. Empty text has no
+     * tokens; otherwise n delimiters separate n + 1 tokens, of which the
+     * empty ones can be skipped.
+     *
+     * @tparam Delimiter Finds the next delimiter at or after a position and
+     * knows its length (a character, a character set or a substring)
+     */
+    template <typename C, typename Traits, typename Delimiter>
+    class BasicSplitView
+    {
+      public:
+        using ViewType = BasicStringView<C, Traits>;
+
+        class Sentinel
+        {
+        };
+        class Iterator
+        {
+          public:
+            using IteratorCategory = ForwardIteratorTag;
+            using ValueType        = ViewType;
+            using DifferenceType   = isize;
+            using Pointer          = const ViewType*;
+            using Reference        = const ViewType&;
+
+            // The standard names, for <ranges> and range-based for
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type       = ViewType;
+            using difference_type  = isize;
+
+            constexpr Iterator()   = default;
+            constexpr Iterator(const BasicSplitView& split)
+                : m_Text(split.m_Text)
+                , m_Delimiter(split.m_Delimiter)
+                , m_Behavior(split.m_Behavior)
+            {
+                FindToken(0);
+                SkipEmpty();
+            }
+
+            constexpr const ViewType& operator*() const { return m_Token; }
+            constexpr const ViewType* operator->() const { return &m_Token; }
+
+            constexpr Iterator&       operator++()
+            {
+                Advance();
+                SkipEmpty();
+                return *this;
+            }
+            constexpr Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++*this;
+
+                return previous;
+            }
+
+            constexpr bool operator==(const Iterator& other) const
+            {
+                return m_Done == other.m_Done
+                    && (m_Done || m_Token.Raw() == other.m_Token.Raw());
+            }
+            constexpr bool operator==(Sentinel) const { return m_Done; }
+
+          private:
+            ViewType       m_Text;
+            Delimiter      m_Delimiter{};
+            SplitBehavior  m_Behavior = SplitBehavior::eKeepEmpty;
+            ViewType       m_Token;
+            // Where the delimiter ending the token starts, or NPos for the
+            // last token
+            usize          m_DelimiterOffset = ViewType::NPos;
+            bool           m_Done            = true;
+
+            constexpr void FindToken(usize start)
+            {
+                if (start == 0 && m_Text.Empty()) return;
+
+                m_DelimiterOffset = m_Delimiter.Find(m_Text, start);
+                usize end         = m_DelimiterOffset == ViewType::NPos
+                                      ? m_Text.Size()
+                                      : m_DelimiterOffset;
+                m_Token           = ViewType(m_Text.Raw() + start, end - start);
+                m_Done            = false;
+            }
+            constexpr void Advance()
+            {
+                if (m_DelimiterOffset == ViewType::NPos)
+                {
+                    m_Done = true;
+                    return;
+                }
+
+                FindToken(m_DelimiterOffset + m_Delimiter.Size());
+            }
+            constexpr void SkipEmpty()
+            {
+                if (m_Behavior != SplitBehavior::eSkipEmpty) return;
+                while (!m_Done && m_Token.Empty()) Advance();
+            }
+        };
+
+        constexpr BasicSplitView(ViewType text, Delimiter delimiter,
+                                 SplitBehavior behavior)
+            : m_Text(text)
+            , m_Delimiter(delimiter)
+            , m_Behavior(behavior)
+        {
+        }
+
+        constexpr Iterator begin() const { return Iterator(*this); }
+        constexpr Sentinel end() const { return {}; }
+
+        constexpr bool     Empty() const { return begin() == end(); }
+        /// Number of tokens; walks the whole text
+        constexpr usize    Count() const
+        {
+            usize count = 0;
+            for (auto it = begin(); it != end(); ++it) ++count;
+
+            return count;
+        }
+        /**
+         * @brief The first token, or an empty view if there is none.
+         */
+        constexpr ViewType Front() const
+        {
+            auto it = begin();
+            return it == end() ? ViewType() : *it;
+        }
+
+      private:
+        ViewType      m_Text;
+        Delimiter     m_Delimiter;
+        SplitBehavior m_Behavior;
+    };
+
+    /**
+     * @brief Lazily splits @p text at every @p delimiter character.
+     */
+    template <typename C, typename Traits>
+    constexpr auto Split(BasicStringView<C, Traits> text, C delimiter,
+                         SplitBehavior behavior = SplitBehavior::eKeepEmpty)
+    {
+        using Delimiter = Detail::CharacterDelimiter<C, Traits>;
+        return BasicSplitView<C, Traits, Delimiter>(text, {delimiter},
+                                                    behavior);
+    }
+    /**
+     * @brief Lazily splits @p text at every occurrence of the non-empty
+     * @p delimiter.
+     */
+    template <typename C, typename Traits>
+    constexpr auto Split(BasicStringView<C, Traits> text,
+                         BasicStringView<C, Traits> delimiter,
+                         SplitBehavior behavior = SplitBehavior::eKeepEmpty)
+    {
+        assert(!delimiter.Empty());
+
+        using Delimiter = Detail::StringDelimiter<C, Traits>;
+        return BasicSplitView<C, Traits, Delimiter>(text, {delimiter},
+                                                    behavior);
+    }
+    /**
+     * @brief Lazily splits @p text at every character contained in
+     * @p delimiters.
+     */
+    template <typename C, typename Traits>
+    constexpr auto SplitAny(BasicStringView<C, Traits> text,
+                            BasicStringView<C, Traits> delimiters,
+                            SplitBehavior behavior = SplitBehavior::eKeepEmpty)
+    {
+        using Delimiter = Detail::CharacterSetDelimiter<C, Traits>;
+        return BasicSplitView<C, Traits, Delimiter>(
+            text, Delimiter(delimiters), behavior);
+    }
+    /**
+     * @brief Lazily yields the runs of @p text separated by any of
+     * @p separators (whitespace by default), never yielding empty tokens,
+     * e.g. to parse a command line.
+     */
+    template <typename C, typename Traits>
+    constexpr auto Tokenize(BasicStringView<C, Traits> text,
+                            BasicStringView<C, Traits> separators
+                            = BasicStringView<C, Traits>(" \t\n\v\f\r"))
+    {
+        return SplitAny(text, separators, SplitBehavior::eSkipEmpty);
+    }
+
+    constexpr auto Split(StringView text, char delimiter,
+                         SplitBehavior behavior = SplitBehavior::eKeepEmpty)
+    {
+        return Split<char, CharTraits<char>>(text, delimiter, behavior);
+    }
+    constexpr auto Split(StringView text, StringView delimiter,
+                         SplitBehavior behavior = SplitBehavior::eKeepEmpty)
+    {
+        return Split<char, CharTraits<char>>(text, delimiter, behavior);
+    }
+    constexpr auto SplitAny(StringView text, StringView delimiters,
+                            SplitBehavior behavior = SplitBehavior::eKeepEmpty)
+    {
+        return SplitAny<char, CharTraits<char>>(text, delimiters, behavior);
+    }
+    constexpr auto Tokenize(StringView text,
+                            StringView separators = " \t\n\v\f\r")
+    {
+        return Tokenize<char, CharTraits<char>>(text, separators);
+    }
+}; // namespace Prism
+
+template <typename C, typename Traits, typename Delimiter>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    Prism::BasicSplitView<C, Traits, Delimiter>> = true;
+
+#if PRISM_USE_NAMESPACE != 0
+using Prism::BasicSplitView;
+using Prism::Split;
+using Prism::SplitAny;
+using Prism::SplitBehavior;
+using Prism::Tokenize;
+#endif
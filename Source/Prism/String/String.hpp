@@ -7,6 +7,7 @@
 #pragma once
 
 #include <Prism/Containers/Vector.hpp>
+#include <Prism/Core/Bits.hpp>
 #include <Prism/String/StringView.hpp>
 
 namespace Prism
@@ -32,11 +33,15 @@ namespace Prism
 
         constexpr static SizeType NPos = -1;
 
-        explicit constexpr BasicString() PM_NOEXCEPT { ShortInit(); }
+        explicit constexpr BasicString() PM_NOEXCEPT
+        {
+            if (IsConstantEvaluated()) ResetStorage();
+        }
         constexpr BasicString(SizeType count, ValueType ch)
         {
+            if (IsConstantEvaluated()) ResetStorage();
             assert(count <= MaxSize());
-            EnsureCapacity(count);
+            Reserve(count);
             Assign(count, ch);
             SetSize(count);
 
@@ -49,11 +54,8 @@ namespace Prism
         }
         constexpr BasicString(const ValueType* s, SizeType count = NPos)
         {
-            if (!s)
-            {
-                ShortInit();
-                return;
-            }
+            if (IsConstantEvaluated()) ResetStorage();
+            if (!s) return;
 
             if (count == NPos) count = Traits::Length(s);
             ResizeIfNeededOverwrite(s, count);
@@ -66,17 +68,17 @@ namespace Prism
             : BasicString(BasicStringView{other.Raw(), other.Size()})
         {
         }
-        constexpr BasicString(BasicString&& other)
+        constexpr BasicString(BasicString&& other) PM_NOEXCEPT
+            : m_Storage(other.m_Storage)
         {
-            m_Storage       = Move(other.m_Storage);
-            other.m_Storage = {};
+            other.ResetStorage();
         }
 
         constexpr ~BasicString()
         {
             if (!IsLong()) return;
 
-            delete[] m_Storage.Long.Data;
+            delete[] Long().Data;
         }
 
         constexpr operator BasicStringView<C, Traits>()
@@ -86,17 +88,18 @@ namespace Prism
 
         constexpr BasicString& operator=(const BasicString& other)
         {
-            if (other.Empty()) return *this;
+            if (this == &other) return *this;
 
-            if (other == *this) return *this;
             ResizeIfNeededOverwrite(other.Raw(), other.Size());
             return *this;
         }
-        constexpr BasicString& operator=(BasicString&& str)
+        constexpr BasicString& operator=(BasicString&& str) PM_NOEXCEPT
         {
+            if (this == &str) return *this;
+
             if (IsLong()) delete[] Long().Data;
-            m_Storage     = Move(str.m_Storage);
-            str.m_Storage = {};
+            m_Storage = str.m_Storage;
+            str.ResetStorage();
 
             return *this;
         }
@@ -118,31 +121,30 @@ namespace Prism
         }
         constexpr BasicString& operator=(ValueType ch)
         {
-            ShortInit();
             Raw()[0] = ch;
             SetSize(1);
-            Raw()[Size()] = 0;
+            Raw()[1] = 0;
 
             return *this;
         }
         constexpr BasicString& operator=(NullType) = delete;
 
-        C& At(usize pos)
+        constexpr C&       At(usize pos)
         {
             assert(pos < Size());
             return Raw()[pos];
         }
-        const C& At(usize pos) const
+        constexpr const C& At(usize pos) const
         {
             assert(pos < Size());
             return Raw()[pos];
         }
-        C& operator[](usize pos)
+        constexpr C&       operator[](usize pos)
         {
             assert(pos < Size());
             return Raw()[pos];
         }
-        const C& operator[](usize pos) const
+        constexpr const C& operator[](usize pos) const
         {
             assert(pos < Size());
             return Raw()[pos];
@@ -208,7 +210,7 @@ namespace Prism
         constexpr bool  Empty() const PM_NOEXCEPT { return Size() == 0; }
         constexpr usize Size() const PM_NOEXCEPT
         {
-            return IsLong() ? Long().Size : m_Storage.Short.Size;
+            return IsLong() ? Long().Size : ShortSize();
         }
         constexpr usize        MaxSize() const PM_NOEXCEPT { return usize(-1); }
 
@@ -285,49 +287,67 @@ namespace Prism
             return begin() + index;
         }
 
+        /**
+         * @brief Reserves storage for at least @p newCapacity characters.
+         *
+         * Unlike the implicit growth performed by appends, the request is
+         * honoured exactly, so callers that know the final size up front pay
+         * for a single allocation.
+         */
         constexpr void Reserve(usize newCapacity)
         {
             assert(newCapacity <= MaxSize());
-            EnsureCapacity(newCapacity);
+            if (Capacity() >= newCapacity) return;
+
+            Reallocate(newCapacity, true);
         }
         constexpr usize Capacity() const PM_NOEXCEPT
         {
-            return IsLong() ? m_Storage.Long.Capacity : MIN_CAPACITY - 1;
+            return IsLong() ? Long().Capacity : SHORT_CAPACITY;
         }
+        /**
+         * @brief Releases unused capacity, moving the contents back into the
+         * inline buffer when they fit.
+         */
         constexpr void ShrinkToFit()
         {
             if (!IsLong()) return;
-            Reallocate(Size(), true);
+            if (IsConstantEvaluated() || !FitsInSso(Size()))
+                return Reallocate(Size(), true);
+
+            C*    data = Long().Data;
+            usize size = Long().Size;
+
+            m_Storage  = {};
+            TraitsType::Copy(Short(), data, size);
+            SetSize(size);
+            Raw()[size] = 0;
+
+            delete[] data;
         }
 
         constexpr void Clear() PM_NOEXCEPT
         {
-            if (IsLong())
-            {
-                m_Storage.Long.Size = 0;
-                return;
-            }
-
-            m_Storage.Short.Size = 0;
+            SetSize(0);
+            Raw()[0] = 0;
         }
         constexpr void Resize(SizeType count, ValueType ch)
         {
-            assert(Size() + count <= MaxSize());
+            assert(count <= MaxSize());
 
             usize oldSize = Size();
             Resize(count);
 
-            TraitsType::Assign(Raw() + oldSize, count - oldSize, ch);
-            Raw()[Size()] = 0;
+            if (count > oldSize)
+                TraitsType::Assign(Raw() + oldSize, count - oldSize, ch);
         }
         constexpr void Resize(SizeType count)
         {
-            usize newSize = count;
-            if (IsLong() || !FitsInSso(count)) Reallocate(count, true);
+            EnsureCapacity(count);
 
             for (usize i = Size(); i < count; i++) Raw()[i] = 0;
-            SetSize(newSize);
-            Raw()[newSize] = 0;
+            SetSize(count);
+            Raw()[count] = 0;
         }
         constexpr void Swap(BasicString& str) PM_NOEXCEPT
         {
@@ -649,24 +669,33 @@ namespace Prism
         inline constexpr BasicString<C, Traits>&
         operator+=(BasicStringView<C, Traits> rhs)
         {
-            auto pos = Size();
-            if (rhs == *this)
+            usize    pos     = Size();
+            usize    count   = rhs.Size();
+            const C* source  = rhs.Raw();
+
+            // The appended view may point into our own buffer, which the
+            // growth below is allowed to release
+            bool     aliased = false;
+            usize    offset  = 0;
+            if (IsConstantEvaluated())
             {
-                usize size    = Size();
-                usize newSize = 2 * size;
-                EnsureCapacity(newSize);
-                Traits::Move(Raw() + pos, Raw(), size);
-                SetSize(newSize);
-                Raw()[Size()] = 0;
-                return *this;
+                // Only equality is defined between unrelated pointers there
+                for (usize i = 0; i <= pos && !aliased; ++i)
+                    if (source == Raw() + i) aliased = true, offset = i;
+            }
+            else
+            {
+                aliased = source >= Raw() && source <= Raw() + pos;
+                offset  = aliased ? source - Raw() : 0;
             }
 
-            usize newSize = Size() + rhs.Size();
-            EnsureCapacity(newSize);
-            SetSize(newSize);
-            Raw()[Size()] = 0;
+            EnsureCapacity(pos + count);
+            if (aliased) source = Raw() + offset;
+
+            TraitsType::Copy(Raw() + pos, source, count);
+            SetSize(pos + count);
+            Raw()[pos + count] = 0;
 
-            TraitsType::Copy(Raw() + pos, rhs.Raw(), rhs.Size());
             return *this;
         }
         inline constexpr BasicString& operator+=(C ch)
@@ -684,103 +713,142 @@ namespace Prism
         }
 
         friend constexpr BasicString operator+(const BasicString& lhs,
-                                               const BasicString& rhs)
+                                               ViewType           rhs)
         {
-            BasicString string = "";
+            BasicString string;
             string.Reserve(lhs.Size() + rhs.Size());
-            string += lhs;
+            string += lhs.View();
             string += rhs;
 
             return string;
         }
+        friend constexpr BasicString operator+(const BasicString& lhs,
+                                               const BasicString& rhs)
+        {
+            return lhs + rhs.View();
+        }
         friend constexpr BasicString operator+(const BasicString& lhs,
                                                const C*           rhs)
         {
-            BasicString string = lhs;
-            string += rhs;
+            return lhs + ViewType(rhs);
+        }
+        friend constexpr BasicString operator+(const BasicString& lhs, C rhs)
+        {
+            return lhs + ViewType(AddressOf(rhs), 1);
+        }
 
-            return string;
+        // Temporaries on the left-hand side donate their buffer, so chained
+        // concatenations only grow a single string instead of allocating a
+        // fresh one per operator
+        friend constexpr BasicString operator+(BasicString&& lhs, ViewType rhs)
+        {
+            lhs += rhs;
+            return Move(lhs);
+        }
+        friend constexpr BasicString operator+(BasicString&&      lhs,
+                                               const BasicString& rhs)
+        {
+            return Move(lhs) + rhs.View();
+        }
+        friend constexpr BasicString operator+(BasicString&& lhs, const C* rhs)
+        {
+            return Move(lhs) + ViewType(rhs);
+        }
+        friend constexpr BasicString operator+(BasicString&& lhs, C rhs)
+        {
+            lhs += rhs;
+            return Move(lhs);
         }
 
       private:
+        // The object is three machine words. While the string is long the
+        // words hold the heap pointer, the size and the capacity, with the
+        // topmost bit of the capacity flagging the long mode. While short,
+        // the same bytes are an inline array whose last code unit stores the
+        // remaining inline capacity rather than the size: it reaches zero
+        // exactly when the buffer is full, so it doubles as the terminator
+        // and lets the inline buffer hold sizeof(LongData) / sizeof(C) - 1
+        // characters, 23 for char on 64-bit targets. On little-endian
+        // targets the flag lands in the top bit of the last byte, which the
+        // short mode never sets.
+        //
+        // Constant evaluation cannot tell which member of the union is
+        // active, so there every string stays in long mode, as in libc++.
+        static_assert(Endian::eNative == Endian::eLittle,
+                      "BasicString packs its long flag little-endian");
         struct LongData
         {
-            struct [[gnu::packed]]
-            {
-                usize IsLong   : 1;
-                usize Capacity : sizeof(usize) * __CHAR_BIT__ - 1;
-            };
-            usize Size = 0;
-            C*    Data = nullptr;
+            C*    Data;
+            usize Size;
+            usize Capacity : sizeof(usize) * __CHAR_BIT__ - 1;
+            usize IsLong   : 1;
         };
 
-        static constexpr usize MIN_CAPACITY
-            = (sizeof(LongData) - 1) / sizeof(C) > 2
-                ? (sizeof(LongData) - 1) / sizeof(C)
-                : 2;
+        static constexpr usize SHORT_CAPACITY
+            = sizeof(LongData) / sizeof(C) - 1;
+        static_assert(SHORT_CAPACITY >= 1);
+
         struct ShortData
         {
-            struct [[gnu::packed]]
+            constexpr ShortData()
+                : Data{}
             {
-                unsigned char IsLong : 1;
-                unsigned char Size   : 7;
-            };
-            char Padding[sizeof(C) - 1];
-            C    Data[MIN_CAPACITY];
+                Data[SHORT_CAPACITY] = static_cast<C>(SHORT_CAPACITY);
+            }
+
+            C Data[SHORT_CAPACITY + 1];
         };
+        static_assert(sizeof(ShortData) == sizeof(LongData));
 
         union Storage
         {
             LongData  Long;
-            ShortData Short{{false, 0}, {}, {}};
+            ShortData Short{};
         } m_Storage;
 
         constexpr C*              Short() { return m_Storage.Short.Data; }
         constexpr const C*        Short() const { return m_Storage.Short.Data; }
         constexpr LongData&       Long() { return m_Storage.Long; }
         constexpr const LongData& Long() const { return m_Storage.Long; }
-        constexpr void            SetSize(usize newSize)
+        constexpr usize           ShortSize() const
         {
-            if (IsLong()) m_Storage.Long.Size = newSize;
-            else m_Storage.Short.Size = newSize;
+            return SHORT_CAPACITY
+                 - static_cast<usize>(m_Storage.Short.Data[SHORT_CAPACITY]);
         }
-
-        constexpr static bool FitsInSso(usize size)
+        constexpr void SetSize(usize newSize)
         {
-            return size < MIN_CAPACITY;
+            if (IsLong()) m_Storage.Long.Size = newSize;
+            else
+                m_Storage.Short.Data[SHORT_CAPACITY]
+                    = static_cast<C>(SHORT_CAPACITY - newSize);
         }
 
-        constexpr void Initialize(usize size)
+        /// Leaves the string empty, without releasing the old buffer
+        constexpr void ResetStorage()
         {
-            if (FitsInSso(size)) return ShortInit();
-            LongInit();
+            if (IsConstantEvaluated())
+                m_Storage.Long = {new C[1]{}, 0, 0, true};
+            else m_Storage = {};
         }
 
-        constexpr void LongInit()
-        {
-            m_Storage.Long.IsLong   = true;
-            m_Storage.Long.Data     = nullptr;
-            m_Storage.Long.Size     = 0;
-            m_Storage.Long.Capacity = 0;
-        }
-        constexpr void ShortInit()
+        constexpr static bool FitsInSso(usize size)
         {
-            if (IsLong() && m_Storage.Long.Data)
-            {
-                delete[] m_Storage.Long.Data;
-                m_Storage.Long.Data     = nullptr;
-                m_Storage.Long.Size     = 0;
-                m_Storage.Long.Capacity = 0;
-                m_Storage.Long.IsLong   = false;
-            }
-
-            m_Storage.Short.IsLong = false;
-            m_Storage.Short.Size   = 0;
+            return size <= SHORT_CAPACITY;
         }
 
         constexpr bool IsLong() const PM_NOEXCEPT
         {
-            return m_Storage.Short.IsLong;
+            if (IsConstantEvaluated()) return m_Storage.Long.IsLong;
+
+            // Read the flag byte as raw storage; which member of the union is
+            // active is exactly what is being asked
+            u8 flags;
+            __builtin_memcpy(&flags,
+                             reinterpret_cast<const u8*>(&m_Storage)
+                                 + sizeof(Storage) - 1,
+                             1);
+
+            return flags & 0x80;
         }
 
         constexpr void Reallocate(usize newCapacity, bool copyOld)
@@ -789,29 +857,30 @@ namespace Prism
             newCapacity = (newCapacity + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
             if (newCapacity == Capacity()) return;
 
-            usize newSize = Size();
-            if (newCapacity < Size()) newSize = newCapacity;
-            SetSize(newSize);
+            usize newSize = Min(Size(), newCapacity);
+            C*    newData = new C[newCapacity + 1];
 
-            C* newData = new C[newCapacity + 1];
-            if (copyOld) TraitsType::Copy(newData, Raw(), Size());
+            if (copyOld) TraitsType::Copy(newData, Raw(), newSize);
             if (IsLong()) delete[] Long().Data;
-            Long().Data            = newData;
 
-            m_Storage.Short.IsLong = true;
-            Long().Capacity        = newCapacity;
-            Long().Size            = newSize;
-
-            Raw()[Size()]          = 0;
+            // Assigning the member as a whole makes it the active one
+            m_Storage.Long   = {newData, newSize, newCapacity, true};
+            newData[newSize] = 0;
         }
+        /**
+         * @brief Grows the buffer geometrically so that a sequence of
+         * appends costs an amortized constant number of allocations.
+         */
         constexpr void EnsureCapacity(usize newCapacity)
         {
-            if (Capacity() >= newCapacity) return;
-            Reallocate(newCapacity, true);
+            usize capacity = Capacity();
+            if (capacity >= newCapacity) return;
+
+            Reallocate(Max(newCapacity, 2 * capacity), true);
         }
         constexpr void ResizeIfNeededOverwrite(const C* string, usize length)
         {
-            EnsureCapacity(length);
+            if (Capacity() < length) Reallocate(length, false);
             SetSize(length);
 
             Traits::Copy(Raw(), string, length);
@@ -1,53 +1,60 @@
 /*
  * Created by v1tr10l7 on 24.04.2025.
- * Copyright (c) 2024-2025, Szymon Zemke <v1tr10l7@proton.me>
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
  *
  * SPDX-License-Identifier: GPL-3
  */
 #pragma once
 
-#include <Prism/Containers/DoublyLinkedList.hpp>
+#include <Prism/String/Formatter.hpp>
 #include <Prism/String/String.hpp>
 #include <Prism/String/StringUtils.hpp>
 
 namespace Prism
 {
+    /**
+     * @brief Accumulates text in a single, geometrically growing buffer.
+     *
+     * Appends cost an amortized constant number of allocations and the
+     * result is materialized without copying: ToString() on an rvalue
+     * builder hands the buffer over to the returned string.
+     */
     template <typename C = char, typename Traits = CharTraits<C>>
     class StringBuilder
     {
       public:
-        inline constexpr static usize DEFAULT_SEGMENT_CAPACITY = 100;
+        using StringType = BasicString<C, Traits>;
+        using ViewType   = BasicStringView<C, Traits>;
 
-        constexpr explicit StringBuilder(usize segmentCapacity
-                                         = DEFAULT_SEGMENT_CAPACITY)
-            : m_Length(0)
-        {
-            Reset();
-        }
-        constexpr ~StringBuilder() {}
+        inline constexpr static usize DEFAULT_CAPACITY = 0;
 
-        constexpr bool Empty() const { return m_Length == 0; }
-        inline void    Reset()
+        constexpr explicit StringBuilder(usize initialCapacity
+                                         = DEFAULT_CAPACITY)
         {
-            m_Segments.Clear();
-            m_Length = 0;
-
-            m_Segments.PushBack(String{""});
-            auto& segment = m_Segments.Tail();
-            segment.Reserve(DEFAULT_SEGMENT_CAPACITY);
+            Reserve(initialCapacity);
         }
+        constexpr ~StringBuilder() {}
 
-        constexpr void Append(C c)
-        {
-            Reinvalidate();
-            Segment() += c;
-            ++m_Length;
-        }
+        constexpr bool     Empty() const { return m_Buffer.Empty(); }
+        constexpr usize    Size() const { return m_Buffer.Size(); }
+        constexpr usize    Capacity() const { return m_Buffer.Capacity(); }
+        constexpr ViewType View() const { return m_Buffer.View(); }
+
+        /**
+         * @brief Preallocates room for @p capacity characters, e.g. when the
+         * size of a report is known up front.
+         */
+        constexpr void Reserve(usize capacity) { m_Buffer.Reserve(capacity); }
+        /**
+         * @brief Discards the contents but keeps the buffer, so a builder
+         * reused in a loop stops allocating once it reached its peak size.
+         */
+        constexpr void Reset() { m_Buffer.Clear(); }
+
+        constexpr void Append(C c) { m_Buffer += c; }
         constexpr void Append(const C* str, usize len)
         {
-            Reinvalidate();
-            Segment() += BasicStringView<C, Traits>(str, len);
-            m_Length += len;
+            m_Buffer += ViewType(str, len);
         }
         constexpr void Append(const char* str)
         {
@@ -59,17 +66,76 @@ namespace Prism
         }
         constexpr void Append(u64 value)
         {
-            Reinvalidate();
+            // u64 has at most 20 decimal digits
+            char buffer[20];
+            auto result
+                = StringUtils::ToChars(buffer, buffer + sizeof(buffer), value);
 
-            auto string = StringUtils::ToString<u64>(value);
-            m_Length += string.Size();
-            Segment() += string;
+            Append(buffer, result.End - buffer);
         }
 
-        constexpr void Insert(BasicStringView<C, Traits> other)
+        /// Appends @p count copies of @p ch
+        constexpr void AppendFill(C ch, usize count)
         {
-            m_Segments.PushFront(other);
-            m_Length += other.Size();
+            Traits::Assign(Extend(count), count, ch);
+        }
+        /// Appends @p count copies of @p str
+        constexpr void AppendRepeated(ViewType str, usize count)
+        {
+            usize size = str.Size();
+            if (size == 0 || count == 0) return;
+            if (size == 1) return AppendFill(str[0], count);
+
+            // The first copy may alias our own buffer, which Extend() is
+            // allowed to release; every further copy doubles what is written
+            usize      start  = Size();
+            usize      total  = size * count;
+            ViewType   source = str;
+            StringType own;
+            if (source.Raw() >= m_Buffer.Raw()
+                && source.Raw() <= m_Buffer.Raw() + start)
+            {
+                own    = source;
+                source = own.View();
+            }
+
+            C* dest = Extend(total);
+            Traits::Copy(dest, source.Raw(), size);
+            for (usize written = size; written < total;)
+            {
+                usize chunk = Min(written, total - written);
+                Traits::Copy(dest + written, dest, chunk);
+                written += chunk;
+            }
+        }
+        /**
+         * @brief Formats @p args directly into the buffer.
+         */
+        template <typename... Args>
+        constexpr void AppendFormatted(FormatString<Args...> fmt,
+                                       Args&&... args)
+        {
+            FormatTo(*this, fmt, Forward<Args>(args)...);
+        }
+
+        /// Prepends @p other, shifting the current contents
+        constexpr void Insert(ViewType other)
+        {
+            usize size  = Size();
+            usize count = other.Size();
+            if (count == 0) return;
+
+            StringType own;
+            if (other.Raw() >= m_Buffer.Raw()
+                && other.Raw() <= m_Buffer.Raw() + size)
+            {
+                own   = other;
+                other = own.View();
+            }
+
+            C* data = Extend(count) - size;
+            Traits::Move(data + count, data, size);
+            Traits::Copy(data, other.Raw(), count);
         }
 
         constexpr StringBuilder& operator<<(C ch)
@@ -77,12 +143,12 @@ namespace Prism
             Append(ch);
             return *this;
         }
-        constexpr StringBuilder& operator<<(BasicStringView<C, Traits> str)
+        constexpr StringBuilder& operator<<(ViewType str)
         {
             Append(str.Raw(), str.Size());
             return *this;
         }
-        constexpr StringBuilder& operator<<(const BasicString<C, Traits>& rhs)
+        constexpr StringBuilder& operator<<(const StringType& rhs)
         {
             Append(rhs);
             return *this;
@@ -93,34 +159,35 @@ namespace Prism
             return *this;
         }
 
-        constexpr BasicString<C, Traits> ToString() const
+        constexpr StringType ToString() const& { return m_Buffer; }
+        /**
+         * @brief Moves the buffer into the returned string without copying;
+         * the builder is left empty.
+         */
+        constexpr StringType ToString() &&
         {
-            BasicString<C, Traits> string;
-            string.Reserve(m_Length);
+            StringType string = Move(m_Buffer);
+            m_Buffer          = StringType();
 
-            for (auto& segment : m_Segments) string += segment;
             return string;
         }
-        constexpr operator auto() { return ToString(); }
+        constexpr operator auto() const& { return ToString(); }
+        constexpr operator auto() && { return Move(*this).ToString(); }
 
-        usize     TotalLength() const { return m_Length; }
-        using SegmentType = BasicString<C, Traits>;
+        usize TotalLength() const { return Size(); }
 
       private:
-        constexpr static usize MAX_SEGMENT_SIZE = 128;
+        StringType m_Buffer;
 
-        constexpr SegmentType& Segment() { return m_Segments.Tail(); }
-        constexpr void         Reinvalidate()
+        // Grows the buffer by @p count characters and returns the first one
+        // for the caller to fill in
+        constexpr C* Extend(usize count)
         {
-            auto& segment = Segment();
-            if (segment.Size() < MAX_SEGMENT_SIZE) return;
+            usize size = Size();
+            m_Buffer.Resize(size + count);
 
-            auto& newSegment = m_Segments.EmplaceBack();
-            newSegment.Reserve(MAX_SEGMENT_SIZE);
+            return m_Buffer.Raw() + size;
         }
-
-        DoublyLinkedList<SegmentType> m_Segments;
-        usize                         m_Length;
     };
 }; // namespace Prism
 
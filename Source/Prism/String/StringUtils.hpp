@@ -6,8 +6,11 @@
  */
 #pragma once
 
+#include <Prism/Core/Bits.hpp>
 #include <Prism/Core/Compiler.hpp>
+#include <Prism/Core/Limits.hpp>
 #include <Prism/Core/Types.hpp>
+#include <Prism/Memory/Memory.hpp>
 
 #include <Prism/String/CodePoints.hpp>
 #include <Prism/String/String.hpp>
@@ -19,9 +22,16 @@ namespace Prism
 {
     namespace StringUtils
     {
+        using CodePoints::CharacterClass;
+        using CodePoints::CompareIgnoreCase;
+        using CodePoints::CountIf;
+        using CodePoints::EqualsIgnoreCase;
+        using CodePoints::FindFirstNonSpace;
+        using CodePoints::FindLastNonSpace;
         using CodePoints::IsAlpha;
         using CodePoints::IsAlphanumeric;
         using CodePoints::IsBlank;
+        using CodePoints::IsClass;
         using CodePoints::IsControl;
         using CodePoints::IsDigit;
         using CodePoints::IsGraph;
@@ -33,20 +43,165 @@ namespace Prism
         using CodePoints::IsUpper;
         using CodePoints::ToDigit;
         using CodePoints::ToLower;
+        using CodePoints::ToLowerInPlace;
         using CodePoints::ToUpper;
+        using CodePoints::ToUpperInPlace;
         constexpr usize Length(const char* str)
         {
             return StringView(str).Size();
         }
 
-        template <ArithmeticType T>
-        constexpr usize GetDigitCount(T value)
+        namespace Detail
         {
-            usize result = 1;
-            for (usize i = 10; static_cast<usize>(value) >= i; i *= 10)
-                ++result;
+            constexpr u64 POWERS_OF_TEN[] = {
+                1ull,
+                10ull,
+                100ull,
+                1000ull,
+                10000ull,
+                100000ull,
+                1000000ull,
+                10000000ull,
+                100000000ull,
+                1000000000ull,
+                10000000000ull,
+                100000000000ull,
+                1000000000000ull,
+                10000000000000ull,
+                100000000000000ull,
+                1000000000000000ull,
+                10000000000000000ull,
+                100000000000000000ull,
+                1000000000000000000ull,
+                10000000000000000000ull,
+            };
+            constexpr char TWO_DIGITS[] = "00010203040506070809"
+                                          "10111213141516171819"
+                                          "20212223242526272829"
+                                          "30313233343536373839"
+                                          "40414243444546474849"
+                                          "50515253545556575859"
+                                          "60616263646566676869"
+                                          "70717273747576777879"
+                                          "80818283848586878889"
+                                          "90919293949596979899";
+            constexpr char DIGITS[]
+                = "0123456789abcdefghijklmnopqrstuvwxyz";
 
-            return result;
+            template <Integral T>
+            constexpr typename MakeUnsigned<T>::Type Magnitude(T value)
+            {
+                using U = typename MakeUnsigned<T>::Type;
+                if constexpr (IsSignedV<T>)
+                    return value < 0 ? static_cast<U>(0 - static_cast<U>(value))
+                                     : static_cast<U>(value);
+                else return value;
+            }
+
+            template <UnsignedIntegral U>
+            constexpr usize DecimalDigitCount(U value)
+            {
+                static_assert(sizeof(U) <= sizeof(u64));
+
+                // log10(x) ~= log2(x) * 1233 / 4096, corrected by one
+                // comparison against the next power of ten
+                const u64   x     = static_cast<u64>(value) | 1;
+                const usize guess = (BitWidth(x) * 1233) >> 12;
+                return guess + (x >= POWERS_OF_TEN[guess]);
+            }
+            template <UnsignedIntegral U>
+            constexpr usize DigitCount(U value, u32 base)
+            {
+                if (base == 10) return DecimalDigitCount(value);
+                if (HasSingleBit(base))
+                {
+                    const usize shift = CountRightZero(base);
+                    return (BitWidth(static_cast<U>(value | 1)) + shift - 1)
+                         / shift;
+                }
+
+                usize count = 1;
+                for (; value >= base; value /= base) ++count;
+                return count;
+            }
+
+            // Writes the digits of value ending right before end, which
+            // must leave room for exactly the digit count
+            template <UnsignedIntegral U>
+            constexpr void WriteDecimal(char* end, U value)
+            {
+                while (value >= 100)
+                {
+                    const usize index = static_cast<usize>(value % 100) * 2;
+                    value /= 100;
+                    *--end = TWO_DIGITS[index + 1];
+                    *--end = TWO_DIGITS[index];
+                }
+
+                if (value >= 10)
+                {
+                    const usize index = static_cast<usize>(value) * 2;
+                    *--end            = TWO_DIGITS[index + 1];
+                    *--end            = TWO_DIGITS[index];
+                }
+                else *--end = static_cast<char>('0' + value);
+            }
+            template <UnsignedIntegral U>
+            constexpr void WriteDigits(char* end, U value, u32 base)
+            {
+                if (base == 10) return WriteDecimal(end, value);
+                if (HasSingleBit(base))
+                {
+                    const usize shift = CountRightZero(base);
+                    const U     mask  = base - 1;
+                    do *--end = DIGITS[value & mask];
+                    while ((value >>= shift) != 0);
+                    return;
+                }
+
+                do *--end = DIGITS[value % base];
+                while ((value /= base) != 0);
+            }
+
+            constexpr u64 SWAR_ZEROES = 0x3030303030303030ull;
+            constexpr u64 SWAR_HIGH   = 0xf0f0f0f0f0f0f0f0ull;
+
+            // True if all eight bytes of chunk are ASCII digits: each high
+            // nibble must be 3, and still be 3 after adding 6 to the byte
+            constexpr bool IsEightDigits(u64 chunk)
+            {
+                const u64 carried = (chunk + 0x0606060606060606ull) & SWAR_HIGH;
+                return ((chunk & SWAR_HIGH) | (carried >> 4))
+                    == 0x3333333333333333ull;
+            }
+            // Converts eight ASCII digits, the first in the lowest byte, with
+            // three multiplications instead of eight multiply-adds
+            constexpr u32 ParseEightDigits(u64 chunk)
+            {
+                constexpr u64 MASK = 0x000000ff000000ffull;
+                constexpr u64 MUL1 = 100 + (1000000ull << 32);
+                constexpr u64 MUL2 = 1 + (10000ull << 32);
+
+                chunk -= SWAR_ZEROES;
+                chunk = (chunk * 10) + (chunk >> 8);
+                chunk = (((chunk & MASK) * MUL1)
+                         + (((chunk >> 16) & MASK) * MUL2))
+                     >> 32;
+                return static_cast<u32>(chunk);
+            }
+        }; // namespace Detail
+
+        /**
+         * @brief Number of digits needed to print @p value in @p base,
+         * excluding a sign.
+         *
+         * Decimal counts are derived from the bit width and a single
+         * table lookup instead of a loop.
+         */
+        template <Integral T>
+        constexpr usize GetDigitCount(T value, u32 base = 10)
+        {
+            return Detail::DigitCount(Detail::Magnitude(value), base);
         }
         constexpr bool IsNumber(StringView input)
         {
@@ -56,55 +211,160 @@ namespace Prism
             return true;
         }
 
-        template <ArithmeticType T>
-        constexpr StringView ToString(T value, char* dest, i32 base = 10)
+        /**
+         * @brief Error codes reported by ToChars() and FromChars().
+         */
+        enum class CharsError
         {
-            const bool isNegative = value < 0 && base == 10;
+            eNone = 0,
+            /// FromChars(): the input does not start with a number
+            eInvalidArgument,
+            /// ToChars(): the destination buffer is too small
+            eValueTooLarge,
+            /// FromChars(): the number does not fit the target type
+            eResultOutOfRange,
+        };
+        struct ToCharsResult
+        {
+            char*      End;
+            CharsError Error = CharsError::eNone;
+        };
+        struct FromCharsResult
+        {
+            const char* End;
+            CharsError  Error = CharsError::eNone;
+        };
+
+        /**
+         * @brief Writes @p value in @p base (2 to 36) into [first, last)
+         * without a terminator.
+         *
+         * Decimal output is produced two digits per division using a lookup
+         * table, straight into its final position.
+         *
+         * @return One past the last written character, or last and
+         * CharsError::eValueTooLarge if the buffer is too small; the buffer
+         * contents are unspecified in that case.
+         */
+        template <Integral T>
+        constexpr ToCharsResult ToChars(char* first, char* last, T value,
+                                        u32 base = 10)
+        {
+            assert(base >= 2 && base <= 36);
 
-            char*      str        = dest;
-            T          i          = 0;
-            if (value == 0)
+            const auto  magnitude = Detail::Magnitude(value);
+            const bool  negative  = value < 0;
+            const usize length = Detail::DigitCount(magnitude, base) + negative;
+            if (static_cast<usize>(last - first) < length)
+                return {last, CharsError::eValueTooLarge};
+
+            if (negative) *first = '-';
+            Detail::WriteDigits(first + length, magnitude, base);
+
+            return {first + length};
+        }
+
+        /**
+         * @brief Parses an integer in @p base (2 to 36) from [first, last).
+         *
+         * Accepts an optional '-' for signed types, followed by digits;
+         * parsing stops at the first character that is not a digit. Runs of
+         * eight decimal digits are converted at once with SWAR arithmetic.
+         *
+         * @return One past the last consumed character and an error code;
+         * @p value is only written on success.
+         */
+        template <Integral T>
+        constexpr FromCharsResult FromChars(const char* first,
+                                            const char* last, T& value,
+                                            u32 base = 10)
+        {
+            assert(base >= 2 && base <= 36);
+            using U                 = typename MakeUnsigned<T>::Type;
+
+            const char* current     = first;
+            bool        negative    = false;
+            if constexpr (IsSignedV<T>)
             {
-                str[i++] = '0';
-                str[i]   = 0;
-                return str;
+                negative = current != last && *current == '-';
+                current += negative;
             }
 
-            if (isNegative) value = -value;
+            const U limit = static_cast<U>(NumericLimits<T>::Max()) + negative;
+            const char* digits   = current;
+            U           result   = 0;
+            bool        overflow = false;
 
-            while (value != '\0')
+            if constexpr (sizeof(U) >= sizeof(u64)
+                          && Endian::eNative == Endian::eLittle)
             {
-                T rem    = value % base;
-                str[i++] = (rem > 9) ? static_cast<char>((rem - 10) + 'a')
-                                     : static_cast<char>(rem + '0');
-                value    = value / base;
-            }
+                if (base == 10 && !IsConstantEvaluated())
+                {
+                    for (; last - current >= 8; current += 8)
+                    {
+                        const u64 chunk = Memory::LoadUnaligned<u64>(current);
+                        if (!Detail::IsEightDigits(chunk)) break;
 
-            if (isNegative) str[i++] = '-';
-            str[i]       = '\0';
-            usize length = i;
+                        overflow |= __builtin_mul_overflow(result, U(100000000),
+                                                           &result);
+                        overflow |= __builtin_add_overflow(
+                            result, U(Detail::ParseEightDigits(chunk)),
+                            &result);
+                    }
+                }
+            }
 
-            T     start  = 0;
-            T     end    = i - 1;
-            while (start < end)
+            for (; current != last; ++current)
             {
-                Swap(*(str + start), *(str + end));
-                ++start;
-                --end;
+                const char ch = *current;
+                u32        digit;
+                if (ch >= '0' && ch <= '9') digit = ch - '0';
+                else if (ch >= 'a' && ch <= 'z') digit = ch - 'a' + 10;
+                else if (ch >= 'A' && ch <= 'Z') digit = ch - 'A' + 10;
+                else break;
+                if (digit >= base) break;
+
+                overflow |= __builtin_mul_overflow(result, U(base), &result);
+                overflow |= __builtin_add_overflow(result, U(digit), &result);
             }
 
-            return {str, length};
+            if (current == digits) return {first, CharsError::eInvalidArgument};
+            if (overflow || result > limit)
+                return {current, CharsError::eResultOutOfRange};
+
+            value = negative ? static_cast<T>(0 - result)
+                             : static_cast<T>(result);
+            return {current};
         }
-        template <ArithmeticType T>
-        constexpr String ToString(T value, i32 base = 10)
+        template <Integral T>
+        constexpr FromCharsResult FromChars(StringView string, T& value,
+                                            u32 base = 10)
         {
-            const bool  isNegative = value < 0 && base == 10;
-            const usize size       = GetDigitCount(value) + isNegative + 1;
+            return FromChars(string.Raw(), string.Raw() + string.Size(), value,
+                             base);
+        }
 
-            String      string;
-            string.Reserve(size);
+        /**
+         * @brief Writes @p value followed by a null terminator into
+         * @p dest, which must have room for both.
+         */
+        template <Integral T>
+        constexpr StringView ToString(T value, char* dest, i32 base = 10)
+        {
+            // 64 binary digits, a sign and the terminator
+            char* end = ToChars(dest, dest + 66, value, base).End;
+            *end      = '\0';
 
-            return ToString(value, string.Raw(), base);
+            return {dest, static_cast<usize>(end - dest)};
+        }
+        template <Integral T>
+        constexpr String ToString(T value, i32 base = 10)
+        {
+            char  buffer[66];
+            char* end
+                = ToChars(buffer, buffer + sizeof(buffer), value, base).End;
+
+            return String(buffer, static_cast<usize>(end - buffer));
         }
 
         template <EnumType T>
@@ -115,23 +375,17 @@ namespace Prism
             return StringView(str.data(), str.size());
         }
 
-        template <ArithmeticType T>
+        /**
+         * @brief Parses a number with FromChars(), returning 0 if @p string
+         * does not start with one or the value is out of range.
+         */
+        template <Integral T>
         constexpr T ToNumber(StringView string, usize base = 10)
         {
-            if (string.Empty()) return {};
-            bool isNegative = string[0] == '-';
-
-            T    number     = 0;
-            for (usize i = isNegative; i < string.Size(); ++i)
-            {
-                u8 c     = string[i];
-                T  digit = ToDigit<T>(c);
-
-                if (static_cast<usize>(digit) >= base) break;
-                number = number * base + digit;
-            }
+            T number = 0;
+            FromChars(string, number, static_cast<u32>(base));
 
-            return isNegative ? -number : number;
+            return number;
         }
     }; // namespace StringUtils
 }; // namespace Prism
@@ -139,7 +393,9 @@ namespace Prism
 #if PRISM_USE_NAMESPACE != 0
 namespace StringUtils = Prism::StringUtils;
 
+using Prism::StringUtils::FromChars;
 using Prism::StringUtils::GetDigitCount;
+using Prism::StringUtils::ToChars;
 using Prism::StringUtils::ToNumber;
 using Prism::StringUtils::ToString;
 #endif
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <Prism/Algorithm/SearchString.hpp>
+#include <Prism/Algorithm/WyHash.hpp>
 #include <Prism/Containers/Vector.hpp>
 #include <Prism/Core/Concepts.hpp>
 #include <Prism/Core/Core.hpp>
@@ -284,6 +285,8 @@ namespace Prism
          * @brief Splits the view by a delimiter character.
          * @param delimiter Character to split on.
          * @return Vector of BasicString segments (may be empty).
+         * @see Prism::Split (SplitView.hpp) to iterate the segments without
+         * allocating.
          */
         inline Vector<BasicString<C, Traits>> Split(C delimiter) const
         {
@@ -333,23 +336,35 @@ namespace Prism
         constexpr BasicStringView<C, Traits> Trim(TrimMode mode
                                                   = TrimMode::eBoth) const
         {
-            if (Empty()) return BasicString<C, Traits>();
-
             usize start = 0;
             usize end   = Size();
 
-            using CodePoints::IsSpace;
-            while ((mode != TrimMode::eRight) && start < end
-                   && IsSpace(Raw()[start]))
-                ++start;
-
-            while ((mode != TrimMode::eLeft) && end > start
-                   && IsSpace(Raw()[end - 1]))
-                --end;
-            auto newSize = end - start;
+            if constexpr (sizeof(C) == 1)
+            {
+                // Whole blocks of whitespace are skipped at a time; a
+                // missing non-space character yields usize(-1), which
+                // collapses the view
+                if (mode != TrimMode::eRight)
+                    start = Min(CodePoints::FindFirstNonSpace(m_Data, end),
+                                end);
+                if (mode != TrimMode::eLeft)
+                    end = start + 1
+                        + CodePoints::FindLastNonSpace(m_Data + start,
+                                                       end - start);
+            }
+            else
+            {
+                using CodePoints::IsSpace;
+                while ((mode != TrimMode::eRight) && start < end
+                       && IsSpace(Raw()[start]))
+                    ++start;
+
+                while ((mode != TrimMode::eLeft) && end > start
+                       && IsSpace(Raw()[end - 1]))
+                    --end;
+            }
 
-            return start >= Size() ? BasicStringView<C, Traits>("")
-                                   : Substr(start, newSize);
+            return BasicStringView<C, Traits>(m_Data + start, end - start);
         }
         /**
          * @brief Creates a substring view starting at `pos` up to `count`
@@ -450,6 +465,30 @@ namespace Prism
         {
             return Substr(pos, count1).Compare(BasicStringView(str, count2));
         }
+        /**
+         * @brief Compare against another view, treating ASCII upper- and
+         * lower-case letters as equal.
+         */
+        PM_NODISCARD
+        constexpr i32 CompareIgnoreCase(BasicStringView other) const
+            PM_NOEXCEPT
+            requires(sizeof(C) == 1)
+        {
+            return CodePoints::CompareIgnoreCase(m_Data, m_Size, other.m_Data,
+                                                 other.m_Size);
+        }
+        /**
+         * @brief Check for equality, treating ASCII upper- and lower-case
+         * letters as equal.
+         */
+        PM_NODISCARD
+        constexpr bool EqualsIgnoreCase(BasicStringView other) const
+            PM_NOEXCEPT
+            requires(sizeof(C) == 1)
+        {
+            return CodePoints::EqualsIgnoreCase(m_Data, m_Size, other.m_Data,
+                                                other.m_Size);
+        }
         ///@}
 
         /**
@@ -564,9 +603,7 @@ namespace Prism
         {
             if (pos >= Size() || pattern.Empty()) return NPos;
 
-            auto  view   = Substr(pos);
-            usize result = Algorithm::FindStringKMP(view, pattern);
-
+            usize result = Algorithm::FindString(Substr(pos), pattern);
             return result == usize(-1) ? NPos : result + pos;
         }
         /**
@@ -594,9 +631,32 @@ namespace Prism
         constexpr SizeType Find(ValueType ch,
                                 SizeType  pos = 0) const PM_NOEXCEPT
         {
-            return Find(BasicStringView(AddressOf(ch), 1), pos);
+            if (pos >= Size()) return NPos;
+
+            usize result
+                = Algorithm::FindCharacter(m_Data + pos, m_Size - pos, ch);
+            return result == usize(-1) ? NPos : result + pos;
         }
 
+        /**
+         * @brief Reverse search for a view.
+         * @param pattern View to find.
+         * @param pos     Last index at which a match may start.
+         * @return Position of the last match starting at or before `pos`,
+         * or NPos.
+         */
+        PM_NODISCARD
+        constexpr SizeType RFind(BasicStringView pattern,
+                                 SizeType        pos = NPos) const PM_NOEXCEPT
+        {
+            if (pattern.Size() > Size()) return NPos;
+
+            usize start  = Min(pos, Size() - pattern.Size());
+            usize result = Algorithm::FindLastString(
+                Substr(0, start + pattern.Size()), pattern);
+
+            return result == usize(-1) ? NPos : result;
+        }
         /**
          * @brief Reverse search for a C-string slice.
          */
@@ -621,29 +681,22 @@ namespace Prism
         PM_NODISCARD
         constexpr SizeType RFind(C ch, SizeType pos = NPos) const PM_NOEXCEPT
         {
-            return RFind(BasicStringView(AddressOf(ch), 1), pos);
+            if (Empty()) return NPos;
+
+            usize result = Algorithm::FindLastCharacter(
+                m_Data, Min(pos, Size() - 1) + 1, ch);
+            return result == usize(-1) ? NPos : result;
         }
         /**
          * @brief Reverse search for any string‑view‑like object.
-         * @tparam StringViewLike Supports `.Size()` and KMP search.
+         * @tparam StringViewLike Supports `.Raw()` and `.Size()`.
          */
         template <typename StringViewLike>
         PM_NODISCARD constexpr SizeType
-        RFind(const StringViewLike& pattern, SizeType pos = 0) const PM_NOEXCEPT
+        RFind(const StringViewLike& pattern,
+              SizeType              pos = NPos) const PM_NOEXCEPT
         {
-            if (pattern.Size() > Size()) return NPos;
-
-            usize limit = (pos >= Size() ? Size() : pos + 1);
-            usize start = limit - pattern.Size();
-
-            do
-            {
-                auto substr = Substr(start);
-                if (Algorithm::FindStringKMP(substr, pattern) == 0)
-                    return start;
-            } while (start-- > 0);
-
-            return NPos;
+            return RFind(BasicStringView(pattern.Raw(), pattern.Size()), pos);
         }
 
         /**
@@ -907,18 +960,14 @@ namespace Prism
 
     namespace Detail
     {
-        template <typename C,
-                  typename StringType = BasicString<C, CharTraits<C>>>
+        /// Hashes strings and views of @p C alike, see WyHash
+        template <typename C>
         struct StringHashBase
         {
-            PM_NODISCARD
-            constexpr usize operator()(const StringType& str) const PM_NOEXCEPT
+            PM_NODISCARD constexpr usize
+            operator()(BasicStringView<C, CharTraits<C>> str) const PM_NOEXCEPT
             {
-                const u8*   key    = reinterpret_cast<const u8*>(str.Raw());
-                usize       length = str.Size() * sizeof(C);
-                const usize seed   = 0xc70f6907ul;
-
-                return Murmur::Hash2(const_cast<u8*>(key), length, seed);
+                return WyHash::Hash(str.Raw(), str.Size());
             }
         };
     }; // namespace Detail
@@ -929,55 +978,23 @@ namespace Prism
     {
     };
     template <>
-    struct IsFastHash<Hash<StringView>> : FalseType
-    {
-    };
-    template <>
     struct Hash<BasicStringView<wchar_t, CharTraits<wchar_t>>>
         : public Detail::StringHashBase<wchar_t>
     {
     };
-
-    template <>
-    struct IsFastHash<Hash<BasicStringView<wchar_t, CharTraits<wchar_t>>>>
-        : FalseType
-    {
-    };
-
     template <>
     struct Hash<BasicStringView<char8_t, CharTraits<char8_t>>>
         : public Detail::StringHashBase<char8_t>
     {
     };
-    template <>
-    struct IsFastHash<Hash<BasicStringView<char8_t, CharTraits<char8_t>>>>
-        : FalseType
-    {
-    };
-
     template <>
     struct Hash<BasicStringView<char16_t, CharTraits<char16_t>>>
-        : public Detail::StringHashBase<
-              usize, BasicStringView<char16_t, CharTraits<char16_t>>>
-    {
-    };
-
-    template <>
-    struct IsFastHash<Hash<BasicStringView<char16_t, CharTraits<char16_t>>>>
-        : FalseType
+        : public Detail::StringHashBase<char16_t>
     {
     };
-
     template <>
     struct Hash<BasicStringView<char32_t, CharTraits<char32_t>>>
-        : public Detail::StringHashBase<
-              usize, BasicStringView<char32_t, CharTraits<char32_t>>>
-    {
-    };
-
-    template <>
-    struct IsFastHash<Hash<BasicStringView<char32_t, CharTraits<char32_t>>>>
-        : FalseType
+        : public Detail::StringHashBase<char32_t>
     {
     };
 }; // namespace Prism
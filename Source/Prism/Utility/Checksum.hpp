@@ -1,63 +1,530 @@
 /*
  * Created by v1tr10l7 on 07.04.2025.
- * Copyright (c) 2024-2025, Szymon Zemke <v1tr10l7@proton.me>
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
  *
  * SPDX-License-Identifier: GPL-3
  */
 #pragma once
 
+#include <Prism/Algorithm/Hasher.hpp>
 #include <Prism/Containers/Array.hpp>
+#include <Prism/Core/TypeTraits.hpp>
 #include <Prism/Memory/ByteStream.hpp>
 
+#if PRISM_TARGET_CRYPTIX == 0
+    #if defined(PRISM_TARGET_X86_64) && defined(__SSE4_2__)
+        #include <nmmintrin.h>
+        #define PRISM_CRC32C_HARDWARE 1
+    #elif defined(PRISM_TARGET_AARCH64) && defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>
+        #define PRISM_CRC32_HARDWARE  1
+        #define PRISM_CRC32C_HARDWARE 1
+    #endif
+
+    #if defined(PRISM_TARGET_X86_64) && defined(__PCLMUL__)                   \
+        && PRISM_SIMD_SSE2_PRESENT
+        #include <wmmintrin.h>
+        #define PRISM_CRC_FOLDING 1
+    #elif defined(PRISM_TARGET_AARCH64) && PRISM_SIMD_NEON_PRESENT            \
+        && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+        #include <arm_neon.h>
+        #define PRISM_CRC_FOLDING 1
+    #endif
+
+    #if PRISM_SIMD_SSE2_PRESENT || PRISM_SIMD_NEON_PRESENT
+        #include <Prism/Utility/SimdIntrinsics.hpp>
+        #define PRISM_ADLER32_SIMD 1
+    #endif
+#endif
+
+#ifndef PRISM_CRC32_HARDWARE
+    #define PRISM_CRC32_HARDWARE 0
+#endif
+#ifndef PRISM_CRC32C_HARDWARE
+    #define PRISM_CRC32C_HARDWARE 0
+#endif
+#ifndef PRISM_CRC_FOLDING
+    #define PRISM_CRC_FOLDING 0
+#endif
+#ifndef PRISM_ADLER32_SIMD
+    #define PRISM_ADLER32_SIMD 0
+#endif
+
 namespace Prism
 {
-    namespace CRC32
+    namespace Detail
     {
-        constexpr u32 CRC32_POLY = 0xedb88320;
-
-        constexpr u32 GenerateTableEntry(i32 i)
+        constexpr u32 CrcTableEntry(u32 polynomial, u32 index)
         {
-            u32 crc = i;
+            u32 crc = index;
             for (i32 j = 0; j < 8; ++j)
-                crc = (crc >> 1) ^ ((crc & 1) ? CRC32_POLY : 0);
+                crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
             return crc;
         }
 
-        inline u32 DoChecksum(const u8* data, usize length)
+        /**
+         * @brief Tables for slicing-by-8: entry [k][i] is the CRC of byte i
+         * followed by k zero bytes, so eight bytes are folded into the CRC
+         * with eight independent lookups instead of a chain of eight.
+         */
+        template <u32 Polynomial>
+        struct CrcTables
+        {
+            u32 Entries[8][256];
+
+            consteval CrcTables()
+                : Entries{}
+            {
+                for (u32 i = 0; i < 256; ++i)
+                    Entries[0][i] = CrcTableEntry(Polynomial, i);
+                for (usize k = 1; k < 8; ++k)
+                    for (u32 i = 0; i < 256; ++i)
+                    {
+                        u32 previous  = Entries[k - 1][i];
+                        Entries[k][i] = (previous >> 8)
+                                      ^ Entries[0][previous & 0xff];
+                    }
+            }
+        };
+        template <u32 Polynomial>
+        inline constexpr CrcTables<Polynomial> CRC_TABLES{};
+
+        constexpr u32 LoadLittleEndian32(const u8* data)
+        {
+            return u32(data[0]) | u32(data[1]) << 8 | u32(data[2]) << 16
+                 | u32(data[3]) << 24;
+        }
+
+        template <u32 Polynomial>
+        constexpr u32 CrcSliced(u32 state, const u8* data, usize size)
+        {
+            constexpr auto& table = CRC_TABLES<Polynomial>.Entries;
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                u32 low  = LoadLittleEndian32(data) ^ state;
+                u32 high = LoadLittleEndian32(data + 4);
+
+                state    = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff]
+                      ^ table[5][(low >> 16) & 0xff] ^ table[4][low >> 24]
+                      ^ table[3][high & 0xff] ^ table[2][(high >> 8) & 0xff]
+                      ^ table[1][(high >> 16) & 0xff] ^ table[0][high >> 24];
+            }
+            for (; size; --size)
+                state = (state >> 8) ^ table[0][(state ^ *data++) & 0xff];
+
+            return state;
+        }
+
+        constexpr u32 CRC32_POLYNOMIAL  = 0xedb88320;
+        constexpr u32 CRC32C_POLYNOMIAL = 0x82f63b78;
+
+        /// Whether the CPU has an instruction computing this CRC
+        template <u32 Polynomial>
+        constexpr bool HAS_CRC_INSTRUCTION
+            = (Polynomial == CRC32_POLYNOMIAL && PRISM_CRC32_HARDWARE)
+           || (Polynomial == CRC32C_POLYNOMIAL && PRISM_CRC32C_HARDWARE);
+
+#if PRISM_CRC32_HARDWARE || PRISM_CRC32C_HARDWARE
+        template <u32 Polynomial>
+        inline u32 CrcHardware(u32 state, const u8* data, usize size)
+        {
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                u64 word;
+                __builtin_memcpy(&word, data, sizeof(word));
+    #ifdef PRISM_TARGET_X86_64
+                state = static_cast<u32>(_mm_crc32_u64(state, word));
+    #else
+                if constexpr (Polynomial == CRC32_POLYNOMIAL)
+                    state = __crc32d(state, word);
+                else state = __crc32cd(state, word);
+    #endif
+            }
+            for (; size; --size)
+    #ifdef PRISM_TARGET_X86_64
+                state = _mm_crc32_u8(state, *data++);
+    #else
+                if constexpr (Polynomial == CRC32_POLYNOMIAL)
+                    state = __crc32b(state, *data++);
+                else state = __crc32cb(state, *data++);
+    #endif
+
+            return state;
+        }
+#endif
+
+        /// Continues @p state over @p data on the fastest scalar path
+        template <u32 Polynomial>
+        inline u32 CrcBlock(u32 state, const u8* data, usize size)
+        {
+#if PRISM_CRC32_HARDWARE || PRISM_CRC32C_HARDWARE
+            if constexpr (HAS_CRC_INSTRUCTION<Polynomial>)
+                return CrcHardware<Polynomial>(state, data, size);
+#endif
+            return CrcSliced<Polynomial>(state, data, size);
+        }
+
+#if PRISM_CRC_FOLDING
+        /// Buffers shorter than this are not worth setting up folding for
+        constexpr usize CRC_FOLD_THRESHOLD = 128;
+
+        /**
+         * @brief x^exponent mod P in the bit-reflected domain, shifted left
+         * once as carry-less multiplication of reflected operands requires.
+         */
+        consteval u64 CrcFoldKey(u32 polynomial, usize exponent)
+        {
+            // Bit 31 holds x^0 and multiplying by x shifts right
+            u32 remainder = 0x80000000;
+            for (usize i = 0; i < exponent; ++i)
+                remainder
+                    = (remainder >> 1) ^ ((remainder & 1) ? polynomial : 0);
+
+            return u64(remainder) << 1;
+        }
+
+    #ifdef PRISM_TARGET_X86_64
+        using FoldLane = __m128i;
+
+        PM_ALWAYS_INLINE FoldLane FoldLoad(const u8* data)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        }
+        PM_ALWAYS_INLINE FoldLane FoldKeys(u64 low, u64 high)
+        {
+            return _mm_set_epi64x(static_cast<i64>(high),
+                                  static_cast<i64>(low));
+        }
+        PM_ALWAYS_INLINE FoldLane FoldXor(FoldLane lhs, FoldLane rhs)
+        {
+            return _mm_xor_si128(lhs, rhs);
+        }
+        /// Multiplies each half of @p lane by the matching half of @p keys
+        PM_ALWAYS_INLINE FoldLane FoldMultiply(FoldLane lane, FoldLane keys)
+        {
+            return _mm_xor_si128(_mm_clmulepi64_si128(lane, keys, 0x00),
+                                 _mm_clmulepi64_si128(lane, keys, 0x11));
+        }
+        PM_ALWAYS_INLINE void FoldStore(u8* data, FoldLane lane)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data), lane);
+        }
+    #else
+        using FoldLane = uint64x2_t;
+
+        PM_ALWAYS_INLINE FoldLane FoldLoad(const u8* data)
+        {
+            return vreinterpretq_u64_u8(vld1q_u8(data));
+        }
+        PM_ALWAYS_INLINE FoldLane FoldKeys(u64 low, u64 high)
+        {
+            return vcombine_u64(vcreate_u64(low), vcreate_u64(high));
+        }
+        PM_ALWAYS_INLINE FoldLane FoldXor(FoldLane lhs, FoldLane rhs)
+        {
+            return veorq_u64(lhs, rhs);
+        }
+        PM_ALWAYS_INLINE FoldLane FoldMultiply(FoldLane lane, FoldLane keys)
+        {
+            poly128_t low  = vmull_p64(vgetq_lane_u64(lane, 0),
+                                       vgetq_lane_u64(keys, 0));
+            poly128_t high = vmull_high_p64(vreinterpretq_p64_u64(lane),
+                                            vreinterpretq_p64_u64(keys));
+
+            return veorq_u64(vreinterpretq_u64_p128(low),
+                             vreinterpretq_u64_p128(high));
+        }
+        PM_ALWAYS_INLINE void FoldStore(u8* data, FoldLane lane)
+        {
+            vst1q_u8(data, vreinterpretq_u8_u64(lane));
+        }
+    #endif
+
+        /**
+         * @brief Continues @p state over @p size bytes, a multiple of 16 and
+         * at least 64, by carry-less multiplication.
+         *
+         * Four 128-bit lanes are folded 64 bytes ahead at a time, then into
+         * one lane. That lane is congruent to the whole input (with the
+         * state mixed into its first bytes) modulo the polynomial, so its
+         * CRC from a zero state is the CRC of the input.
+         */
+        template <u32 Polynomial>
+        inline u32 CrcFold(u32 state, const u8* data, usize size)
         {
-            static Array<u32, 256> table       = {};
-            static bool            initialized = false;
+            constexpr u64  K1    = CrcFoldKey(Polynomial, 512 + 32);
+            constexpr u64  K2    = CrcFoldKey(Polynomial, 512 - 32);
+            constexpr u64  K3    = CrcFoldKey(Polynomial, 128 + 32);
+            constexpr u64  K4    = CrcFoldKey(Polynomial, 128 - 32);
 
-            if (!initialized)
+            const FoldLane byFour = FoldKeys(K1, K2);
+            const FoldLane byOne  = FoldKeys(K3, K4);
+
+            FoldLane       lane0 = FoldXor(FoldLoad(data), FoldKeys(state, 0));
+            FoldLane       lane1 = FoldLoad(data + 16);
+            FoldLane       lane2 = FoldLoad(data + 32);
+            FoldLane       lane3 = FoldLoad(data + 48);
+            data += 64;
+            size -= 64;
+
+            for (; size >= 64; data += 64, size -= 64)
             {
-                for (i32 i = 0; i < 256; ++i) table[i] = GenerateTableEntry(i);
-                initialized = true;
+                lane0 = FoldXor(FoldMultiply(lane0, byFour), FoldLoad(data));
+                lane1 = FoldXor(FoldMultiply(lane1, byFour),
+                                FoldLoad(data + 16));
+                lane2 = FoldXor(FoldMultiply(lane2, byFour),
+                                FoldLoad(data + 32));
+                lane3 = FoldXor(FoldMultiply(lane3, byFour),
+                                FoldLoad(data + 48));
             }
 
-            u32 crc = 0xffffffff;
-            for (usize i = 0; i < length; ++i)
-                crc = (crc >> 8) ^ table[(crc ^ data[i]) & 0xFF];
+            lane0 = FoldXor(FoldMultiply(lane0, byOne), lane1);
+            lane0 = FoldXor(FoldMultiply(lane0, byOne), lane2);
+            lane0 = FoldXor(FoldMultiply(lane0, byOne), lane3);
+            for (; size >= 16; data += 16, size -= 16)
+                lane0 = FoldXor(FoldMultiply(lane0, byOne), FoldLoad(data));
+
+            alignas(16) u8 folded[16];
+            FoldStore(folded, lane0);
+
+            return CrcBlock<Polynomial>(0, folded, sizeof(folded));
+        }
+#endif
+
+        /**
+         * @brief Extends the checksum @p crc of some data by @p size more
+         * bytes.
+         *
+         * Large buffers are folded with carry-less multiplication, the rest
+         * goes through the CRC instruction where the CPU has one for this
+         * polynomial, or slicing-by-8 otherwise.
+         */
+        template <u32 Polynomial>
+        constexpr u32 CrcUpdate(u32 crc, const u8* data, usize size)
+        {
+            u32 state = ~crc;
+            if (IsConstantEvaluated())
+                return ~CrcSliced<Polynomial>(state, data, size);
+
+#if PRISM_CRC_FOLDING
+            if (size >= CRC_FOLD_THRESHOLD)
+            {
+                usize folded = size & ~usize(15);
+                state        = CrcFold<Polynomial>(state, data, folded);
 
-            return ~crc;
+                data += folded;
+                size -= folded;
+            }
+#endif
+
+            return ~CrcBlock<Polynomial>(state, data, size);
         }
+
+        /// A StreamingHasher over a checksum with an Update() function
+        template <u32 (*UpdateChecksum)(u32, const u8*, usize), u32 Initial>
+        class ChecksumHasher
+        {
+          public:
+            using ResultType = u32;
+
+            constexpr void Update(Span<const u8> bytes)
+            {
+                m_Checksum = UpdateChecksum(m_Checksum, bytes.Raw(),
+                                            bytes.Size());
+            }
+            constexpr u32 Finalize() const { return m_Checksum; }
+
+          private:
+            u32 m_Checksum = Initial;
+        };
+    }; // namespace Detail
+
+    namespace CRC32
+    {
+        constexpr u32 CRC32_POLY = Detail::CRC32_POLYNOMIAL;
+        /// The checksum of no data, to start an incremental checksum from
+        constexpr u32 INITIAL    = 0;
+
+        constexpr u32 GenerateTableEntry(i32 i)
+        {
+            return Detail::CrcTableEntry(CRC32_POLY, i);
+        }
+
+        /**
+         * @brief Extends the checksum @p crc by @p length more bytes, so
+         * that Update(DoChecksum(a), b) equals the checksum of a followed
+         * by b.
+         */
+        constexpr u32 Update(u32 crc, const u8* data, usize length)
+        {
+            return Detail::CrcUpdate<CRC32_POLY>(crc, data, length);
+        }
+        constexpr u32 DoChecksum(const u8* data, usize length)
+        {
+            return Update(INITIAL, data, length);
+        }
+
+        using Hasher = Detail::ChecksumHasher<Update, INITIAL>;
     }; // namespace CRC32
+    /**
+     * @brief CRC-32C, the Castagnoli polynomial used by iSCSI, ext4 and
+     * btrfs metadata, which x86 computes natively since SSE4.2.
+     */
+    namespace CRC32C
+    {
+        constexpr u32 CRC32C_POLY = Detail::CRC32C_POLYNOMIAL;
+        constexpr u32 INITIAL     = 0;
+
+        constexpr u32 Update(u32 crc, const u8* data, usize length)
+        {
+            return Detail::CrcUpdate<CRC32C_POLY>(crc, data, length);
+        }
+        constexpr u32 DoChecksum(const u8* data, usize length)
+        {
+            return Update(INITIAL, data, length);
+        }
+
+        using Hasher = Detail::ChecksumHasher<Update, INITIAL>;
+    }; // namespace CRC32C
+
+    namespace Detail
+    {
+#if PRISM_ADLER32_SIMD
+        /**
+         * @brief Adds @p blocks 16-byte blocks to the Adler-32 sums without
+         * reducing them.
+         *
+         * Over a block, a grows by the sum of its bytes and b by 16 times a
+         * as it was before the block plus the bytes weighted 16 down to 1.
+         * The lanes keep the byte sums, their running total and the
+         * weighted sums apart and are only added up at the end.
+         */
+        inline void Adler32Simd(u32& a, u32& b, const u8* data, usize blocks)
+        {
+            b += a * 16 * static_cast<u32>(blocks);
+
+    #if PRISM_SIMD_SSE2_PRESENT
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i weightsLow
+                = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+            const __m128i weightsHigh = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+
+            __m128i       sums = zero, runningSums = zero, weighted = zero;
+            for (; blocks; --blocks, data += 16)
+            {
+                __m128i bytes
+                    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+                runningSums = _mm_add_epi32(runningSums, sums);
+                sums        = _mm_add_epi32(sums, _mm_sad_epu8(bytes, zero));
+                weighted    = _mm_add_epi32(
+                    weighted,
+                    _mm_madd_epi16(_mm_unpacklo_epi8(bytes, zero), weightsLow));
+                weighted = _mm_add_epi32(
+                    weighted,
+                    _mm_madd_epi16(_mm_unpackhi_epi8(bytes, zero),
+                                   weightsHigh));
+            }
+
+            auto horizontalSum = [](__m128i vector)
+            {
+                u32x4 lanes = reinterpret_cast<u32x4>(vector);
+                return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            };
+    #else
+            const uint8x8_t weightsLow  = {16, 15, 14, 13, 12, 11, 10, 9};
+            const uint8x8_t weightsHigh = {8, 7, 6, 5, 4, 3, 2, 1};
+
+            uint32x4_t      sums        = vdupq_n_u32(0);
+            uint32x4_t      runningSums = sums, weighted = sums;
+            for (; blocks; --blocks, data += 16)
+            {
+                uint8x16_t bytes = vld1q_u8(data);
+
+                runningSums      = vaddq_u32(runningSums, sums);
+                sums = vpadalq_u16(sums, vpaddlq_u8(bytes));
+
+                uint16x8_t products
+                    = vmull_u8(vget_low_u8(bytes), weightsLow);
+                products = vmlal_u8(products, vget_high_u8(bytes), weightsHigh);
+                weighted = vpadalq_u16(weighted, products);
+            }
+
+            auto horizontalSum = [](uint32x4_t vector)
+            { return vaddvq_u32(vector); };
+    #endif
+
+            a += horizontalSum(sums);
+            b += 16 * horizontalSum(runningSums) + horizontalSum(weighted);
+        }
+#endif
+    }; // namespace Detail
+
     namespace Adler32
     {
-        constexpr u32 MOD_ADLER = 65521;
+        constexpr u32   MOD_ADLER = 65521;
+        /// The checksum of no data, to start an incremental checksum from
+        constexpr u32   INITIAL   = 1;
+        /**
+         * @brief The most bytes that can be added up before the sums have to
+         * be reduced, or b could overflow 32 bits.
+         */
+        constexpr usize NMAX      = 5552;
 
-        constexpr u32 DoChecksum(const u8* data, usize len)
+        /**
+         * @brief Extends the checksum @p adler by @p length more bytes.
+         *
+         * The sums are reduced once per NMAX bytes rather than per byte, and
+         * whole 16-byte blocks are summed in vector lanes.
+         */
+        constexpr u32   Update(u32 adler, const u8* data, usize length)
         {
-            u32 a = 1, b = 0;
-            for (usize i = 0; i < len; ++i)
+            u32 a = adler & 0xffff;
+            u32 b = adler >> 16;
+            while (length)
             {
-                a = (a + data[i]) % MOD_ADLER;
-                b = (b + a) % MOD_ADLER;
+                usize chunk = length < NMAX ? length : NMAX;
+                length -= chunk;
+
+#if PRISM_ADLER32_SIMD
+                if (!IsConstantEvaluated() && chunk >= 16)
+                {
+                    usize blocks = chunk / 16;
+                    Detail::Adler32Simd(a, b, data, blocks);
+
+                    data += blocks * 16;
+                    chunk -= blocks * 16;
+                }
+#endif
+                for (; chunk >= 8; chunk -= 8)
+                    for (usize i = 0; i < 8; ++i)
+                    {
+                        a += *data++;
+                        b += a;
+                    }
+                for (; chunk; --chunk)
+                {
+                    a += *data++;
+                    b += a;
+                }
+
+                a %= MOD_ADLER;
+                b %= MOD_ADLER;
             }
+
             return (b << 16) | a;
         }
+        constexpr u32 DoChecksum(const u8* data, usize len)
+        {
+            return Update(INITIAL, data, len);
+        }
+
+        using Hasher = Detail::ChecksumHasher<Update, INITIAL>;
+        static_assert(StreamingHasher<Hasher>);
     }; // namespace Adler32
 }; // namespace Prism
 #if PRISM_TARGET_CRYPTIX != 0
 namespace CRC32   = Prism::CRC32;
+namespace CRC32C  = Prism::CRC32C;
 namespace Adler32 = Prism::Adler32;
 #endif
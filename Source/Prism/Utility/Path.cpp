@@ -13,6 +13,96 @@ namespace Prism
     {
         return View().Split(delimiter);
     }
+    Path& Path::Normalize()
+    {
+        if (Empty()) return *this;
+
+        ValueType* data = m_Path.Raw();
+        usize      size = Size();
+        // Components are written back at out, which never overtakes the
+        // read position; those before floor are leading ".." of a relative
+        // path, which a further ".." can not cancel
+        usize      root  = Absolute();
+        usize      out   = root;
+        usize      floor = root;
+
+        for (usize in = 0; in < size;)
+        {
+            while (in < size && data[in] == '/') ++in;
+            if (in == size) break;
+
+            usize start = in;
+            while (in < size && data[in] != '/') ++in;
+            usize length = in - start;
+
+            if (length == 1 && data[start] == '.') continue;
+            if (length == 2 && data[start] == '.' && data[start + 1] == '.')
+            {
+                if (out > floor)
+                {
+                    while (out > floor && data[out - 1] != '/') --out;
+                    if (out > floor) --out;
+                    continue;
+                }
+                // "/.." is "/"
+                if (root) continue;
+            }
+
+            if (out > root) data[out++] = '/';
+            TraitsType::Move(data + out, data + start, length);
+            out += length;
+
+            if (length == 2 && data[out - 1] == '.' && data[out - 2] == '.')
+                floor = out;
+        }
+
+        if (out == 0) data[out++] = '.';
+        m_Path.Resize(out);
+
+        return *this;
+    }
+    Path Path::Join(const PathView* parts, usize count)
+    {
+        // Past the first part, leading slashes only repeat the separator
+        auto body = [](bool first, PathView part)
+        {
+            StringView view  = part.StrView();
+            usize      start = 0;
+            while (!first && start < view.Size() && view[start] == '/') ++start;
+
+            return StringView(view.Raw() + start, view.Size() - start);
+        };
+
+        usize size          = 0;
+        bool  first         = true;
+        bool  endsWithSlash = false;
+        for (usize i = 0; i < count; ++i)
+        {
+            StringView part = body(first, parts[i]);
+            if (part.Empty()) continue;
+
+            size += (!first && !endsWithSlash) + part.Size();
+            endsWithSlash = part.Back() == '/';
+            first         = false;
+        }
+
+        String path;
+        path.Reserve(size);
+
+        first = true;
+        for (usize i = 0; i < count; ++i)
+        {
+            StringView part = body(first, parts[i]);
+            if (part.Empty()) continue;
+
+            if (!first && !endsWithSlash) path += '/';
+            path += part;
+            endsWithSlash = part.Back() == '/';
+            first         = false;
+        }
+
+        return Path(Move(path));
+    }
     StringView Path::BaseName() const { return PathView(*this).BaseName(); }
     StringView Path::ParentName() const { return PathView(*this).ParentName(); }
     Path       Path::ParentPath() const
@@ -39,6 +39,10 @@ namespace Prism
             : Path(path.View())
         {
         }
+        constexpr Path(String&& path)
+            : m_Path(Move(path))
+        {
+        }
         constexpr Path(StringView path)
             : Path(path.Raw(), path.Size())
         {
@@ -193,7 +197,11 @@ namespace Prism
         }
 
         inline bool Absolute() const { return !Empty() && m_Path[0] == '/'; }
-        StringView  BaseName() const;
+        PM_NODISCARD constexpr PathView::ComponentRange Components() const
+        {
+            return View().Components();
+        }
+        StringView BaseName() const;
         StringView  ParentName() const;
         Path        ParentPath() const;
         StringView  Extension() const;
@@ -207,6 +215,34 @@ namespace Prism
         }
 
         Vector<String> Split(ValueType delimiter = '/') const;
+        /**
+         * @brief Lexically normalizes the path in place, in a single pass and
+         * without allocating.
+         *
+         * Repeated slashes are collapsed and "." components are dropped. A
+         * ".." component removes the component before it; at the root it is
+         * dropped, while the leading ".." of a relative path are kept. The
+         * result has no trailing slash unless it is "/", and a relative path
+         * that cancels out entirely becomes ".". Symbolic links are not
+         * looked at, so "a/link/.." becomes "a" regardless of the target.
+         */
+        Path&          Normalize();
+        /**
+         * @brief Joins @p parts with a single slash between adjacent parts.
+         *
+         * The size of the result is computed first, so the path is allocated
+         * exactly once. Empty parts are skipped, and slashes where two parts
+         * meet collapse into one, e.g. Join("/usr/", "/lib", "/libc.so") is
+         * "/usr/lib/libc.so". Slashes inside a part are kept as given.
+         */
+        template <typename... Parts>
+            requires(IsConvertibleV<const Parts&, PathView> && ...)
+        static Path Join(const Parts&... parts)
+        {
+            const PathView views[] = {PathView(parts)...};
+            return Join(views, sizeof...(Parts));
+        }
+        static Path Join(const PathView* parts, usize count);
         /**
          * @brief Trims leading and/or trailing whitespace characters from the
          * string.
@@ -553,10 +589,6 @@ namespace Prism
     struct Hash<Path> : public Detail::StringHashBase<char>
     {
     };
-    template <>
-    struct IsFastHash<Hash<Path>> : FalseType
-    {
-    };
 #endif
 
 }; // namespace Prism
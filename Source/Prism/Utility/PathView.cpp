@@ -19,36 +19,21 @@ namespace Prism
 
     StringView PathView::BaseName() const
     {
-        if (m_Path.Empty()) return ""_sv;
+        auto components = Components();
+        auto last       = components.end();
+        if (last == components.begin()) return ""_sv;
 
-        usize end = m_Path.FindLastNotOf('/');
-        // path was only slashes
-        if (end == StringView::NPos) return {};
-
-        usize start = m_Path.FindLastOf('/', end);
-        if (start == StringView::NPos) return Substr(0, end + 1);
-
-        return Substr(start + 1, end - start);
+        return *--last;
     }
     StringView PathView::ParentName() const
     {
-        if (m_Path.Empty()) return ""_sv;
-
-        usize end = FindLastNotOf('/');
-        if (end == NPos) return ""_sv;
-
-        usize lastSlash = FindLastOf('/', end);
-        // no parent
-        if (lastSlash == NPos) return ""_sv;
-
-        usize parentEnd = FindLastNotOf('/', lastSlash);
-        if (parentEnd == NPos) return ""_sv;
-
-        usize parentStart = FindLastOf('/', parentEnd);
-        if (parentStart == NPos) parentStart = 0;
-        else parentStart++;
+        auto components = Components();
+        auto it         = components.end();
+        // the path has no components, or just one
+        if (it == components.begin() || --it == components.begin())
+            return ""_sv;
 
-        return Substr(parentStart, parentEnd - parentStart + 1);
+        return *--it;
     }
     PathView PathView::ParentPath() const
     {
@@ -70,6 +55,6 @@ namespace Prism
         // no extension or hidden file
         if (dot == NPos || dot == 0 || dot == base.Size() - 1) return ""_sv;
 
-        return Substr(dot + 1);
+        return base.Substr(dot + 1);
     }
 }; // namespace Prism
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <Prism/Containers/Vector.hpp>
+#include <Prism/Core/Iterator.hpp>
 #include <Prism/Core/Types.hpp>
 #include <Prism/String/String.hpp>
 
@@ -23,6 +24,127 @@ namespace Prism
         using TraitsType            = StringView::TraitsType;
         constexpr static usize NPos = StringView::NPos;
 
+        /**
+         * @brief Walks the components of a path, i.e. the names between
+         * slashes, in either direction without allocating.
+         *
+         * Repeated, leading and trailing slashes are skipped, so "//usr/lib/"
+         * has the components "usr" and "lib"; whether the path is rooted is
+         * reported by Absolute().
+         */
+        class ComponentIterator
+        {
+          public:
+            using IteratorCategory = BidirectionalIteratorTag;
+            using ValueType        = StringView;
+            using DifferenceType   = isize;
+            using Pointer          = const StringView*;
+            using Reference        = StringView;
+
+            // The standard names, for <ranges> and range-based for
+            using iterator_concept = std::bidirectional_iterator_tag;
+            using value_type       = StringView;
+            using difference_type  = isize;
+
+            constexpr ComponentIterator() = default;
+            constexpr ComponentIterator(StringView path, usize pos)
+                : m_Path(path)
+                , m_Start(pos)
+                , m_End(pos)
+            {
+                if (pos < path.Size()) FindNext(pos);
+            }
+
+            constexpr StringView operator*() const
+            {
+                return StringView(m_Path.Raw() + m_Start, m_End - m_Start);
+            }
+
+            constexpr ComponentIterator& operator++()
+            {
+                FindNext(m_End);
+                return *this;
+            }
+            constexpr ComponentIterator operator++(int)
+            {
+                ComponentIterator previous = *this;
+                FindNext(m_End);
+
+                return previous;
+            }
+            constexpr ComponentIterator& operator--()
+            {
+                FindPrevious(m_Start);
+                return *this;
+            }
+            constexpr ComponentIterator operator--(int)
+            {
+                ComponentIterator next = *this;
+                FindPrevious(m_Start);
+
+                return next;
+            }
+
+            constexpr bool operator==(const ComponentIterator& other) const
+            {
+                return m_Start == other.m_Start;
+            }
+
+            /// Offset of the component within the path
+            constexpr usize Offset() const { return m_Start; }
+
+          private:
+            StringView     m_Path;
+            usize          m_Start = 0;
+            usize          m_End   = 0;
+
+            constexpr void FindNext(usize pos)
+            {
+                m_Start = m_Path.FindFirstNotOf('/', pos);
+                if (m_Start == NPos) m_Start = m_Path.Size();
+
+                m_End = m_Path.Find('/', m_Start);
+                if (m_End == NPos) m_End = m_Path.Size();
+            }
+            constexpr void FindPrevious(usize pos)
+            {
+                while (pos > 0 && m_Path[pos - 1] == '/') --pos;
+                m_End = pos;
+                while (pos > 0 && m_Path[pos - 1] != '/') --pos;
+                m_Start = pos;
+            }
+        };
+        using ComponentReverseIterator = ReverseIterator<ComponentIterator>;
+
+        /// The components of a path, see ComponentIterator
+        class ComponentRange
+        {
+          public:
+            constexpr explicit ComponentRange(StringView path)
+                : m_Path(path)
+            {
+            }
+
+            constexpr ComponentIterator begin() const { return {m_Path, 0}; }
+            constexpr ComponentIterator end() const
+            {
+                return {m_Path, m_Path.Size()};
+            }
+            constexpr ComponentReverseIterator rbegin() const
+            {
+                return ComponentReverseIterator(end());
+            }
+            constexpr ComponentReverseIterator rend() const
+            {
+                return ComponentReverseIterator(begin());
+            }
+
+            constexpr bool Empty() const { return begin() == end(); }
+
+          private:
+            StringView m_Path;
+        };
+
         constexpr PathView()        = default;
 
         constexpr PathView(const ValueType* path)
@@ -30,7 +152,7 @@ namespace Prism
         {
         }
         constexpr PathView(const ValueType* path, usize size)
-            : PathView(StringView(path))
+            : PathView(StringView(path, size))
         {
         }
         constexpr PathView(const String& path)
@@ -152,7 +274,11 @@ namespace Prism
         }
 
         inline bool Absolute() const { return !Empty() && m_Path[0] == '/'; }
-        StringView  BaseName() const;
+        PM_NODISCARD constexpr ComponentRange Components() const
+        {
+            return ComponentRange(m_Path);
+        }
+        StringView BaseName() const;
         StringView  ParentName() const;
         PathView    ParentPath() const;
         StringView  Extension() const;
@@ -165,6 +291,7 @@ namespace Prism
             return m_Path.Copy(str, count, pos);
         }
 
+        /// @see Components() to walk the components without allocating
         inline Vector<String> Split(ValueType delimiter = '/') const
         {
             return m_Path.Split(delimiter);
@@ -452,10 +579,6 @@ namespace Prism
     struct Hash<PathView> : public Detail::StringHashBase<char>
     {
     };
-    template <>
-    struct IsFastHash<Hash<PathView>> : FalseType
-    {
-    };
 #endif
 
 }; // namespace Prism
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <Prism/Core/Bits.hpp>
 #include <Prism/Core/Platform.hpp>
 #include <Prism/Core/TypeTraits.hpp>
 #include <Prism/Core/Types.hpp>
@@ -14,6 +15,12 @@
     #error 'You should not use simd inside the kernel'
 #endif
 
+#if PRISM_SIMD_SSE2_PRESENT
+    #include <emmintrin.h>
+#elif PRISM_SIMD_NEON_PRESENT
+    #include <arm_neon.h>
+#endif
+
 namespace Prism
 {
     using i8x2   = i8 __attribute__((vector_size(2)));
@@ -78,11 +85,21 @@ namespace Prism
     static_assert(IsSameV<ElementOfType<i8x4>, i8>);
     static_assert(IsSameV<ElementOfType<f32x4>, f32>);
 
+    /// A vector of @p N lanes of @p T, for code generic over the lane type
+    template <typename T, usize N>
+    struct VectorOf
+    {
+        typedef T Type __attribute__((vector_size(N * sizeof(T))));
+    };
+    template <typename T, usize N>
+    using VectorOfType = typename VectorOf<T, N>::Type;
+
     template <SIMDVector V>
     constexpr static usize VectorLength = sizeof(V) / sizeof(ElementOfType<V>);
 
     static_assert(VectorLength<i8x4> == 4);
     static_assert(VectorLength<f32x4> == 4);
+    static_assert(IsSameV<VectorOfType<u16, 8>, u16x8>);
 
     template <SIMDVector T, SIMDVector U>
         requires(VectorLength<T> == VectorLength<U>)
@@ -118,8 +135,139 @@ namespace Prism
 
     // static_assert(IsSameV<IndexVectorForType<f32x4>, u32x4>);
     // static_assert(IsSameV<IndexVectorForType<f64x4>, u64x4>);
+
+    /**
+     * @brief Loads a vector from a possibly unaligned address.
+     */
+    template <SIMDVector V>
+    PM_ALWAYS_INLINE V LoadVector(const void* source)
+    {
+        V vector;
+        __builtin_memcpy(&vector, source, sizeof(V));
+
+        return vector;
+    }
+    /**
+     * @brief Packs the top bit of every byte lane into the low 16 bits of
+     * the result, like SSE2's pmovmskb. Lane comparisons yield all-ones or
+     * all-zeros lanes, so this turns a comparison into a bitmask whose set
+     * bits index the matching bytes.
+     */
+    PM_ALWAYS_INLINE u32 MoveMask(i8x16 lanes)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        return static_cast<u32>(_mm_movemask_epi8(BitCast<__m128i>(lanes)));
+#elif PRISM_SIMD_NEON_PRESENT
+        constexpr u8x16 shifts
+            = {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+        u8x16 bits = (BitCast<u8x16>(lanes) >> 7) << shifts;
+        uint8x16_t packed = BitCast<uint8x16_t>(bits);
+
+        return vaddv_u8(vget_low_u8(packed))
+             | (static_cast<u32>(vaddv_u8(vget_high_u8(packed))) << 8);
+#else
+        u32 mask = 0;
+        for (usize i = 0; i < 16; ++i) mask |= u32(lanes[i] < 0) << i;
+
+        return mask;
+#endif
+    }
+
+    /**
+     * @brief Zero-extends the lower (WidenLow) or upper (WidenHigh) half of
+     * the lanes of @p lanes to twice their width.
+     */
+    PM_ALWAYS_INLINE u16x8 WidenLow(u8x16 lanes)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        return BitCast<u16x8>(_mm_unpacklo_epi8(BitCast<__m128i>(lanes),
+                                                _mm_setzero_si128()));
+#elif PRISM_SIMD_NEON_PRESENT
+        return BitCast<u16x8>(
+            vmovl_u8(vget_low_u8(BitCast<uint8x16_t>(lanes))));
+#else
+        return __builtin_convertvector(
+            __builtin_shufflevector(lanes, lanes, 0, 1, 2, 3, 4, 5, 6, 7),
+            u16x8);
+#endif
+    }
+    PM_ALWAYS_INLINE u16x8 WidenHigh(u8x16 lanes)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        return BitCast<u16x8>(_mm_unpackhi_epi8(BitCast<__m128i>(lanes),
+                                                _mm_setzero_si128()));
+#elif PRISM_SIMD_NEON_PRESENT
+        return BitCast<u16x8>(vmovl_high_u8(BitCast<uint8x16_t>(lanes)));
+#else
+        return __builtin_convertvector(
+            __builtin_shufflevector(lanes, lanes, 8, 9, 10, 11, 12, 13, 14,
+                                    15),
+            u16x8);
+#endif
+    }
+    PM_ALWAYS_INLINE u32x4 WidenLow(u16x8 lanes)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        return BitCast<u32x4>(_mm_unpacklo_epi16(BitCast<__m128i>(lanes),
+                                                 _mm_setzero_si128()));
+#elif PRISM_SIMD_NEON_PRESENT
+        return BitCast<u32x4>(
+            vmovl_u16(vget_low_u16(BitCast<uint16x8_t>(lanes))));
+#else
+        return __builtin_convertvector(
+            __builtin_shufflevector(lanes, lanes, 0, 1, 2, 3), u32x4);
+#endif
+    }
+    PM_ALWAYS_INLINE u32x4 WidenHigh(u16x8 lanes)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        return BitCast<u32x4>(_mm_unpackhi_epi16(BitCast<__m128i>(lanes),
+                                                 _mm_setzero_si128()));
+#elif PRISM_SIMD_NEON_PRESENT
+        return BitCast<u32x4>(vmovl_high_u16(BitCast<uint16x8_t>(lanes)));
+#else
+        return __builtin_convertvector(
+            __builtin_shufflevector(lanes, lanes, 4, 5, 6, 7), u32x4);
+#endif
+    }
+    /**
+     * @brief Packs the lanes of @p low and @p high into one vector of half
+     * the lane width. Every lane must fit the narrower type; 32-bit lanes
+     * must in addition be below 0x8000.
+     */
+    PM_ALWAYS_INLINE u8x16 Narrow(u16x8 low, u16x8 high)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        return BitCast<u8x16>(
+            _mm_packus_epi16(BitCast<__m128i>(low), BitCast<__m128i>(high)));
+#elif PRISM_SIMD_NEON_PRESENT
+        return BitCast<u8x16>(
+            vcombine_u8(vmovn_u16(BitCast<uint16x8_t>(low)),
+                        vmovn_u16(BitCast<uint16x8_t>(high))));
+#else
+        return __builtin_convertvector(
+            __builtin_shufflevector(low, high, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                    10, 11, 12, 13, 14, 15),
+            u8x16);
+#endif
+    }
+    PM_ALWAYS_INLINE u16x8 Narrow(u32x4 low, u32x4 high)
+    {
+#if PRISM_SIMD_SSE2_PRESENT
+        // SSE2 only packs 32-bit lanes with signed saturation
+        return BitCast<u16x8>(
+            _mm_packs_epi32(BitCast<__m128i>(low), BitCast<__m128i>(high)));
+#elif PRISM_SIMD_NEON_PRESENT
+        return BitCast<u16x8>(
+            vcombine_u16(vmovn_u32(BitCast<uint32x4_t>(low)),
+                         vmovn_u32(BitCast<uint32x4_t>(high))));
+#else
+        return __builtin_convertvector(
+            __builtin_shufflevector(low, high, 0, 1, 2, 3, 4, 5, 6, 7), u16x8);
+#endif
+    }
+
 #if PRISM_SIMD_SSE2_PRESENT
-    #include <emmintrin.h>
     using simd_float = __m128;
     constexpr auto LoadFloat(auto ptr) { return _mm_loadu_ps(ptr); }
     constexpr auto StoreFloat(auto ptr, auto value)
@@ -133,7 +281,6 @@ namespace Prism
     constexpr auto  Set1Float(auto x) { return _mm_set1_ps(x); }
     constexpr usize FloatWidth = 4;
 #elif PRISM_SIMD_NEON_PRESENT
-    #include <arm_neon.h>
     using simd_float = float32x4_t;
     constexpr auto LoadFloat(auto ptr) { return vld1q_f32(ptr); }
     constexpr auto StoreFloat(auto ptr, auto value)
@@ -7,8 +7,14 @@
 
 #include <Prism/Algorithm/Find.hpp>
 #include <Prism/Containers/Array.hpp>
+#include <Prism/Containers/KeyValuePair.hpp>
 #include <Prism/Containers/Vector.hpp>
 #include <Prism/Debug/Assertions.hpp>
+#include <Prism/Utility/Compare.hpp>
+
+#include <cassert>
+
+using namespace Prism;
 
 void TestFind()
 {
@@ -46,7 +52,7 @@ void TestFindIter()
     // FindValueIter
     int value = 30;
     it        = FindValueIter(vec.begin(), vec.end(), value,
-                              [](auto i, int* v) { return *i == *v; });
+                              [](auto i, int& v) { return *i == v; });
     PrismAssert(it != vec.end() && *it == 30);
 
     // FindIteratorIter
@@ -83,7 +89,7 @@ void TestCount()
     PrismAssert(
         CountIf(vec.begin(), vec.end(), [](int x) { return x % 2 == 1; }) == 4);
     PrismAssert(
-        CountIfNot(vec.begin(), vec.end(), [](int x) { return x % 2 == 0; })
+        Prism::CountIfNot(vec.begin(), vec.end(), [](int x) { return x % 2 == 0; })
         == 4);
 
     // Iterator-aware
@@ -98,7 +104,7 @@ void TestRemoveEraseIf()
 
     auto        newEnd
         = RemoveIf(vec.begin(), vec.end(), [](int x) { return x % 2 == 0; });
-    vec.erase(newEnd, vec.end());
+    vec.Erase(newEnd, vec.end());
     PrismAssert((vec == Vector<int>{1, 3, 5}));
 
     // Refill
@@ -111,7 +117,7 @@ void TestRemoveEraseIf()
     vec    = {1, 2, 3, 4, 5};
     newEnd = RemoveIfIter(vec.begin(), vec.end(),
                           [](auto it) { return *it % 2 == 1; });
-    vec.erase(newEnd, vec.end());
+    vec.Erase(newEnd, vec.end());
     PrismAssert((vec == Vector<int>{2, 4}));
 }
 
@@ -135,14 +141,157 @@ void TestFindIfProj()
     Vector<KeyValuePair<int, int>> vec = {{1, 2}, {3, 4}, {5, 6}};
     auto                           it  = FindIfProj(
         vec.begin(), vec.end(), [](int x) { return x == 4; },
-        [](auto& p) { return p.second; });
-    PrismAssert(it != vec.end() && it->second == 4);
+        [](auto& p) { return p.Value; });
+    PrismAssert(it != vec.end() && it->Value == 4);
 
     it = FindIfProj(vec.begin(), vec.end(), EqualTo<>{}, 5,
-                    [](auto& p) { return p.first; });
-    PrismAssert(it != vec.end() && it->first == 5);
+                    [](auto& p) { return p.Key; });
+    PrismAssert(it != vec.end() && it->Key == 5);
 }
 
+namespace
+{
+    // The plain loops the vectorized paths have to agree with
+    template <typename T, typename V>
+    usize ReferenceFind(const T* data, usize size, const V& value)
+    {
+        for (usize i = 0; i < size; ++i)
+            if (data[i] == value) return i;
+        return size;
+    }
+    template <typename T, typename V>
+    usize ReferenceCount(const T* data, usize size, const V& value)
+    {
+        usize count = 0;
+        for (usize i = 0; i < size; ++i) count += data[i] == value;
+        return count;
+    }
+
+    // Every length and misalignment around the vector widths, with the
+    // match at each position and absent
+    template <typename T>
+    void TestElementType()
+    {
+        Vector<T> storage(300);
+        for (usize i = 0; i < storage.Size(); ++i)
+            storage[i] = static_cast<T>(i % 7 + 1);
+
+        for (usize offset = 0; offset < 4; ++offset)
+            for (usize size = 0; size + offset <= 140; ++size)
+            {
+                T* data = storage.Raw() + offset;
+                for (T value : {T(0), T(1), T(3), T(7)})
+                {
+                    assert(usize(Find(data, data + size, value) - data)
+                           == ReferenceFind(data, size, value));
+                    assert(Count(data, data + size, value)
+                           == ReferenceCount(data, size, value));
+                    assert(CountIf(data, data + size, NotEqualTo<>{}, value)
+                           == size - ReferenceCount(data, size, value));
+                    assert(AnyOf(data, data + size, EqualTo<>{}, value)
+                           == (ReferenceFind(data, size, value) != size));
+                    assert(NoneOf(data, data + size, EqualTo<>{}, value)
+                           == (ReferenceFind(data, size, value) == size));
+                    assert(AllOf(data, data + size, EqualTo<>{}, value)
+                           == (ReferenceCount(data, size, value) == size));
+                }
+
+                if (size == 0) continue;
+                T saved            = data[size - 1];
+                data[size - 1]     = T(42);
+                assert(usize(Find(data, data + size, T(42)) - data)
+                       == size - 1);
+                assert(Count(data, data + size, T(42)) == 1);
+                data[size - 1] = saved;
+            }
+
+        // Enough matches to wrap narrow lane counters several times
+        Vector<T> same(70'000);
+        for (usize i = 0; i < same.Size(); ++i) same[i] = T(5);
+        assert(Count(same.begin(), same.end(), T(5)) == same.Size());
+        assert(AllOf(same.begin(), same.end(), EqualTo<>{}, T(5)));
+        assert(!AnyOf(same.begin(), same.end(), NotEqualTo<>{}, T(5)));
+    }
+
+    void TestConversions()
+    {
+        // Values no element can equal are not truncated into matches
+        Array<u8, 40> bytes{};
+        bytes[20] = 0x2a;
+        assert(Find(bytes.begin(), bytes.end(), 0x12a) == bytes.end());
+        assert(Find(bytes.begin(), bytes.end(), 0x2a) == bytes.begin() + 20);
+        assert(Count(bytes.begin(), bytes.end(), -214) == 0);
+        assert(Count(bytes.begin(), bytes.end(), 0x2a) == 1);
+        assert(!AllOf(bytes.begin(), bytes.end(), NotEqualTo<>{}, 0));
+        assert(AllOf(bytes.begin(), bytes.end(), NotEqualTo<>{}, 1000));
+
+        // ...while the usual arithmetic conversions still apply
+        Array<u64, 40> words{};
+        words[33] = 0xffff'ffff;
+        assert(Find(words.begin(), words.end(), 0xffff'ffffu)
+               == words.begin() + 33);
+        Array<i16, 40> shorts{};
+        shorts[7] = -3;
+        assert(Find(shorts.begin(), shorts.end(), -3ll) == shorts.begin() + 7);
+        assert(Count(shorts.begin(), shorts.end(), 65533) == 0);
+
+        // Arrays of pointers
+        int           objects[64];
+        Vector<int*>  pointers(64);
+        for (usize i = 0; i < pointers.Size(); ++i) pointers[i] = objects + i;
+        pointers[50] = nullptr;
+        assert(Find(pointers.begin(), pointers.end(), objects + 37)
+               == pointers.begin() + 37);
+        assert(Find(pointers.begin(), pointers.end(), nullptr)
+               == pointers.begin() + 50);
+        assert(Count(pointers.begin(), pointers.end(), objects + 50) == 0);
+    }
+
+    // Checks the bounds of every value around [0, 2 * size] against a scan
+    void TestBounds()
+    {
+        for (usize size = 0; size < 70; ++size)
+        {
+            // Every value twice, odd values missing
+            Vector<u32> sorted(size);
+            for (usize i = 0; i < size; ++i) sorted[i] = (i / 2) * 2;
+
+            for (u32 value = 0; value <= size + 2; ++value)
+            {
+                usize lower = 0, upper = 0;
+                while (lower < size && sorted[lower] < value) ++lower;
+                while (upper < size && sorted[upper] <= value) ++upper;
+
+                auto first = sorted.begin(), last = sorted.end();
+                assert(LowerBound(first, last, value) == first + lower);
+                assert(UpperBound(first, last, value) == first + upper);
+
+                auto found = BinarySearch(first, last, value);
+                assert(found == (lower != upper ? first + lower : last));
+            }
+        }
+
+        // Descending order through the comparator
+        i32 descending[] = {9, 7, 7, 4, 1, -3};
+        assert(LowerBound(descending, descending + 6, 7, Greater<>{})
+               == descending + 1);
+        assert(UpperBound(descending, descending + 6, 7, Greater<>{})
+               == descending + 3);
+        assert(BinarySearch(descending, descending + 6, 2, Greater<>{})
+               == descending + 6);
+    }
+
+    // The vector paths stay out of constant evaluation
+    constexpr bool ConstantFind()
+    {
+        u32 values[] = {5, 6, 7, 8};
+        return Find(values, values + 4, 7u) == values + 2
+            && Count(values, values + 4, 9u) == 0
+            && LowerBound(values, values + 4, 7u) == values + 2;
+    }
+    static_assert(ConstantFind());
+} // namespace
+
 int main()
 {
     TestFind();
@@ -153,5 +302,14 @@ int main()
     TestFindFirstOf();
     TestFindIfProj();
 
+    TestElementType<u8>();
+    TestElementType<i8>();
+    TestElementType<u16>();
+    TestElementType<i32>();
+    TestElementType<u64>();
+    TestElementType<char>();
+    TestConversions();
+    TestBounds();
+
     return 0;
 }
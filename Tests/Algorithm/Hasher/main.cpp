@@ -0,0 +1,139 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Hash.hpp>
+#include <Prism/Memory/Buffer.hpp>
+#include <Prism/Memory/ByteStream.hpp>
+#include <Prism/Utility/Checksum.hpp>
+
+#include <cassert>
+
+using namespace Prism;
+
+namespace
+{
+    Buffer MakeInput(usize size)
+    {
+        Buffer buffer(size);
+        u64    state = 0x9e37'79b9'7f4a'7c15ull;
+        for (usize i = 0; i < size; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            buffer[i] = static_cast<u8>(state);
+        }
+
+        return buffer;
+    }
+
+    // Feeds @p bytes in pieces of the given sizes, cycling through them
+    template <StreamingHasher H>
+    typename H::ResultType Feed(H hasher, Span<const u8> bytes,
+                                std::initializer_list<usize> pieces)
+    {
+        auto piece = pieces.begin();
+        for (usize offset = 0; offset < bytes.Size();)
+        {
+            usize size = Min(*piece, bytes.Size() - offset);
+            hasher.Update(Span<const u8>(bytes.Raw() + offset, size));
+            offset += size;
+
+            if (++piece == pieces.end()) piece = pieces.begin();
+        }
+
+        return hasher.Finalize();
+    }
+
+    template <StreamingHasher H, typename OneShot>
+    void CheckSplits(H hasher, OneShot oneShot)
+    {
+        for (usize size :
+             {0zu, 1zu, 7zu, 8zu, 9zu, 15zu, 16zu, 17zu, 100zu, 1000zu, 4099zu})
+        {
+            Buffer input    = MakeInput(size);
+            auto   expected = oneShot(input.Span());
+
+            assert(Feed(hasher, input.Span(), {size + 1}) == expected);
+            assert(Feed(hasher, input.Span(), {1}) == expected);
+            assert(Feed(hasher, input.Span(), {3, 0, 13, 64}) == expected);
+            assert(Feed(hasher, input.Span(), {7, 200, 1}) == expected);
+        }
+    }
+
+    void TestHashers()
+    {
+        CheckSplits(FNV1a::Hasher(), [](Span<u8> bytes)
+                    { return FNV1a::Hash(bytes.Raw(), bytes.Size()); });
+        CheckSplits(Murmur::Hasher3(42), [](Span<u8> bytes)
+                    { return Murmur::Hash3(bytes, 42); });
+        CheckSplits(CRC32::Hasher(), [](Span<u8> bytes)
+                    { return CRC32::DoChecksum(bytes.Raw(), bytes.Size()); });
+        CheckSplits(CRC32C::Hasher(), [](Span<u8> bytes)
+                    { return CRC32C::DoChecksum(bytes.Raw(), bytes.Size()); });
+        CheckSplits(Adler32::Hasher(), [](Span<u8> bytes)
+                    { return Adler32::DoChecksum(bytes.Raw(), bytes.Size()); });
+
+        // Hash2 needs the total length up front
+        for (usize size : {0zu, 5zu, 8zu, 63zu, 1000zu})
+        {
+            Buffer input    = MakeInput(size);
+            usize  expected = Murmur::Hash2(input.Span(), 7);
+
+            assert(Feed(Murmur::Hasher2(size, 7), input.Span(), {1, 9, 3})
+                   == expected);
+            assert(Feed(Murmur::Hasher2(size, 7), input.Span(), {size + 1})
+                   == expected);
+        }
+    }
+
+    // Finalize() reports the hash of a prefix without ending the stream
+    void TestFinalizeKeepsState()
+    {
+        Buffer         input = MakeInput(300);
+        Murmur::Hasher3 hasher(0);
+        hasher.Update(input.Span().First(100));
+
+        Buffer prefix(100);
+        prefix.Write(0, input.Raw(), 100);
+        assert(hasher.Finalize() == Murmur::Hash3(prefix.Span(), 0));
+
+        hasher.Update(input.Span().Last(200));
+        assert(hasher.Finalize() == Murmur::Hash3(input.Span(), 0));
+    }
+
+    void TestFeeding()
+    {
+        Buffer       input = MakeInput(1000);
+        CRC32::Hasher whole;
+        input.Feed(whole);
+        assert(whole.Finalize() == CRC32::DoChecksum(input.Raw(), 1000));
+
+        // Two halves of the buffer, as a ring buffer would hand them out
+        CRC32::Hasher halves;
+        input.Feed(halves, 0, 400);
+        input.Feed(halves, 400, 600);
+        assert(halves.Finalize() == whole.Finalize());
+
+        ByteStream<> stream(input);
+        stream.Skip(10);
+        Adler32::Hasher adler;
+        stream.Feed(adler, 500);
+        stream.Feed(adler, 490);
+        assert(stream.IsEndOfStream());
+        assert(adler.Finalize()
+               == Adler32::DoChecksum(input.Raw() + 10, 990));
+    }
+} // namespace
+
+int main()
+{
+    TestHashers();
+    TestFinalizeKeepsState();
+    TestFeeding();
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Parallel.hpp>
+#include <Prism/Containers/Vector.hpp>
+#include <cassert>
+#include <new>
+
+using namespace Prism;
+
+// Makes the non-throwing operator new report that memory ran out
+static bool g_FailAllocations = false;
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    if (g_FailAllocations) return nullptr;
+    return ::operator new(size);
+}
+
+namespace
+{
+    // Claims eight CPUs and runs the tasks last to first, so the split
+    // into tasks is exercised and no algorithm can rely on task order
+    class ReversedExecutor
+    {
+      public:
+        usize Concurrency() const { return 8; }
+
+        template <typename Task>
+        void Run(usize count, Task&& task)
+        {
+            ++m_Batches;
+            while (count) task(--count);
+        }
+
+        usize Batches() const { return m_Batches; }
+
+      private:
+        usize m_Batches = 0;
+    };
+    static_assert(Executor<ReversedExecutor>);
+
+    // Run() has to take the capturing lambdas the algorithms pass it
+    struct FunctionPointerExecutor
+    {
+        usize Concurrency() const { return 1; }
+        void  Run(usize count, void (*task)(usize));
+    };
+    static_assert(!Executor<FunctionPointerExecutor>);
+
+    constexpr usize SIZES[] = {0, 1, 1000, 100'000, 300'001};
+
+    Vector<u32>     Generate(usize size, u32 modulus)
+    {
+        Vector<u32> v(size);
+        u64         state = 0x2545'f491'4f6c'dd1dull ^ size;
+        for (usize i = 0; i < size; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            v[i] = static_cast<u32>(state % modulus);
+        }
+
+        return v;
+    }
+
+    void TestScans()
+    {
+        ReversedExecutor executor;
+        for (usize size : SIZES)
+        {
+            Vector<u32> v = Generate(size, 1000);
+
+            usize expected = 0;
+            for (u32 value : v) expected += value == 7;
+            assert(Count(executor, v.begin(), v.end(), 7u) == expected);
+            assert(CountIf(executor, v.begin(), v.end(),
+                           [](u32 value) { return value < 500; })
+                   == CountIf(v.begin(), v.end(),
+                              [](u32 value) { return value < 500; }));
+
+            // The first match wins even when later tasks find theirs first
+            for (u32 value : {0u, 7u, 999u, 1000u})
+                assert(Find(executor, v.begin(), v.end(), value)
+                       == Find(v.begin(), v.end(), value));
+            assert(AnyOf(executor, v.begin(), v.end(),
+                         [](u32 value) { return value >= 1000; })
+                   == false);
+            assert(AllOf(executor, v.begin(), v.end(),
+                         [](u32 value) { return value < 1000; }));
+
+            u64 sum = 0;
+            for (u32 value : v) sum += value;
+            assert(Reduce(executor, v.begin(), v.end(), u64(0),
+                          [](u64 lhs, u64 rhs) { return lhs + rhs; })
+                   == sum);
+
+            Vector<u64> squares(size);
+            Transform(executor, v.begin(), v.end(), squares.begin(),
+                      [](u32 value) { return u64(value) * value; });
+            for (usize i = 0; i < size; ++i)
+                assert(squares[i] == u64(v[i]) * v[i]);
+        }
+
+        // Partial results are combined in order: keeping the leftmost
+        // non-zero value is associative but not commutative
+        Vector<u32> sparse(100'000);
+        for (usize i = 0; i < sparse.Size(); ++i) sparse[i] = 0;
+        sparse[90'000] = 5;
+        sparse[12'345] = 3;
+        assert(Reduce(executor, sparse.begin(), sparse.end(), 0u,
+                      [](u32 lhs, u32 rhs) { return lhs ? lhs : rhs; })
+               == 3);
+    }
+
+    void TestSorts()
+    {
+        ReversedExecutor executor;
+        for (usize size : SIZES)
+            for (u32 modulus : {2u, 1000u, 0xffff'ffffu})
+            {
+                Vector<u32> v = Generate(size, modulus);
+                Sort(executor, v.begin(), v.end());
+                for (usize i = 1; i < size; ++i) assert(v[i - 1] <= v[i]);
+
+                // Stable: equal keys keep their order
+                struct Tagged
+                {
+                    u32   Key;
+                    usize Position;
+                };
+                Vector<u32>    keys = Generate(size, modulus);
+                Vector<Tagged> w(size);
+                for (usize i = 0; i < size; ++i) w[i] = {keys[i] % 100, i};
+                StableSort(executor, w.begin(), w.end(),
+                           [](const Tagged& lhs, const Tagged& rhs)
+                           { return lhs.Key < rhs.Key; });
+                for (usize i = 1; i < size; ++i)
+                    assert(w[i - 1].Key < w[i].Key
+                           || (w[i - 1].Key == w[i].Key
+                               && w[i - 1].Position < w[i].Position));
+            }
+
+        // Merging two sorted halves of uneven length
+        Vector<u32> v = Generate(200'000, 5000);
+        Sort(v.begin(), v.begin() + 30'000);
+        Sort(v.begin() + 30'000, v.end());
+        Merge(executor, v.begin(), v.begin() + 30'000, v.end());
+        for (usize i = 1; i < v.Size(); ++i) assert(v[i - 1] <= v[i]);
+        assert(executor.Batches() > 0);
+    }
+
+    // Without memory for their buffers, the algorithms run sequentially
+    void TestWithoutMemory()
+    {
+        ReversedExecutor executor;
+        Vector<u32>      v = Generate(100'000, 1000);
+        Vector<u32>      w = v;
+        Vector<u32>      halves = v;
+        Sort(halves.begin(), halves.begin() + 40'000);
+        Sort(halves.begin() + 40'000, halves.end());
+
+        u64 expected = 0;
+        for (u32 value : v) expected += value;
+
+        g_FailAllocations = true;
+        u64 sum = Reduce(executor, v.begin(), v.end(), u64(0),
+                         [](u64 lhs, u64 rhs) { return lhs + rhs; });
+        Sort(executor, v.begin(), v.end());
+        StableSort(executor, w.begin(), w.end());
+        Merge(executor, halves.begin(), halves.begin() + 40'000,
+              halves.end());
+        g_FailAllocations = false;
+
+        assert(sum == expected);
+        for (usize i = 1; i < v.Size(); ++i)
+            assert(v[i - 1] <= v[i] && v[i] == w[i] && v[i] == halves[i]);
+    }
+} // namespace
+
+int main()
+{
+    TestScans();
+    TestSorts();
+    TestWithoutMemory();
+
+    return 0;
+}
@@ -97,10 +97,206 @@ void KPM_Search_TestFind()
     // TODO(v1tr10l7): Implement RFind, FindFirstOf, FindFirstNotOf, FindLastOf
 }
 
+usize NaiveFind(StringView text, StringView pattern)
+{
+    for (usize i = 0; i + pattern.Size() <= text.Size(); ++i)
+        if (text.Substr(i, pattern.Size()) == pattern) return i;
+    return usize(-1);
+}
+usize NaiveFindLast(StringView text, StringView pattern)
+{
+    for (usize i = text.Size() - pattern.Size() + 1; i-- > 0;)
+        if (text.Substr(i, pattern.Size()) == pattern) return i;
+    return usize(-1);
+}
+
+void Search_TestFindString()
+{
+    String s = "hello world"_s;
+
+    assert(Algorithm::FindString(s.View(), "world"_sv) == 6);
+    assert(Algorithm::FindString(s.View(), "o"_sv) == 4);
+    assert(Algorithm::FindString(s.View(), "notfound"_sv) == usize(-1));
+    assert(Algorithm::FindString(s.View(), ""_sv) == 0);
+    assert(Algorithm::FindLastString(s.View(), "o"_sv) == 7);
+    assert(Algorithm::FindLastString(s.View(), "l"_sv) == 9);
+    assert(Algorithm::FindLastString(s.View(), "hello"_sv) == 0);
+    assert(Algorithm::FindLastString(s.View(), "xyz"_sv) == usize(-1));
+
+    // Cover the vector/word loops, their scalar tails and the Horspool path
+    // with needles of every length at every offset
+    String text;
+    for (usize i = 0; i < 300; ++i)
+        text += static_cast<char>('a' + (i * 7 + i / 13) % 5);
+    for (usize length = 1; length <= 48; ++length)
+    {
+        for (usize offset = 0; offset + length <= text.Size(); offset += 17)
+        {
+            StringView needle = text.View().Substr(offset, length);
+            assert(Algorithm::FindString(text.View(), needle)
+                   == NaiveFind(text, needle));
+            assert(Algorithm::FindLastString(text.View(), needle)
+                   == NaiveFindLast(text, needle));
+        }
+
+        String missing(length, 'z');
+        assert(Algorithm::FindString(text.View(), missing.View())
+               == usize(-1));
+        assert(Algorithm::FindLastString(text.View(), missing.View())
+               == usize(-1));
+    }
+
+    constexpr StringView haystack = "compile time search"_sv;
+    static_assert(Algorithm::FindString(haystack, "time"_sv) == 8);
+    static_assert(Algorithm::FindLastString(haystack, "e"_sv) == 14);
+}
+void Search_TestStringViewFind()
+{
+    StringView s = "a/b/c/a/b/c"_sv;
+
+    assert(s.Find("b/c"_sv) == 2);
+    assert(s.Find("b/c"_sv, 3) == 8);
+    assert(s.Find('c', 5) == 10);
+    assert(s.Find('x') == StringView::NPos);
+    assert(s.RFind("a/b"_sv) == 6);
+    assert(s.RFind("a/b"_sv, 5) == 0);
+    assert(s.RFind('/') == 9);
+    assert(s.RFind('/', 8) == 7);
+    assert(s.RFind("a/b/c/a/b/c/"_sv) == StringView::NPos);
+    assert(s.Contains("c/a"_sv));
+    assert(!s.Contains("c/c"_sv));
+}
+
+void Search_TestSearchers()
+{
+    String text = "the cat sat on the mat with the hat"_s;
+
+    Algorithm::KMPSearcher      kmp("the"_sv);
+    Algorithm::HorspoolSearcher horspool("the"_sv);
+    Vector<usize>               expected = {0, 15, 28};
+
+    for (usize pos = 0; pos < text.Size(); ++pos)
+    {
+        usize naive = NaiveFind(text.View().Substr(pos), "the"_sv);
+        if (naive != usize(-1)) naive += pos;
+
+        assert(kmp.Find(text.View(), pos) == naive);
+        assert(horspool.Find(text.View(), pos) == kmp.Find(text.View(), pos));
+    }
+
+    Vector<usize> found;
+    kmp.ForEachMatch(text.View(),
+                     [&](usize index)
+                     {
+                         found.PushBack(index);
+                         return true;
+                     });
+    assert(found == expected);
+
+    found.Clear();
+    horspool.ForEachMatch(text.View(),
+                          [&](usize index)
+                          {
+                              found.PushBack(index);
+                              return true;
+                          });
+    assert(found == expected);
+
+    // Overlapping matches
+    Algorithm::KMPSearcher      aa("aa"_sv);
+    Algorithm::HorspoolSearcher aaa("aaa"_sv);
+    usize                       count = 0;
+    aa.ForEachMatch("aaaa"_sv,
+                    [&](usize)
+                    {
+                        ++count;
+                        return true;
+                    });
+    assert(count == 3);
+    assert(aaa.Find("aabaaa"_sv) == 3);
+    assert(!aaa.Contains("aabaab"_sv));
+}
+void Search_TestAhoCorasick()
+{
+    Algorithm::AhoCorasick<char> automaton
+        = {"he"_sv, "she"_sv, "his"_sv, "hers"_sv, "he"_sv};
+
+    struct Expected
+    {
+        usize Pattern;
+        usize Position;
+    };
+    constexpr Expected expected[] = {
+        {1, 1}, {0, 2}, {4, 2}, {3, 2}, {2, 8},
+    };
+
+    usize i = 0;
+    automaton.ForEachMatch("ushers this"_sv,
+                           [&](const auto& match)
+                           {
+                               assert(i < 5);
+                               assert(match.PatternIndex
+                                      == expected[i].Pattern);
+                               assert(match.Position == expected[i].Position);
+                               ++i;
+                               return true;
+                           });
+    assert(i == 5);
+
+    auto first = automaton.FindFirst("a shell"_sv);
+    assert(first && first.PatternIndex == 1 && first.Position == 2);
+    assert(!automaton.Contains("nothing to see"_sv));
+
+    // Cross-check against the single pattern searcher on many keys
+    Vector<String> keys;
+    for (usize k = 0; k < 40; ++k)
+    {
+        String key;
+        for (usize j = 0; j <= k % 6; ++j)
+            key += static_cast<char>('a' + (k * 3 + j * 5) % 7);
+        keys.PushBack(key);
+    }
+
+    Algorithm::AhoCorasick<char> dictionary;
+    for (const auto& key : keys) dictionary.AddPattern(key.View());
+    dictionary.Build();
+
+    String text;
+    for (usize j = 0; j < 500; ++j)
+        text += static_cast<char>('a' + (j * j + j / 3) % 8);
+
+    usize matches = 0;
+    dictionary.ForEachMatch(text.View(),
+                            [&](const auto& match)
+                            {
+                                StringView key = keys[match.PatternIndex];
+                                assert(text.View().Substr(match.Position,
+                                                          key.Size())
+                                       == key);
+                                ++matches;
+                                return true;
+                            });
+
+    usize expectedMatches = 0;
+    for (const auto& key : keys)
+        Algorithm::KMPSearcher(key.View())
+            .ForEachMatch(text.View(),
+                          [&](usize)
+                          {
+                              ++expectedMatches;
+                              return true;
+                          });
+    assert(matches == expectedMatches);
+}
+
 int main()
 {
     KPM_Search_TestComputeLPS_Array();
     KPM_Search_TestFind();
+    Search_TestFindString();
+    Search_TestStringViewFind();
+    Search_TestSearchers();
+    Search_TestAhoCorasick();
 
     return EXIT_SUCCESS;
 }
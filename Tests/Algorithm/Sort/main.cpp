@@ -7,13 +7,24 @@
 #include <Prism/Algorithm/Sort.hpp>
 #include <Prism/Containers/Array.hpp>
 #include <Prism/Containers/Vector.hpp>
+#include <Prism/String/StringView.hpp>
 #include <Prism/Utility/Compare.hpp>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <new>
 
 using namespace Prism;
 
+// Makes the non-throwing operator new report that memory ran out
+static bool g_FailAllocations = false;
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    if (g_FailAllocations) return nullptr;
+    return ::operator new(size);
+}
+
 template <typename Container>
 bool IsSorted(const Container& c)
 {
@@ -64,8 +75,307 @@ void TestSortAlgorithm(Sorter<Container> sorter)
     }
 }
 
+// Distributions that defeat naive quicksorts, plus random input
+enum class Distribution
+{
+    eRandom,
+    eSorted,
+    eReversed,
+    eSawtooth,
+    eOrganPipe,
+    eFewUnique,
+    eAllEqual,
+};
+
+Vector<int> Generate(Distribution distribution, usize size)
+{
+    Vector<int> v(size);
+    u64         state = 0x9e37'79b9'7f4a'7c15ull ^ size;
+    auto        next  = [&state]
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<int>(state >> 33);
+    };
+
+    for (usize i = 0; i < size; ++i)
+    {
+        int value = 0;
+        switch (distribution)
+        {
+            case Distribution::eRandom: value = next(); break;
+            case Distribution::eSorted: value = static_cast<int>(i); break;
+            case Distribution::eReversed:
+                value = static_cast<int>(size - i);
+                break;
+            case Distribution::eSawtooth:
+                value = static_cast<int>(i % 97);
+                break;
+            case Distribution::eOrganPipe:
+                value = static_cast<int>(i < size / 2 ? i : size - i);
+                break;
+            case Distribution::eFewUnique: value = next() % 5; break;
+            case Distribution::eAllEqual: value = 7; break;
+        }
+        v[i] = value;
+    }
+
+    return v;
+}
+
+// Sorted, and a permutation of the input: both sum and xor of squares kept
+template <typename Container>
+bool IsSortedPermutation(const Container& sorted, const Container& original)
+{
+    if (!IsSorted(sorted) || sorted.Size() != original.Size()) return false;
+
+    u64 sum[2] = {}, squares[2] = {};
+    for (usize i = 0; i < sorted.Size(); ++i)
+    {
+        sum[0] += static_cast<u64>(sorted[i]);
+        sum[1] += static_cast<u64>(original[i]);
+        squares[0] ^= static_cast<u64>(sorted[i]) * sorted[i] + sorted[i];
+        squares[1]
+            ^= static_cast<u64>(original[i]) * original[i] + original[i];
+    }
+
+    return sum[0] == sum[1] && squares[0] == squares[1];
+}
+
+void TestPatternDefeatingSort()
+{
+    for (usize size : {2zu, 23zu, 24zu, 129zu, 1000zu, 100'000zu})
+        for (auto distribution :
+             {Distribution::eRandom, Distribution::eSorted,
+              Distribution::eReversed, Distribution::eSawtooth,
+              Distribution::eOrganPipe, Distribution::eFewUnique,
+              Distribution::eAllEqual})
+        {
+            Vector<int> original = Generate(distribution, size);
+
+            // Branchless partition for arithmetic keys under Less
+            Vector<int> v        = original;
+            Sort(v.begin(), v.end());
+            assert(IsSortedPermutation(v, original));
+
+            // Generic partition for any other comparator
+            Vector<int> w    = original;
+            usize       comparisons = 0;
+            Sort(w.begin(), w.end(),
+                 [&comparisons](int lhs, int rhs)
+                 {
+                     ++comparisons;
+                     return lhs < rhs;
+                 });
+            assert(IsSortedPermutation(w, original));
+
+            // Single runs are recognized in one pass
+            if (distribution == Distribution::eSorted
+                || distribution == Distribution::eReversed
+                || distribution == Distribution::eAllEqual)
+                assert(comparisons < size);
+        }
+
+    // Descending order through Greater
+    Vector<int> v = Generate(Distribution::eRandom, 5000);
+    Sort(v.begin(), v.end(), Greater<>{});
+    for (usize i = 1; i < v.Size(); ++i) assert(v[i - 1] >= v[i]);
+
+    // Move-only friendly element type with a non-trivial comparison
+    struct Record
+    {
+        int  Key;
+        int  Payload;
+        bool operator<(const Record& other) const { return Key < other.Key; }
+    };
+    Vector<Record> records(3000);
+    for (usize i = 0; i < records.Size(); ++i)
+        records[i] = {static_cast<int>((i * 7919) % 1009), static_cast<int>(i)};
+    Sort(records.begin(), records.end(), Less<Record>{});
+    for (usize i = 1; i < records.Size(); ++i)
+        assert(!(records[i] < records[i - 1]));
+}
+
+// Keys with their original positions, to tell equal keys apart
+struct Tagged
+{
+    int   Key;
+    usize Position;
+};
+
+bool IsStablySorted(const Vector<Tagged>& v)
+{
+    for (usize i = 1; i < v.Size(); ++i)
+    {
+        if (v[i].Key < v[i - 1].Key) return false;
+        if (v[i].Key == v[i - 1].Key && v[i].Position < v[i - 1].Position)
+            return false;
+    }
+    return true;
+}
+
+template <typename Sorter>
+void TestStability(Sorter sorter)
+{
+    auto byKey = [](const Tagged& lhs, const Tagged& rhs)
+    { return lhs.Key < rhs.Key; };
+
+    for (usize size : {2zu, 31zu, 33zu, 257zu, 5000zu, 100'000zu})
+        for (auto distribution :
+             {Distribution::eRandom, Distribution::eSorted,
+              Distribution::eReversed, Distribution::eSawtooth,
+              Distribution::eOrganPipe, Distribution::eFewUnique,
+              Distribution::eAllEqual})
+        {
+            Vector<int>    keys = Generate(distribution, size);
+            Vector<Tagged> v(size);
+            for (usize i = 0; i < size; ++i) v[i] = {keys[i] % 1000, i};
+
+            sorter(v.begin(), v.end(), byKey);
+            assert(IsStablySorted(v));
+        }
+}
+
+void TestStableSort()
+{
+    TestStability([](auto first, auto last, auto comp)
+                  { StableSort(first, last, comp); });
+    TestStability([](auto first, auto last, auto comp)
+                  { StableSortInPlace(first, last, comp); });
+
+    // Sorted input with a few elements out of place, and sorted blocks
+    // appended to each other, take far fewer comparisons than n log n
+    Vector<int> v = Generate(Distribution::eSorted, 100'000);
+    for (usize i = 0; i < 10; ++i) v[(i * 7919) % v.Size()] = -1;
+    Vector<int> w(100'000);
+    for (usize i = 0; i < w.Size(); ++i)
+        w[i] = static_cast<int>((3 - i / 25'000) * 25'000 + i % 25'000);
+
+    for (Vector<int>* input : {&v, &w})
+    {
+        Vector<int> original    = *input;
+        usize       comparisons = 0;
+        StableSort(input->begin(), input->end(),
+                   [&comparisons](int lhs, int rhs)
+                   {
+                       ++comparisons;
+                       return lhs < rhs;
+                   });
+        assert(IsSortedPermutation(*input, original));
+        assert(comparisons < 4 * input->Size());
+    }
+
+    // Without memory for the scratch buffer, merges rotate in place
+    {
+        g_FailAllocations = true;
+        Detail::MergeBuffer<int> buffer(64);
+        g_FailAllocations = false;
+        assert(!buffer.Raw() && buffer.Capacity() == 0);
+    }
+    for (auto distribution : {Distribution::eRandom, Distribution::eSawtooth,
+                              Distribution::eFewUnique})
+    {
+        Vector<int>    keys = Generate(distribution, 5000);
+        Vector<Tagged> tagged(keys.Size());
+        for (usize i = 0; i < keys.Size(); ++i) tagged[i] = {keys[i] % 100, i};
+
+        g_FailAllocations = true;
+        StableSort(tagged.begin(), tagged.end(),
+                   [](const Tagged& lhs, const Tagged& rhs)
+                   { return lhs.Key < rhs.Key; });
+        g_FailAllocations = false;
+        assert(IsStablySorted(tagged));
+    }
+
+    // Merge of two sorted halves, with the buffer sized to the shorter one
+    Vector<int> halves = {1, 3, 5, 7, 9, 11, 2, 4};
+    Merge(halves.begin(), halves.begin() + 6, halves.end(), Less<int>{});
+    assert(IsSorted(halves));
+}
+
+void TestRadixSort()
+{
+    for (usize size : {2zu, 63zu, 64zu, 1000zu, 100'000zu})
+        for (auto distribution :
+             {Distribution::eRandom, Distribution::eSorted,
+              Distribution::eReversed, Distribution::eSawtooth,
+              Distribution::eFewUnique, Distribution::eAllEqual})
+        {
+            Vector<int> keys = Generate(distribution, size);
+
+            // Signed keys, negative ones included, through Sort's projection
+            Vector<int> v    = keys;
+            for (usize i = 0; i < size; i += 3) v[i] = -v[i];
+            Vector<int> original = v;
+            Sort(v.begin(), v.end(), [](int value) { return value; });
+            assert(IsSortedPermutation(v, original));
+
+            // Stable on a projected key, with a caller provided buffer
+            Vector<Tagged> w(size), scratch(size);
+            for (usize i = 0; i < size; ++i) w[i] = {keys[i] % 1000, i};
+            RadixSort(w.begin(), w.end(), Span<Tagged>(scratch.Raw(), size),
+                      [](const Tagged& tagged) { return tagged.Key; });
+            assert(IsStablySorted(w));
+        }
+
+    // 64 bit keys with only the low digits in use skip the upper passes
+    Vector<u64> wide(5000);
+    for (usize i = 0; i < wide.Size(); ++i) wide[i] = (i * 7919) % 5000;
+    RadixSort(wide.begin(), wide.end());
+    for (usize i = 0; i < wide.Size(); ++i) assert(wide[i] == i);
+
+    // Byte strings, compared as unsigned, prefixes first
+    const char* words[]
+        = {"pear", "peach", "", "apple", "pea", "\xe2\x82\xac", "apricot",
+           "pear", "a", "peaches", "banana", "ap", "Zebra"};
+    Vector<StringView> strings;
+    for (usize round = 0; round < 10; ++round)
+        for (const char* word : words) strings.PushBack(word);
+    Sort(strings.begin(), strings.end(),
+         [](StringView string) { return string; });
+    for (usize i = 1; i < strings.Size(); ++i)
+        assert(std::strcmp(strings[i - 1].Raw(), strings[i].Raw()) <= 0);
+
+    // Every key a prefix of the next: one level per byte of the longest
+    static char nested[4001];
+    std::memset(nested, 'a', 4000);
+    Vector<StringView> prefixes;
+    for (usize i = 0; i <= 4000; ++i)
+        prefixes.PushBack(StringView(nested, (i * 7919) % 4001));
+    RadixSort(prefixes.begin(), prefixes.end());
+    for (usize i = 0; i < prefixes.Size(); ++i)
+        assert(prefixes[i].Size() == i);
+
+    // Without memory for the copy, comparison sorts take over, and the
+    // caller provided buffer needs no memory at all
+    for (usize size : {1000zu, 100'000zu})
+    {
+        Vector<int>    v = Generate(Distribution::eRandom, size);
+        Vector<int>    original = v;
+        Vector<Tagged> w(size), scratch(size);
+        for (usize i = 0; i < size; ++i) w[i] = {v[i] % 1000, i};
+        Vector<Tagged> x = w;
+
+        g_FailAllocations = true;
+        Sort(v.begin(), v.end(), [](int value) { return value; });
+        RadixSort(w.begin(), w.end(),
+                  [](const Tagged& tagged) { return tagged.Key; });
+        RadixSort(x.begin(), x.end(), Span<Tagged>(scratch.Raw(), size),
+                  [](const Tagged& tagged) { return tagged.Key; });
+        g_FailAllocations = false;
+
+        assert(IsSortedPermutation(v, original));
+        assert(IsStablySorted(w) && IsStablySorted(x));
+    }
+}
+
 int main()
 {
+    TestPatternDefeatingSort();
+    TestStableSort();
+    TestRadixSort();
+
     TestSortAlgorithm(InsertionSort);
     TestSortAlgorithm(HeapSort);
     TestSortAlgorithm(MergeSort);
@@ -0,0 +1,263 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/WyHash.hpp>
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/String/String.hpp>
+#include <Prism/String/StringUtils.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+using namespace Prism;
+
+// A reduced SMHasher: known answers, avalanche, sparse and zero keys,
+// seeds, bucket distribution, and agreement between the compile-time,
+// scalar and SIMD code paths
+namespace
+{
+    u64 s_State = 0x0123'4567'89ab'cdefzu;
+    u64 NextRandom()
+    {
+        u64 z = (s_State += 0x9e37'79b9'7f4a'7c15zu);
+        z     = (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9zu;
+        z     = (z ^ (z >> 27)) * 0x94d0'49bb'1331'11ebzu;
+        return z ^ (z >> 31);
+    }
+    void FillRandom(u8* data, usize size)
+    {
+        for (usize i = 0; i < size; ++i)
+            data[i] = static_cast<u8>(NextRandom());
+    }
+    bool AllDistinct(Vector<u64>& hashes)
+    {
+        std::sort(hashes.begin(), hashes.end());
+        return std::adjacent_find(hashes.begin(), hashes.end())
+            == hashes.end();
+    }
+
+    void TestKnownAnswers()
+    {
+        // The reference vectors of wyhash final 4, which the short path
+        // follows exactly; the seed is the index
+        const char* messages[] = {
+            "",
+            "a",
+            "abc",
+            "message digest",
+            "abcdefghijklmnopqrstuvwxyz",
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+            "123456789012345678901234567890123456789012345678901234567890123"
+            "45678901234567890",
+        };
+        const u64 expected[] = {
+            0x9322'8a4d'e0ee'c5a2zu, 0xc5ba'c3db'1787'13c4zu,
+            0xa97f'2f7b'1d9b'3314zu, 0x786d'1f1d'f380'1df4zu,
+            0xdca5'a813'8ad3'7c87zu, 0xb9e7'34f1'17cf'af70zu,
+            0x6cc5'eab4'9a92'd617zu,
+        };
+
+        for (usize i = 0; i < 7; ++i)
+            assert(WyHash::Hash(messages[i], std::strlen(messages[i]), i)
+                   == expected[i]);
+    }
+
+    struct LongKey
+    {
+        char Data[3000];
+    };
+    consteval LongKey MakeLongKey()
+    {
+        LongKey key{};
+        for (usize i = 0; i < sizeof(key.Data); ++i)
+            key.Data[i] = static_cast<char>(i * 131 + (i >> 7));
+
+        return key;
+    }
+    inline constexpr LongKey LONG_KEY = MakeLongKey();
+
+    template <usize Size>
+    consteval u64 HashAtCompileTime(u64 seed)
+    {
+        return WyHash::Hash(LONG_KEY.Data, Size, seed);
+    }
+
+    void TestCodePathsAgree()
+    {
+        // Constant evaluation runs the scalar code; at runtime long keys
+        // take the SIMD path where there is one
+        constexpr u64 hashes[] = {
+            HashAtCompileTime<0>(1),    HashAtCompileTime<3>(1),
+            HashAtCompileTime<16>(1),   HashAtCompileTime<47>(1),
+            HashAtCompileTime<512>(1),  HashAtCompileTime<513>(1),
+            HashAtCompileTime<1024>(1), HashAtCompileTime<1025>(1),
+            HashAtCompileTime<2999>(7),
+        };
+        const usize sizes[] = {0, 3, 16, 47, 512, 513, 1024, 1025, 2999};
+        for (usize i = 0; i < 9; ++i)
+        {
+            u64 seed = i == 8 ? 7 : 1;
+            assert(WyHash::Hash(LONG_KEY.Data, sizes[i], seed) == hashes[i]);
+        }
+
+        // Wider code units hash as their little-endian bytes, at compile
+        // time as well
+        constexpr char16_t wide[]  = u"path/to/a/file";
+        constexpr u64      hashed  = WyHash::Hash(wide, 14);
+        u8                 bytes[28];
+        std::memcpy(bytes, wide, sizeof(bytes));
+        assert(WyHash::Hash(bytes, sizeof(bytes)) == hashed);
+
+        // Neither the alignment of the key nor the bytes around it matter
+        alignas(16) u8 buffer[2100];
+        FillRandom(buffer, sizeof(buffer));
+        for (usize size : {7zu, 33zu, 700zu, 2048zu})
+        {
+            u64 reference = WyHash::Hash(buffer, size);
+            for (usize offset = 1; offset < 16; ++offset)
+            {
+                std::memmove(buffer + offset, buffer + offset - 1, size);
+                assert(WyHash::Hash(buffer + offset, size) == reference);
+                buffer[offset - 1] ^= 0xff;
+                buffer[offset + size] ^= 0xff;
+                assert(WyHash::Hash(buffer + offset, size) == reference);
+            }
+            std::memmove(buffer, buffer + 15, size);
+        }
+    }
+
+    // Flipping any input bit has to flip every output bit with a
+    // probability of one half
+    void TestAvalanche(usize size, usize bitStep)
+    {
+        constexpr usize SAMPLES = 3000;
+
+        Vector<u32>     flips;
+        usize           bitCount = (size * 8 + bitStep - 1) / bitStep;
+        flips.Resize(bitCount * 64);
+        Vector<u8> key;
+        key.Resize(size);
+
+        for (usize sample = 0; sample < SAMPLES; ++sample)
+        {
+            FillRandom(key.Raw(), size);
+            u64 hash = WyHash::Hash(key.Raw(), size);
+
+            for (usize bit = 0, index = 0; bit < size * 8;
+                 bit += bitStep, ++index)
+            {
+                key[bit / 8] ^= 1 << (bit % 8);
+                u64 changed = hash ^ WyHash::Hash(key.Raw(), size);
+                key[bit / 8] ^= 1 << (bit % 8);
+
+                for (usize out = 0; out < 64; ++out)
+                    flips[index * 64 + out] += (changed >> out) & 1;
+            }
+        }
+
+        // Six standard deviations of a fair coin over SAMPLES tosses
+        for (u32 count : flips)
+        {
+            f64 bias = static_cast<f64>(count) / SAMPLES - 0.5;
+            assert(bias < 0.055 && bias > -0.055);
+        }
+    }
+
+    void TestSparseKeys()
+    {
+        // Every 32-byte key with at most two bits set
+        Vector<u64> hashes;
+        u8          key[32] = {};
+        hashes.PushBack(WyHash::Hash(key, 32));
+        for (usize i = 0; i < 256; ++i)
+        {
+            key[i / 8] ^= 1 << (i % 8);
+            hashes.PushBack(WyHash::Hash(key, 32));
+            for (usize j = i + 1; j < 256; ++j)
+            {
+                key[j / 8] ^= 1 << (j % 8);
+                hashes.PushBack(WyHash::Hash(key, 32));
+                key[j / 8] ^= 1 << (j % 8);
+            }
+            key[i / 8] ^= 1 << (i % 8);
+        }
+        assert(hashes.Size() == 1 + 256 + 256 * 255 / 2);
+        assert(AllDistinct(hashes));
+
+        // Every 1536-byte key with one bit set, on the bulk path
+        hashes.Clear();
+        u8 longKey[1536] = {};
+        for (usize i = 0; i < sizeof(longKey) * 8; ++i)
+        {
+            longKey[i / 8] ^= 1 << (i % 8);
+            hashes.PushBack(WyHash::Hash(longKey, sizeof(longKey)));
+            longKey[i / 8] ^= 1 << (i % 8);
+        }
+        assert(AllDistinct(hashes));
+    }
+
+    void TestZeroKeysAndSeeds()
+    {
+        // Runs of zeros only differ in their length
+        static u8   zeros[4096] = {};
+        Vector<u64> hashes;
+        for (usize size = 0; size <= sizeof(zeros); ++size)
+            hashes.PushBack(WyHash::Hash(zeros, size));
+        assert(AllDistinct(hashes));
+
+        hashes.Clear();
+        for (u64 seed = 0; seed < 4096; ++seed)
+        {
+            hashes.PushBack(WyHash::Hash("key", 3, seed));
+            hashes.PushBack(WyHash::Hash(zeros, 1000, seed << 40));
+        }
+        assert(AllDistinct(hashes));
+    }
+
+    void TestBuckets()
+    {
+        // Sequential identifiers spread evenly over the low bits, which
+        // is what a power-of-two hash table indexes with
+        constexpr usize BUCKETS = 1024;
+        constexpr usize KEYS    = 64 * BUCKETS;
+
+        Vector<u32>     loads;
+        loads.Resize(BUCKETS);
+        for (usize i = 0; i < KEYS; ++i)
+        {
+            String key = "identifier_" + StringUtils::ToString(i);
+            ++loads[WyHash::Hash(key.Raw(), key.Size()) % BUCKETS];
+        }
+
+        f64 chiSquare = 0;
+        for (u32 load : loads)
+        {
+            f64 difference = static_cast<f64>(load) - 64.0;
+            chiSquare += difference * difference / 64.0;
+        }
+        // 1023 degrees of freedom: the mean is 1023, sigma about 45
+        assert(chiSquare < 1023 + 6 * 45);
+    }
+} // namespace
+
+int main()
+{
+    TestKnownAnswers();
+    TestCodePathsAgree();
+
+    // One-byte keys take too few values for a meaningful estimate
+    for (usize size : {2zu, 3zu, 4zu, 8zu, 12zu, 16zu, 17zu, 48zu, 100zu})
+        TestAvalanche(size, 1);
+    TestAvalanche(513, 41);
+    TestAvalanche(1100, 67);
+
+    TestSparseKeys();
+    TestZeroKeysAndSeeds();
+    TestBuckets();
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/BTree.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <cassert>
+#include <map>
+#include <string>
+
+using namespace Prism;
+
+namespace
+{
+    u64 NextRandom(u64& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    template <typename K, typename V>
+    void ExpectSame(const BTree<K, V>& tree, const std::map<K, V>& expected)
+    {
+        assert(tree.GetSize() == expected.size());
+        assert(tree.IsEmpty() == expected.empty());
+
+        auto it = tree.begin();
+        for (const auto& [key, value] : expected)
+        {
+            assert(it != tree.end());
+            assert(it->Key == key && it->Value == value);
+            ++it;
+        }
+        assert(it == tree.end());
+
+        // And back again over the leaf links
+        for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit)
+        {
+            --it;
+            assert((*it).Key == rit->first);
+        }
+        assert(it == tree.begin());
+    }
+
+    void TestBasics()
+    {
+        BTree<int, std::string> tree;
+        std::string             apple = "apple";
+        assert(tree.IsEmpty() && tree.begin() == tree.end());
+        assert(!tree.Contains(1) && !tree.Erase(1));
+
+        tree.Insert(10, apple);
+        tree.Insert(20, "banana");
+        tree.Insert(5, "cherry");
+        assert(tree.GetSize() == 3 && tree.At(10) == "apple");
+
+        // Inserting an existing key assigns its value
+        tree.Insert(10, "avocado");
+        assert(tree.GetSize() == 3 && tree.At(10) == "avocado");
+
+        tree[7] = "date";
+        assert(tree.GetSize() == 4 && tree[7] == "date");
+
+        assert(tree.FindLargestNotAbove(4) == tree.end());
+        assert(tree.FindLargestNotAbove(9)->Key == 7);
+        assert(tree.FindLargestNotAbove(100)->Key == 20);
+        assert(tree.LowerBound(10)->Key == 10);
+        assert(tree.UpperBound(10)->Key == 20);
+        assert(tree.UpperBound(20) == tree.end());
+
+        assert(tree.Erase(10) && !tree.Contains(10) && tree.GetSize() == 3);
+        tree.Clear();
+        assert(tree.IsEmpty() && tree.Find(5) == tree.end());
+    }
+
+    // Random insertions and erasures through every split, borrow and merge
+    void TestAgainstMap()
+    {
+        BTree<u32, u32>         tree;
+        std::map<u32, u32>      expected;
+        u64                     state = 0x9e37'79b9'7f4a'7c15ull;
+
+        for (usize round = 0; round < 20'000; ++round)
+        {
+            u32 key   = NextRandom(state) % 2000;
+            u32 value = NextRandom(state);
+            if (NextRandom(state) % 3 != 0)
+            {
+                tree.Insert(key, value);
+                expected[key] = value;
+            }
+            else assert(tree.Erase(key) == (expected.erase(key) == 1));
+
+            if (round % 1000 == 0) ExpectSame(tree, expected);
+        }
+        ExpectSame(tree, expected);
+
+        for (u32 key = 0; key <= 2001; ++key)
+        {
+            auto lower = expected.lower_bound(key);
+            auto upper = expected.upper_bound(key);
+            auto found = tree.LowerBound(key);
+            assert((found == tree.end()) == (lower == expected.end()));
+            if (lower != expected.end()) assert(found->Key == lower->first);
+
+            found = tree.UpperBound(key);
+            assert((found == tree.end()) == (upper == expected.end()));
+            if (upper != expected.end()) assert(found->Key == upper->first);
+            assert(tree.Contains(key) == expected.contains(key));
+        }
+
+        // Draining it collapses the tree level by level
+        while (!expected.empty())
+        {
+            u32 key = expected.begin()->first;
+            expected.erase(expected.begin());
+            assert(tree.Erase(key));
+        }
+        assert(tree.IsEmpty() && tree.begin() == tree.end());
+    }
+
+    // Non integral keys go through the binary search
+    void TestStringKeys()
+    {
+        BTree<std::string, usize>    tree;
+        std::map<std::string, usize> expected;
+        for (usize i = 0; i < 3000; ++i)
+        {
+            std::string key = std::to_string(i * 7919 % 3000);
+            tree.Insert(key, i);
+            expected[key] = i;
+        }
+        for (usize i = 0; i < 3000; i += 3)
+        {
+            std::string key = std::to_string(i);
+            assert(tree.Erase(key));
+            expected.erase(key);
+        }
+
+        ExpectSame(tree, expected);
+    }
+
+    void TestBuildFromSorted()
+    {
+        for (usize size : {0, 1, 31, 32, 33, 100, 1057, 50'000})
+        {
+            Vector<KeyValuePair<u64, u64>> sorted;
+            std::map<u64, u64>             expected;
+            for (usize i = 0; i < size; ++i)
+            {
+                sorted.PushBack({i * 3, i});
+                expected[i * 3] = i;
+            }
+
+            BTree<u64, u64> tree;
+            tree.Insert(1, 1);
+            tree.BuildFromSorted(sorted.begin(), sorted.end());
+            ExpectSame(tree, expected);
+
+            // A packed tree still takes updates
+            for (u64 key = 1; key < size * 3; key += 6)
+            {
+                tree.Insert(key, key);
+                expected[key] = key;
+            }
+            for (u64 key = 0; key < size * 3; key += 9)
+            {
+                tree.Erase(key);
+                expected.erase(key);
+            }
+            ExpectSame(tree, expected);
+        }
+    }
+
+    void TestRangeIteration()
+    {
+        BTree<u32, u32> tree;
+        for (u32 i = 0; i < 1000; ++i) tree.Insert(i * 2, i);
+
+        // Entries in [100, 200)
+        u32 count = 0;
+        for (auto it = tree.LowerBound(100); it != tree.LowerBound(200); ++it)
+        {
+            assert(it->Key == 100 + count * 2);
+            it->Value = 0;
+            ++count;
+        }
+        assert(count == 50 && tree.At(150) == 0 && tree.At(200) == 100);
+    }
+
+    void TestMove()
+    {
+        BTree<u32, u32> tree;
+        for (u32 i = 0; i < 500; ++i) tree.Insert(i, i);
+
+        BTree<u32, u32> moved(Move(tree));
+        assert(tree.IsEmpty() && moved.GetSize() == 500);
+
+        tree = Move(moved);
+        assert(moved.IsEmpty() && tree.GetSize() == 500 && tree.At(499) == 499);
+    }
+
+    void TestCopy()
+    {
+        BTree<u32, std::string> tree;
+        for (u32 i = 0; i < 300; ++i) tree.Insert(i, std::to_string(i));
+
+        BTree<u32, std::string> copy(tree);
+        copy.Erase(7);
+        copy[299] = "changed";
+        assert(tree.GetSize() == 300 && tree.At(7) == "7");
+        assert(tree.At(299) == "299" && copy.GetSize() == 299);
+
+        tree = copy;
+        tree = static_cast<const BTree<u32, std::string>&>(tree);
+        assert(!tree.Contains(7) && tree.At(299) == "changed");
+        assert(tree.GetSize() == 299 && copy.At(298) == "298");
+
+        BTreeSet<u32> set;
+        for (u32 i = 0; i < 100; ++i) set.Insert(i);
+        BTreeSet<u32> setCopy = set;
+        set.Clear();
+        assert(setCopy.GetSize() == 100 && setCopy.Contains(99));
+    }
+
+    void TestReverseIteration()
+    {
+        BTree<u32, u32> tree;
+        assert(tree.rbegin() == tree.rend());
+        for (u32 i = 0; i < 500; ++i) tree.Insert(i * 2, i);
+
+        u32 expected = 500;
+        for (auto it = tree.rbegin(); it != tree.rend(); ++it)
+        {
+            --expected;
+            assert((*it).Key == expected * 2 && (*it).Value == expected);
+            (*it).Value = 0;
+        }
+        assert(expected == 0 && tree.At(998) == 0);
+
+        const auto& constTree = tree;
+        assert((*constTree.rbegin()).Key == 998);
+
+        BTreeSet<u32> set;
+        for (u32 i = 0; i < 100; ++i) set.Insert(i);
+        expected = 100;
+        for (auto it = set.rbegin(); it != set.rend(); ++it)
+            assert(*it == --expected);
+        assert(expected == 0);
+    }
+
+    void TestSet()
+    {
+        BTreeSet<u32> set;
+        assert(set.Insert(3).Value && set.Insert(1).Value);
+        assert(!set.Insert(3).Value && *set.Insert(3).Key == 3);
+        assert(set.GetSize() == 2 && set.Count(1) == 1 && set.Count(2) == 0);
+        assert(*set.LowerBound(2) == 3 && set.UpperBound(3) == set.end());
+        assert(set.Erase(1) == 1 && set.Erase(1) == 0);
+
+        Vector<u32> sorted;
+        for (u32 i = 0; i < 1000; ++i) sorted.PushBack(i * 5);
+        set.BuildFromSorted(sorted.begin(), sorted.end());
+
+        u32 expected = 0;
+        for (u32 key : set) assert(key == expected), expected += 5;
+        assert(expected == 5000 && set.Contains(495) && !set.Contains(3));
+    }
+} // namespace
+
+int main()
+{
+    TestBasics();
+    TestAgainstMap();
+    TestStringKeys();
+    TestBuildFromSorted();
+    TestRangeIteration();
+    TestMove();
+    TestCopy();
+    TestReverseIteration();
+    TestSet();
+
+    return 0;
+}
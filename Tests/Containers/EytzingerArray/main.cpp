@@ -0,0 +1,103 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Algorithm/Find.hpp>
+#include <Prism/Containers/EytzingerArray.hpp>
+#include <Prism/Containers/Vector.hpp>
+
+#include <cassert>
+
+using namespace Prism;
+
+namespace
+{
+    // Every tree shape up to a few full levels, against LowerBound
+    void TestSearch()
+    {
+        for (usize size = 0; size < 100; ++size)
+        {
+            Vector<u32> sorted(size);
+            for (usize i = 0; i < size; ++i) sorted[i] = (i / 2) * 3;
+            EytzingerArray<u32> array(sorted.begin(), sorted.end());
+            assert(array.Size() == size);
+
+            for (u32 value = 0; value <= size * 2 + 2; ++value)
+            {
+                auto lower = LowerBound(sorted.begin(), sorted.end(), value);
+                auto upper = UpperBound(sorted.begin(), sorted.end(), value);
+
+                const u32* found = array.LowerBound(value);
+                assert((found == nullptr) == (lower == sorted.end()));
+                if (found) assert(*found == *lower);
+
+                found = array.UpperBound(value);
+                assert((found == nullptr) == (upper == sorted.end()));
+                if (found) assert(*found == *upper);
+
+                assert(array.Contains(value) == (lower != upper));
+            }
+        }
+    }
+
+    void TestForEach()
+    {
+        Vector<u32> sorted(1000);
+        for (usize i = 0; i < sorted.Size(); ++i) sorted[i] = i * 7;
+        EytzingerArray<u32> array(sorted.begin(), sorted.end());
+
+        usize               index = 0;
+        array.ForEach([&](u32 value) { assert(value == sorted[index++]); });
+        assert(index == sorted.Size());
+    }
+
+    struct Symbol
+    {
+        u64         Address;
+        const char* Name;
+    };
+    struct AddressLess
+    {
+        bool operator()(const Symbol& symbol, u64 address) const
+        {
+            return symbol.Address < address;
+        }
+        bool operator()(u64 address, const Symbol& symbol) const
+        {
+            return address < symbol.Address;
+        }
+    };
+
+    // Heterogeneous lookup, copies and moves
+    void TestSymbols()
+    {
+        Symbol symbols[] = {{0x1000, "Start"}, {0x1400, "Main"},
+                            {0x2000, "Panic"}, {0x3800, "Halt"}};
+        EytzingerArray<Symbol, AddressLess> array(symbols, symbols + 4);
+
+        assert(array.Find(0x2000)->Name == symbols[2].Name);
+        assert(array.Find(0x2001) == nullptr);
+        assert(array.UpperBound(0x1400)->Name == symbols[2].Name);
+
+        EytzingerArray<Symbol, AddressLess> copy = array;
+        array.Clear();
+        assert(array.Empty() && copy.Size() == 4);
+        assert(copy.LowerBound(0x3000)->Name == symbols[3].Name);
+
+        EytzingerArray<Symbol, AddressLess> moved = Move(copy);
+        assert(copy.Empty() && moved.Contains(0x1000));
+        copy = moved;
+        assert(copy.Size() == 4 && copy.Find(0x1400)->Name == symbols[1].Name);
+    }
+} // namespace
+
+int main()
+{
+    TestSearch();
+    TestForEach();
+    TestSymbols();
+
+    return 0;
+}
@@ -6,7 +6,11 @@
  */
 #include <Prism/Containers/IntrusiveRedBlackTree.hpp>
 
+#include <Prism/Containers/KeyValuePair.hpp>
+#include <Prism/Containers/Vector.hpp>
+
 #include <cassert>
+#include <set>
 #include <string>
 
 using namespace Prism;
@@ -158,8 +162,191 @@ void RBTree_RunAllTests()
     printf("All tests passed.\n");
 }
 
+struct Region
+{
+    u64                                    Base = 0;
+    IntrusiveRedBlackTreeNode<u64, Region> TreeNode;
+};
+
+// Checks the red-black invariants, parent links and key order
+struct CheckedRegionTree : IntrusiveRedBlackTree<&Region::TreeNode>
+{
+    using BaseNode = BaseRedBlackTree<u64>::Node;
+    using Color    = BaseRedBlackTree<u64>::Color;
+
+    static usize BlackHeightOf(BaseNode* node, BaseNode* parent,
+                               usize& count)
+    {
+        if (!node) return 1;
+        assert(node->Parent == parent);
+        if (node->Color == Color::Red)
+            assert(!parent || parent->Color == Color::Black);
+        if (node->LeftChild) assert(node->LeftChild->Key <= node->Key);
+        if (node->RightChild) assert(node->Key <= node->RightChild->Key);
+
+        ++count;
+        usize left  = BlackHeightOf(node->LeftChild, node, count);
+        usize right = BlackHeightOf(node->RightChild, node, count);
+        assert(left == right);
+
+        return left + (node->Color == Color::Black);
+    }
+
+    void Validate(const std::set<u64>& expected)
+    {
+        usize count = 0;
+        assert(!m_Root || m_Root->Color == Color::Black);
+        BlackHeightOf(m_Root, nullptr, count);
+        assert(count == expected.size() && Size() == count);
+        assert(IsEmpty() == expected.empty());
+
+        auto it = expected.begin();
+        for (auto& region : *this) assert(region.Base == *it++);
+        assert(it == expected.end());
+    }
+};
+
+Vector<KeyValuePair<u64, Region*>> SortedEntries(Vector<Region>& regions,
+                                                 usize           count)
+{
+    Vector<KeyValuePair<u64, Region*>> entries;
+    for (usize i = 0; i < count; ++i)
+        entries.PushBack({regions[i].Base, &regions[i]});
+    return entries;
+}
+
+void IntrusiveRBTree_TestBuildFromSorted()
+{
+    Vector<Region> regions(1000);
+    for (usize i = 0; i < regions.Size(); ++i) regions[i].Base = i * 0x1000;
+
+    for (usize count = 0; count <= 1000; count += count < 70 ? 1 : 93)
+    {
+        CheckedRegionTree tree;
+        auto              entries = SortedEntries(regions, count);
+        tree.BuildFromSorted(entries.begin(), entries.end());
+
+        std::set<u64> expected;
+        for (usize i = 0; i < count; ++i) expected.insert(regions[i].Base);
+        tree.Validate(expected);
+
+        // A built tree takes ordinary updates
+        if (count == 0) continue;
+        assert(tree.Remove(regions[count / 2].Base));
+        expected.erase(regions[count / 2].Base);
+        assert(!tree.Find(regions[count / 2].Base));
+        if (count > 1) assert(tree.Find(regions[0].Base) == &regions[0]);
+        tree.Validate(expected);
+        tree.Clear();
+    }
+}
+
+void IntrusiveRBTree_TestSplitJoin()
+{
+    Vector<Region> regions(600);
+    for (usize i = 0; i < regions.Size(); ++i) regions[i].Base = i * 2;
+
+    for (u64 key : {0, 1, 2, 301, 600, 1197, 1198, 5000})
+    {
+        CheckedRegionTree low, high;
+        auto              entries = SortedEntries(regions, regions.Size());
+        low.BuildFromSorted(entries.begin(), entries.end());
+
+        std::set<u64> below, rest;
+        for (auto& region : regions)
+            (region.Base < key ? below : rest).insert(region.Base);
+
+        low.Split(key, high);
+        low.Validate(below);
+        high.Validate(rest);
+        assert(high.IsEmpty() || high.begin()->Base == *rest.begin());
+
+        low.Join(high);
+        assert(high.IsEmpty() && high.Size() == 0);
+        below.insert(rest.begin(), rest.end());
+        low.Validate(below);
+        low.Clear();
+    }
+}
+
+void IntrusiveRBTree_TestEraseRange()
+{
+    Vector<Region>    regions(3000);
+    Vector<bool>      inserted(regions.Size());
+    CheckedRegionTree tree;
+    std::set<u64>     expected;
+    u64               state = 0x2545'f491'4f6c'dd1dull;
+    for (usize i = 0; i < regions.Size(); ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        regions[i].Base = state % 100'000;
+        inserted[i]     = expected.insert(regions[i].Base).second;
+        if (inserted[i]) tree.Insert(regions[i].Base, regions[i]);
+    }
+    tree.Validate(expected);
+
+    for (usize round = 0; round < 200 && !expected.empty(); ++round)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        u64 lo = state % 100'000;
+        u64 hi = lo + state % 3000;
+
+        auto first = expected.lower_bound(lo);
+        auto last  = expected.lower_bound(hi);
+        usize count = 0;
+        for (auto it = first; it != last; ++it) ++count;
+        expected.erase(first, last);
+
+        assert(tree.EraseRange(lo, hi) == count);
+        tree.Validate(expected);
+    }
+
+    // Erased regions are released, and duplicates were never inserted
+    for (usize i = 0; i < regions.Size(); ++i)
+        assert(regions[i].TreeNode.IsInTree()
+               == (inserted[i] && expected.contains(regions[i].Base)));
+
+    // Released regions can go back into the tree
+    for (usize i = 0; i < regions.Size(); ++i)
+    {
+        if (!inserted[i] || regions[i].TreeNode.IsInTree()) continue;
+        tree.Insert(regions[i].Base, regions[i]);
+        expected.insert(regions[i].Base);
+    }
+    tree.Validate(expected);
+    for (u64 base : {0ull, 50'000ull})
+    {
+        auto first = expected.lower_bound(base);
+        auto last  = expected.lower_bound(base + 10'000);
+        usize count = 0;
+        for (auto it = first; it != last; ++it) ++count;
+        expected.erase(first, last);
+        assert(tree.EraseRange(base, base + 10'000) == count);
+    }
+    for (usize i = 0; i < regions.Size(); ++i)
+        if (inserted[i] && !regions[i].TreeNode.IsInTree())
+        {
+            tree.Insert(regions[i].Base, regions[i]);
+            expected.insert(regions[i].Base);
+        }
+    tree.Validate(expected);
+    tree.Clear();
+}
+
+void IntrusiveRBTree_RunAllTests()
+{
+    IntrusiveRBTree_TestBuildFromSorted();
+    IntrusiveRBTree_TestSplitJoin();
+    IntrusiveRBTree_TestEraseRange();
+}
+
 int main()
 {
     RBTree_RunAllTests();
+    IntrusiveRBTree_RunAllTests();
     return 0;
 }
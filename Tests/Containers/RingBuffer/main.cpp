@@ -63,6 +63,29 @@ void TestEmptyBuffer()
     assert(buffer.Read(reinterpret_cast<u8*>(out), 2) == 0); // nothing to read
 }
 
+void TestWritableRegion()
+{
+    RingBuffer buffer(8);
+
+    char       data[] = "abcdef";
+    assert(buffer.Write(reinterpret_cast<u8*>(data), 6) == 6);
+    char out[8] = {};
+    assert(buffer.Read(reinterpret_cast<u8*>(out), 6) == 6);
+
+    // The free space now wraps: two bytes at the end, six at the front
+    auto region = buffer.WritableRegion();
+    assert(region.First.Size() == 2 && region.Second.Size() == 6);
+    memcpy(region.First.Raw(), "12", 2);
+    memcpy(region.Second.Raw(), "345", 3);
+    assert(buffer.Used() == 0);
+
+    buffer.CommitWrite(5);
+    assert(buffer.Used() == 5 && buffer.Free() == 3);
+    assert(buffer.Read(reinterpret_cast<u8*>(out), 8) == 5);
+    assert(memcmp(out, "12345", 5) == 0);
+    assert(buffer.Used() == 0 && buffer.Free() == 8);
+}
+
 /*
 void TestZeroCopyWriteRead()
 {
@@ -96,6 +119,7 @@ int main()
     TestWraparound();
     TestFullBuffer();
     TestEmptyBuffer();
+    TestWritableRegion();
     // TestZeroCopyWriteRead();
 
     return 0;
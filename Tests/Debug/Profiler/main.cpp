@@ -0,0 +1,182 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Debug/Profiler.hpp>
+
+#include <cassert>
+#include <new>
+
+using namespace Prism;
+
+// Makes the non-throwing operator new report that memory ran out
+static bool g_FailAllocations = false;
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    if (g_FailAllocations) return nullptr;
+    return ::operator new(size);
+}
+
+namespace
+{
+    // Return addresses inside the symbols below
+    constexpr PhysAddr MAIN     = 0x1010;
+    constexpr PhysAddr SCHEDULE = 0x2020;
+    constexpr PhysAddr IDLE     = 0x3030;
+
+    Stacktrace::Symbol MakeSymbol(char* name, PhysAddr address)
+    {
+        Stacktrace::Symbol symbol;
+        symbol.Name    = name;
+        symbol.Address = address;
+
+        return symbol;
+    }
+
+    /// A frame pointer chain returning into @p rips, innermost first
+    template <usize Depth>
+    struct FakeStack
+    {
+        StackFrame Frames[Depth + 1];
+
+        FakeStack(const PhysAddr (&rips)[Depth])
+        {
+            for (usize i = 0; i < Depth; ++i)
+            {
+                Frames[i].PreviousFrame      = &Frames[i + 1];
+                Frames[i].InstructionPointer = rips[i];
+            }
+        }
+
+        Pointer Top() { return &Frames[0]; }
+    };
+
+    void TestWithoutMemory()
+    {
+        g_FailAllocations = true;
+        Profiler profiler(4);
+        g_FailAllocations = false;
+
+        // Every sample is refused instead of written through null
+        FakeStack<2> idle({IDLE, MAIN});
+        assert(!profiler.Sample(0, idle.Top()));
+        profiler.Drain();
+        assert(profiler.SampleCount() == 0 && profiler.DroppedCount() == 0);
+    }
+
+    void TestCounting()
+    {
+        Profiler           profiler(2, 8, 16);
+        FakeStack<2>       idle({IDLE, MAIN});
+        FakeStack<3>       schedule({SCHEDULE, IDLE, MAIN});
+
+        // Interrupted inside Schedule, and twice inside Idle on another CPU
+        assert(profiler.Sample(0, idle.Top(), SCHEDULE + 4));
+        assert(profiler.Sample(1, idle.Top()));
+        assert(profiler.Sample(1, schedule.Top(), 0, 1));
+        profiler.Drain();
+        assert(profiler.SampleCount() == 3 && profiler.StackCount() == 2);
+
+        usize seen = 0;
+        profiler.ForEachStack(
+            [&](Span<const Pointer> frames, usize count)
+            {
+                seen += count;
+                assert(frames.Size() == 3 || frames.Size() == 2);
+                if (frames.Size() == 2)
+                    assert(count == 2 && frames[0].Raw() == IDLE);
+                else assert(count == 1 && frames[0].Raw() == SCHEDULE + 4);
+            });
+        assert(seen == 3);
+
+        // A full ring drops samples until drained
+        for (usize i = 0; i < 8; ++i) assert(profiler.Sample(0, idle.Top()));
+        assert(!profiler.Sample(0, idle.Top()));
+        assert(profiler.DroppedCount() == 1);
+        profiler.Drain();
+        assert(profiler.Sample(0, idle.Top()));
+        profiler.Drain();
+        assert(profiler.SampleCount() == 12 && profiler.StackCount() == 2);
+
+        profiler.Reset();
+        assert(profiler.SampleCount() == 0 && profiler.StackCount() == 0);
+    }
+
+    void TestManyStacks()
+    {
+        Profiler profiler(1, 64, 4);
+        for (usize round = 0; round < 3; ++round)
+        {
+            for (usize i = 0; i < 1000; ++i)
+            {
+                FakeStack<2> stack({0x10000 + i * 16, MAIN});
+                if (!profiler.Sample(0, stack.Top())) profiler.Drain(), --i;
+            }
+            profiler.Drain();
+        }
+
+        assert(profiler.StackCount() == 1000);
+        assert(profiler.SampleCount() == 3000);
+        profiler.ForEachStack([](Span<const Pointer> frames, usize count)
+                              { assert(frames.Size() == 2 && count == 3); });
+    }
+
+    void TestExportFolded()
+    {
+        char           main[]     = "kernel_main";
+        char           schedule[] = "_ZN9Scheduler8ScheduleEv";
+        char           idle[]     = "Idle";
+        Vector<Stacktrace::Symbol> symbols;
+        symbols.PushBack(MakeSymbol(main, 0x1000));
+        symbols.PushBack(MakeSymbol(schedule, 0x2000));
+        symbols.PushBack(MakeSymbol(idle, 0x3000));
+
+        Stacktrace trace;
+        assert(trace.LoadSymbols(Move(symbols), 0x1000, 0x3fff));
+
+        Profiler     profiler(1);
+        FakeStack<2> idleStack({IDLE, MAIN});
+        profiler.Sample(0, idleStack.Top(), SCHEDULE);
+        profiler.Sample(0, idleStack.Top(), SCHEDULE);
+        profiler.Sample(0, idleStack.Top(), 0xdead'0000);
+        profiler.Drain();
+
+        String folded = profiler.ExportFolded(trace);
+        assert(folded.Size()
+               == sizeof("kernel_main;Idle;Scheduler::Schedule() 2\n")
+                      + sizeof("kernel_main;Idle;0xdead0000 1\n") - 2);
+        assert(folded.Find("kernel_main;Idle;Scheduler::Schedule() 2\n")
+               != String::NPos);
+        assert(folded.Find("kernel_main;Idle;0xdead0000 1\n") != String::NPos);
+    }
+
+    [[gnu::noinline]] bool SampleHere(Profiler& profiler)
+    {
+        return profiler.Sample(0, PrismGetFrameAddress(0));
+    }
+
+    // Walks this test's real frame pointer chain
+    void TestLiveStack()
+    {
+        Profiler profiler(1);
+        assert(SampleHere(profiler));
+        profiler.Drain();
+        assert(profiler.SampleCount() == 1 && profiler.StackCount() == 1);
+        profiler.ForEachStack([](Span<const Pointer> frames, usize)
+                              { assert(frames.Size() >= 1); });
+    }
+} // namespace
+
+int main()
+{
+    TestCounting();
+    TestManyStacks();
+    TestExportFolded();
+    TestLiveStack();
+    TestWithoutMemory();
+
+    return 0;
+}
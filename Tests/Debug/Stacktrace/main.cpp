@@ -0,0 +1,149 @@
+/*
+ * Created by v1tr10l7 on 19.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Debug/Stacktrace.hpp>
+
+#include <cassert>
+
+using namespace Prism;
+
+namespace
+{
+    using Symbol = Stacktrace::Symbol;
+
+    Symbol MakeSymbol(char* name, PhysAddr address)
+    {
+        Symbol symbol;
+        symbol.Name    = name;
+        symbol.Address = address;
+
+        return symbol;
+    }
+
+    // The symbol with the highest address not above @p address
+    const Symbol* ReferenceGetSymbol(const Vector<Symbol>& symbols,
+                                     PhysAddr              address)
+    {
+        const Symbol* found = nullptr;
+        for (auto& symbol : symbols)
+            if (symbol.Address.Raw() <= address
+                && (!found || symbol.Address.Raw() >= found->Address.Raw()))
+                found = &symbol;
+
+        return found;
+    }
+
+    void TestGetSymbol()
+    {
+        constexpr PhysAddr LOWEST  = 0xffff'ffff'8000'0000;
+        constexpr PhysAddr HIGHEST = 0xffff'ffff'9000'0000;
+
+        // Unordered, unevenly spread, some outside of the bounds
+        Vector<Symbol>     symbols;
+        u64                state = 0x2545'f491'4f6c'dd1dull;
+        for (usize i = 0; i < 5000; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            PhysAddr address = LOWEST + (state % 0x20'0000) * (i % 7 + 1);
+            symbols.PushBack(MakeSymbol(nullptr, address));
+        }
+        symbols.PushBack(MakeSymbol(nullptr, LOWEST - 0x1000));
+        symbols.PushBack(MakeSymbol(nullptr, HIGHEST + 0x1000));
+
+        Vector<Symbol> inBounds;
+        for (auto& symbol : symbols)
+            if (symbol.Address.Raw() >= LOWEST
+                && symbol.Address.Raw() <= HIGHEST)
+                inBounds.PushBack(symbol);
+
+        Stacktrace trace;
+        assert(trace.LoadSymbols(Move(symbols), LOWEST, HIGHEST));
+
+        for (usize i = 0; i < 20000; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            PhysAddr      address  = LOWEST - 0x100 + state % 0xe0'0000;
+            const Symbol* expected = ReferenceGetSymbol(inBounds, address);
+            const Symbol* found    = trace.GetSymbol(address);
+            if (address < LOWEST) assert(!found);
+            else if (!expected) assert(!found);
+            else assert(found && found->Address == expected->Address);
+        }
+        assert(!trace.GetSymbol(HIGHEST + 0x1000));
+
+        // A single symbol, and none
+        Vector<Symbol> single;
+        single.PushBack(MakeSymbol(nullptr, 0x1000));
+        assert(trace.LoadSymbols(Move(single)));
+        assert(!trace.GetSymbol(0xfff));
+        assert(trace.GetSymbol(0x1000) && trace.GetSymbol(0x8000));
+        assert(trace.LoadSymbols({}));
+        assert(!trace.GetSymbol(0x1000));
+    }
+
+    // A chain of four frames, innermost first, ending in a null frame
+    void TestWalk()
+    {
+        StackFrame frames[5];
+        for (usize i = 0; i < 4; ++i)
+        {
+            frames[i].PreviousFrame      = &frames[i + 1];
+            frames[i].InstructionPointer = PhysAddr(0x1000 * (i + 1));
+        }
+
+        Stacktrace trace(&frames[0], 1, 32);
+        usize      depth = 0;
+        for (Pointer rip : trace)
+            assert(rip.Raw() == 0x1000 * (++depth + 1));
+        assert(depth == 3);
+
+        Pointer captured[2];
+        assert(Stacktrace::Walk(&frames[0], captured, 2) == 2);
+        assert(captured[0].Raw() == 0x1000 && captured[1].Raw() == 0x2000);
+        assert(Stacktrace::Walk(&frames[0], captured, 2, 10) == 0);
+
+        // A chain pointing back down ends the walk
+        frames[2].PreviousFrame = &frames[0];
+        assert(Stacktrace::Walk(&frames[0], captured, 2, 2) == 1);
+    }
+
+    void TestDemangledName()
+    {
+        char           mangled[] = "_ZN5Prism10Stacktrace10GetCurrentEv";
+        char           plain[]   = "kernel_main";
+
+        Vector<Symbol> symbols;
+        symbols.PushBack(MakeSymbol(plain, 0x2000));
+        symbols.PushBack(MakeSymbol(mangled, 0x1000));
+
+        Stacktrace trace;
+        assert(trace.LoadSymbols(Move(symbols)));
+
+        const Symbol* symbol = trace.GetSymbol(0x1010);
+        StringView    name   = trace.DemangledName(*symbol);
+        assert(name == "Prism::Stacktrace::GetCurrent()");
+        // Cached, not demangled again
+        assert(trace.DemangledName(*symbol).Raw() == name.Raw());
+
+        assert(trace.DemangledName(*trace.GetSymbol(0x2000)) == "kernel_main");
+        assert(name == "Prism::Stacktrace::GetCurrent()");
+    }
+} // namespace
+
+int main()
+{
+    TestGetSymbol();
+    TestWalk();
+    TestDemangledName();
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/UnorderedMap.hpp>
+#include <Prism/String/Atom.hpp>
+#include <Prism/String/String.hpp>
+#include <Prism/String/StringUtils.hpp>
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+using namespace Prism;
+
+namespace
+{
+    class Spinlock
+    {
+      public:
+        void Lock()
+        {
+            while (m_Locked.Exchange(true, MemoryOrder::eAcquire))
+                std::this_thread::yield();
+        }
+        void Unlock() { m_Locked.Store(false, MemoryOrder::eRelease); }
+
+      private:
+        Atomic<bool> m_Locked = false;
+    };
+
+    String Name(usize index)
+    {
+        return "identifier_" + StringUtils::ToString(index);
+    }
+
+    void TestIntern()
+    {
+        AtomTable<> table;
+
+        // Distinct buffers with equal contents share one atom
+        String      first  = "NamedLogger";
+        String      second = "NamedLogger";
+        Atom        a      = table.Intern(first);
+        Atom        b      = table.Intern(second);
+        assert(a == b);
+        assert(a.Raw() == b.Raw() && a.Raw() != first.Raw());
+        assert(a.View() == "NamedLogger" && a.Size() == 11);
+        assert(a.Hash() == Hash<StringView>{}(StringView("NamedLogger")));
+        assert(table.Size() == 1);
+
+        Atom other = table.Intern("NamedLoggers");
+        assert(other != a && table.Size() == 2);
+
+        // The empty string is the default atom and is not stored
+        assert(table.Intern("") == Atom());
+        assert(Atom().Empty() && Atom().View().Empty());
+        assert(table.Size() == 2);
+
+        assert(table.Find("NamedLogger").Value() == a);
+        assert(!table.Find("unknown").HasValue());
+        assert(table.Size() == 2);
+    }
+
+    void TestGrowth()
+    {
+        AtomTable<>       table;
+        std::vector<Atom> atoms;
+
+        // Enough strings for several slot arrays and arena blocks, plus one
+        // larger than a block
+        for (usize i = 0; i < 5000; ++i) atoms.push_back(table.Intern(Name(i)));
+        String huge(AtomTable<>::BLOCK_SIZE * 2, 'x');
+        Atom   hugeAtom = table.Intern(huge);
+        assert(hugeAtom.View() == huge.View());
+
+        assert(table.Size() == 5001);
+        for (usize i = 0; i < 5000; ++i)
+        {
+            assert(table.Intern(Name(i)) == atoms[i]);
+            assert(atoms[i].View() == Name(i).View());
+        }
+        assert(table.Find(huge).Value() == hugeAtom);
+
+        // A string with its own block leaves the current one in use, also
+        // when it comes first
+        AtomTable<> fresh;
+        fresh.Intern(huge);
+        Atom first  = fresh.Intern("first");
+        Atom second = fresh.Intern(huge + "y");
+        Atom third  = fresh.Intern("third");
+        assert(first.View() == "first" && third.View() == "third");
+        assert(second.View().Size() == huge.Size() + 1);
+        assert(third.Raw() > first.Raw()
+               && usize(third.Raw() - first.Raw()) < AtomTable<>::BLOCK_SIZE);
+    }
+
+    void TestConcurrentIntern()
+    {
+        constexpr usize          THREAD_COUNT = 8;
+        constexpr usize          NAME_COUNT   = 2000;
+
+        AtomTable<Spinlock>      table;
+        std::vector<Atom>        results[THREAD_COUNT];
+        std::vector<std::thread> threads;
+        for (usize t = 0; t < THREAD_COUNT; ++t)
+            threads.emplace_back(
+                [&, t]
+                {
+                    // Every thread interns every name, in a different order
+                    for (usize i = 0; i < NAME_COUNT; ++i)
+                    {
+                        usize index = (i * 7 + t * 131) % NAME_COUNT;
+                        results[t].push_back(table.Intern(Name(index)));
+                    }
+                });
+        for (auto& thread : threads) thread.join();
+
+        assert(table.Size() == NAME_COUNT);
+        for (usize t = 0; t < THREAD_COUNT; ++t)
+            for (usize i = 0; i < NAME_COUNT; ++i)
+            {
+                usize index = (i * 7 + t * 131) % NAME_COUNT;
+                assert(results[t][i] == table.Find(Name(index)).Value());
+            }
+    }
+
+    void TestAsKey()
+    {
+        AtomTable<>             table;
+        UnorderedMap<Atom, int> options;
+        options[table.Intern("--verbose")] = 1;
+        options[table.Intern("--quiet")]   = 2;
+
+        assert(options[table.Intern(String("--verbose"))] == 1);
+        assert(options[table.Intern("--quiet")] == 2);
+        assert(Hash<Atom>{}(table.Intern("--quiet"))
+               == Hash<StringView>{}(StringView("--quiet")));
+        static_assert(IsFastHash<Hash<Atom>>::Value);
+    }
+} // namespace
+
+int main()
+{
+    TestIntern();
+    TestGrowth();
+    TestConcurrentIntern();
+    TestAsKey();
+
+    return 0;
+}
@@ -183,7 +183,69 @@ TEST(BasicString, String_TestMove)
     String next(Move(other));
     ASSERT_TRUE(other.Empty());
     ASSERT_EQ(next.Size(), 5);
+
+    String longString(64, 'x');
+    auto*  buffer = longString.Raw();
+    String stolen = Move(longString);
+    ASSERT_EQ(stolen.Raw(), buffer);
+    ASSERT_TRUE(longString.Empty());
+}
+TEST(BasicString, String_TestShortStringOptimization)
+{
+    ASSERT_EQ(sizeof(String), 3 * sizeof(void*));
+
+    String empty;
+    ASSERT_EQ(empty.Capacity(), sizeof(String) - 1);
+    ASSERT_EQ(empty.Raw()[0], '\0');
+
+    String full = "abcdefghijklmnopqrstuvw"_s;
+    ASSERT_EQ(full.Size(), 23);
+    ASSERT_EQ(full.Capacity(), 23);
+    ASSERT_EQ(full.Raw()[23], '\0');
+    ASSERT_EQ(full, "abcdefghijklmnopqrstuvw");
+
+    full += 'x';
+    ASSERT_EQ(full.Size(), 24);
+    ASSERT_GE(full.Capacity(), 46);
+    ASSERT_EQ(full, "abcdefghijklmnopqrstuvwx");
+
+    auto* buffer = full.Raw();
+    full += "yz";
+    ASSERT_EQ(full.Raw(), buffer);
+
+    full.Resize(4);
+    full.ShrinkToFit();
+    ASSERT_EQ(full.Capacity(), 23);
+    ASSERT_EQ(full, "abcd");
+
+    full += full.View();
+    ASSERT_EQ(full, "abcdabcd");
+
+    String chained = "usr"_s + "/" + "local" + '/' + "share"_s;
+    ASSERT_EQ(chained, "usr/local/share");
+}
+
+// Constant evaluation keeps every string in long mode
+constexpr usize ConstantSize()
+{
+    String s("abc");
+    return s.Size();
+}
+static_assert(ConstantSize() == 3);
+constexpr bool ConstantAppend()
+{
+    String s;
+    s += "usr";
+    s += '/';
+    s += "local/share/applications/x"_sv;
+
+    String moved = Move(s);
+    moved.ShrinkToFit();
+    moved += moved.View();
+    return s.Empty() && moved.Size() == 60
+        && moved.View().Substr(26, 8) == "ns/xusr/" && moved.Raw()[60] == '\0';
 }
+static_assert(ConstantAppend());
 
 TEST(BasicString, String_TestBasicStringAssignments)
 {
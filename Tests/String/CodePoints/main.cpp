@@ -0,0 +1,240 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/String/CodePoints.hpp>
+#include <Prism/String/String.hpp>
+#include <Prism/String/StringView.hpp>
+
+#include <cassert>
+
+using namespace Prism;
+using namespace Prism::Literals;
+
+using CodePoints::UnicodeError;
+
+namespace
+{
+    UnicodeError Validate(std::initializer_list<u8> bytes)
+    {
+        return CodePoints::ValidateUtf8(bytes.begin(), bytes.size()).Error;
+    }
+
+    // A byte-at-a-time reference: decode every code point and encode it
+    // again, which must reproduce the input exactly
+    bool RoundTripsScalar(const char8_t* data, usize size)
+    {
+        for (usize i = 0; i < size;)
+        {
+            char32_t codePoint = 0;
+            usize    length = CodePoints::DecodeUtf8(data + i, size - i,
+                                                     codePoint);
+            if (length == 0) return false;
+
+            char8_t encoded[4];
+            if (CodePoints::EncodeUtf8(codePoint, encoded) != length)
+                return false;
+            for (usize j = 0; j < length; ++j)
+                if (encoded[j] != data[i + j]) return false;
+            i += length;
+        }
+
+        return true;
+    }
+}; // namespace
+
+void CodePoints_TestValidateUtf8()
+{
+    assert(CodePoints::IsValidUtf8("plain ascii"_sv));
+    assert(CodePoints::IsValidUtf8(u8"zażółć gęślą jaźń €𝄞"_sv));
+    assert(CodePoints::IsValidUtf8(""_sv));
+
+    assert(Validate({0xc3, 0xa9}) == UnicodeError::eNone);
+    assert(Validate({0xef, 0xbf, 0xbf}) == UnicodeError::eNone);
+    assert(Validate({0xf4, 0x8f, 0xbf, 0xbf}) == UnicodeError::eNone);
+
+    assert(Validate({0x80}) == UnicodeError::eTooLong);
+    assert(Validate({0xc3}) == UnicodeError::eTooShort);
+    assert(Validate({0xe2, 0x82}) == UnicodeError::eTooShort);
+    assert(Validate({0xe2, 0x28, 0xa1}) == UnicodeError::eTooShort);
+    assert(Validate({0xc0, 0xaf}) == UnicodeError::eOverlong);
+    assert(Validate({0xe0, 0x80, 0xaf}) == UnicodeError::eOverlong);
+    assert(Validate({0xf0, 0x8f, 0xbf, 0xbf}) == UnicodeError::eOverlong);
+    assert(Validate({0xed, 0xa0, 0x80}) == UnicodeError::eSurrogate);
+    assert(Validate({0xf4, 0x90, 0x80, 0x80}) == UnicodeError::eTooLarge);
+    assert(Validate({0xf5, 0x80, 0x80, 0x80}) == UnicodeError::eTooLarge);
+    assert(Validate({0xff}) == UnicodeError::eHeaderBits);
+
+    // Errors deep inside long ASCII runs are found by the block scan, at
+    // every offset relative to the 8/16/32-byte blocks
+    for (usize size : {1, 7, 8, 15, 16, 17, 31, 32, 33, 64, 100})
+    {
+        for (usize at = 0; at < size; ++at)
+        {
+            String text(size, 'a');
+            text[at]    = '\xff';
+            auto result = CodePoints::ValidateUtf8(text.Raw(), text.Size());
+            assert(result.Error == UnicodeError::eHeaderBits);
+            assert(result.Read == at);
+        }
+    }
+
+    static_assert(CodePoints::IsValidUtf8(u8"€uro", 6));
+    static_assert(!CodePoints::IsValidUtf8("\xed\xbf\xbf", 3));
+}
+
+void CodePoints_TestTranscode()
+{
+    constexpr char8_t utf8[]
+        = u8"ASCII prefix that is long enough for blocks: ż€𝄞 and tail";
+    constexpr usize size = sizeof(utf8) - 1;
+    assert(RoundTripsScalar(utf8, size));
+
+    char16_t        utf16[128];
+    usize           utf16Length = CodePoints::Utf16LengthFromUtf8(utf8, size);
+    auto result = CodePoints::ConvertUtf8ToUtf16(utf8, size, utf16, 128);
+    assert(result && result.Read == size && result.Written == utf16Length);
+    assert(utf16[0] == u'A' && utf16[45] == u'ż' && utf16[46] == u'€');
+    assert(utf16[47] == 0xd834 && utf16[48] == 0xdd1e);
+
+    char32_t utf32[128];
+    usize    utf32Length = CodePoints::Utf32LengthFromUtf8(utf8, size);
+    result = CodePoints::ConvertUtf8ToUtf32(utf8, size, utf32, 128);
+    assert(result && result.Written == utf32Length);
+    assert(utf32Length == utf16Length - 1 && utf32[47] == U'𝄞');
+
+    char8_t back[128];
+    assert(CodePoints::Utf8LengthFromUtf16(utf16, utf16Length) == size);
+    result = CodePoints::ConvertUtf16ToUtf8(utf16, utf16Length, back, 128);
+    assert(result && result.Written == size);
+    for (usize i = 0; i < size; ++i) assert(back[i] == utf8[i]);
+
+    char text[128];
+    assert(CodePoints::Utf8LengthFromUtf32(utf32, utf32Length) == size);
+    result = CodePoints::ConvertUtf32ToUtf8(utf32, utf32Length, text, 128);
+    assert(result && StringView(text, result.Written)
+                         == StringView(reinterpret_cast<const char*>(utf8),
+                                       size));
+
+    // Stops before a sequence that does not fit, or at invalid input
+    result = CodePoints::ConvertUtf8ToUtf16(utf8, size, utf16, 45);
+    assert(result.Error == UnicodeError::eOutputTooSmall);
+    assert(result.Read == 45 && result.Written == 45);
+    result = CodePoints::ConvertUtf8ToUtf16(utf8, size, utf16, 48);
+    assert(result.Error == UnicodeError::eOutputTooSmall);
+    assert(result.Read == 50 && result.Written == 47);
+
+    const char16_t lone[] = {u'a', 0xdc00, u'b'};
+    result = CodePoints::ConvertUtf16ToUtf8(lone, 3, back, 128);
+    assert(result.Error == UnicodeError::eSurrogate && result.Read == 1);
+    const char32_t large[] = {U'a', 0x110000};
+    result = CodePoints::ConvertUtf32ToUtf8(large, 2, back, 128);
+    assert(result.Error == UnicodeError::eTooLarge && result.Read == 1);
+}
+
+void CodePoints_TestCharacterClasses()
+{
+    using CodePoints::CharacterClass;
+
+    for (u32 c = 0; c < 256; ++c)
+    {
+        assert(CodePoints::IsClass(c, CharacterClass::eDigit)
+               == (c < 0x80 && CodePoints::IsDigit(c)));
+        assert(CodePoints::IsClass(c, CharacterClass::eSpace)
+               == (c < 0x80 && CodePoints::IsSpace(c)));
+        assert(CodePoints::IsClass(c, CharacterClass::eAlphanumeric)
+               == (c < 0x80 && CodePoints::IsAlphanumeric(c)));
+    }
+    assert(!CodePoints::IsClass('\xe9', CharacterClass::eControl));
+
+    // Every length and alignment crosses the vector, SWAR and scalar paths
+    constexpr char pattern[] = " \tKey_42: Zażółć\r\n{}\x7f\v";
+    char           text[160];
+    for (usize i = 0; i < sizeof(text); ++i)
+        text[i] = pattern[(i * 7) % (sizeof(pattern) - 1)];
+
+    for (usize offset = 0; offset < 8; ++offset)
+    {
+        for (usize size = 0; offset + size <= sizeof(text); size += 3)
+        {
+            const char* data = text + offset;
+            for (auto classes :
+                 {CharacterClass::eDigit, CharacterClass::eSpace,
+                  CharacterClass::eAlpha | CharacterClass::ePunctuation,
+                  CharacterClass::eControl, CharacterClass::eHexDigit})
+            {
+                usize expected = 0;
+                for (usize i = 0; i < size; ++i)
+                    expected += CodePoints::IsClass(data[i], classes);
+                assert(CodePoints::CountIf(data, size, classes) == expected);
+            }
+
+            usize first = usize(-1);
+            usize last  = usize(-1);
+            for (usize i = 0; i < size; ++i)
+            {
+                if (CodePoints::IsSpace(data[i])) continue;
+                if (first == usize(-1)) first = i;
+                last = i;
+            }
+            assert(CodePoints::FindFirstNonSpace(data, size) == first);
+            assert(CodePoints::FindLastNonSpace(data, size) == last);
+
+            char upper[160];
+            char lower[160];
+            for (usize i = 0; i < size; ++i) upper[i] = lower[i] = data[i];
+            CodePoints::ToUpperInPlace(upper, size);
+            CodePoints::ToLowerInPlace(lower, size);
+            for (usize i = 0; i < size; ++i)
+            {
+                const u8 c = data[i];
+                assert(upper[i] == char(c < 0x80 ? CodePoints::ToUpper(c) : c));
+                assert(lower[i] == char(c < 0x80 ? CodePoints::ToLower(c) : c));
+            }
+
+            assert(CodePoints::EqualsIgnoreCase(upper, size, lower, size));
+            assert(CodePoints::CompareIgnoreCase(upper, size, data, size)
+                   == 0);
+            if (size == 0) continue;
+
+            lower[size - 1] = '~';
+            const i32 expected
+                = i32(CodePoints::ToLower(u8(data[size - 1]))) - i32('~');
+            assert(!CodePoints::EqualsIgnoreCase(upper, size, lower, size));
+            assert(CodePoints::CompareIgnoreCase(upper, size, lower, size)
+                   == expected);
+        }
+    }
+
+    assert(CodePoints::CompareIgnoreCase("abc", 3, "ABCD", 4) < 0);
+    assert(CodePoints::CompareIgnoreCase("abd", 3, "ABCD", 4) > 0);
+    assert(!CodePoints::EqualsIgnoreCase("[", 1, "{", 1));
+    static_assert(CodePoints::EqualsIgnoreCase("Content-Length", 14,
+                                               "content-length", 14));
+    static_assert(CodePoints::CountIf("a1b2c3", 6,
+                                      CodePoints::CharacterClass::eDigit)
+                  == 3);
+
+    assert(" \t key = value \r\n"_sv.Trim() == "key = value");
+    assert(" \t key \n"_sv.Trim(TrimMode::eLeft) == "key \n");
+    assert(" \t key \n"_sv.Trim(TrimMode::eRight) == " \t key");
+    assert(" \t\r\n                  "_sv.Trim().Empty());
+    assert(""_sv.Trim().Empty());
+    assert("Host"_sv.EqualsIgnoreCase("hOST"));
+    assert("Host"_sv.CompareIgnoreCase("hosts") < 0);
+
+    String hex = "deadbeef"_s;
+    CodePoints::ToUpperInPlace(hex);
+    assert(hex.View() == "DEADBEEF");
+}
+
+int main()
+{
+    CodePoints_TestValidateUtf8();
+    CodePoints_TestTranscode();
+    CodePoints_TestCharacterClasses();
+
+    return 0;
+}
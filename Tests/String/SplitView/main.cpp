@@ -0,0 +1,144 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Core/Ranges.hpp>
+#include <Prism/String/SplitView.hpp>
+#include <Prism/String/StringView.hpp>
+
+#include <cassert>
+#include <ranges>
+
+using namespace Prism;
+using namespace Prism::StringViewLiterals;
+
+namespace
+{
+    template <typename Range>
+    bool Yields(Range&& range, std::initializer_list<StringView> tokens)
+    {
+        auto expected = tokens.begin();
+        for (StringView token : range)
+        {
+            if (expected == tokens.end() || token != *expected) return false;
+            ++expected;
+        }
+
+        return expected == tokens.end();
+    }
+
+    void TestCharacterDelimiter()
+    {
+        assert(Yields(Split("a,b,c"_sv, ','), {"a", "b", "c"}));
+        assert(Yields(Split("abc"_sv, ','), {"abc"}));
+        assert(Yields(Split(","_sv, ','), {"", ""}));
+        assert(Yields(Split(",a,,b,"_sv, ','), {"", "a", "", "b", ""}));
+        assert(Yields(Split(",a,,b,"_sv, ',', SplitBehavior::eSkipEmpty),
+                      {"a", "b"}));
+        assert(Yields(Split(",,,"_sv, ',', SplitBehavior::eSkipEmpty), {}));
+
+        // Empty text has no tokens at all
+        assert(Split(""_sv, ',').Empty());
+        assert(Split(""_sv, ',').Count() == 0);
+        assert(Split("a,b,,c"_sv, ',').Count() == 4);
+        assert(Split("first/second"_sv, '/').Front() == "first");
+    }
+
+    void TestStringDelimiter()
+    {
+        assert(Yields(Split("a::b::c"_sv, "::"_sv), {"a", "b", "c"}));
+        assert(Yields(Split("::a::::b"_sv, "::"_sv), {"", "a", "", "b"}));
+        assert(Yields(Split("a:b"_sv, "::"_sv), {"a:b"}));
+        assert(Yields(Split("a\r\nb\r\n"_sv, "\r\n"_sv,
+                            SplitBehavior::eSkipEmpty),
+                      {"a", "b"}));
+        // Overlapping candidates are consumed left to right
+        assert(Yields(Split("aaa"_sv, "aa"_sv), {"", "a"}));
+    }
+
+    void TestCharacterSet()
+    {
+        assert(Yields(SplitAny("a,b;c d"_sv, ",; "_sv), {"a", "b", "c", "d"}));
+        assert(Yields(SplitAny("a,;b"_sv, ",;"_sv), {"a", "", "b"}));
+        assert(Yields(SplitAny("\xff" "a\x80"_sv, "\x80\xff"_sv),
+                      {"", "a", ""}));
+
+        assert(Yields(Tokenize("  ls  -la\t/home \n"_sv),
+                      {"ls", "-la", "/home"}));
+        assert(Yields(Tokenize(" \t\n"_sv), {}));
+        assert(Yields(Tokenize("key = value"_sv, " ="_sv), {"key", "value"}));
+    }
+
+    void TestWideCharacters()
+    {
+        constexpr BasicStringView<char16_t> text = u"x|y||z";
+        auto split = Split(text, u'|', SplitBehavior::eSkipEmpty);
+        assert(split.Count() == 3);
+        assert(*split.begin() == BasicStringView<char16_t>(u"x"));
+
+        auto any = SplitAny(text, BasicStringView<char16_t>(u"|y"));
+        assert(any.Count() == 5);
+    }
+
+    void TestTokensAreViews()
+    {
+        StringView text = "usr/local/bin";
+        for (StringView token : Split(text, '/'))
+            assert(token.Raw() >= text.Raw()
+                   && token.Raw() + token.Size() <= text.Raw() + text.Size());
+
+        auto it = Split(text, '/').begin();
+        auto copy = it++;
+        assert(*copy == "usr" && *it == "local");
+        assert(copy != it);
+
+        // Iterators keep working after the temporary range is destroyed
+        auto first = std::ranges::begin(Split("a,b"_sv, ','));
+        assert(*first == "a" && *++first == "b");
+        assert(++first == Split(""_sv, ',').end());
+    }
+
+    void TestRanges()
+    {
+        auto split = Split("10,2,,300"_sv, ',', SplitBehavior::eSkipEmpty);
+        static_assert(std::ranges::forward_range<decltype(split)>);
+        static_assert(std::ranges::borrowed_range<decltype(split)>);
+
+        usize total = 0;
+        for (usize size : split
+                              | std::views::transform([](StringView token)
+                                                      { return token.Size(); }))
+            total += size;
+        assert(total == 6);
+
+        auto long_ = split
+                   | std::views::filter([](StringView token)
+                                        { return token.Size() > 1; });
+        assert(Yields(long_, {"10", "300"}));
+        assert(std::ranges::distance(split) == 3);
+
+        assert(*Begin(split) == "10" && Begin(split) != End(split));
+        assert(!Empty(split) && Empty(Split(""_sv, ',')));
+    }
+
+    constexpr usize CountFields(StringView line)
+    {
+        return Split(line, ':').Count();
+    }
+    static_assert(CountFields("root:x:0:0:root:/root:/bin/sh") == 7);
+    static_assert(Tokenize("  a b  "_sv).Count() == 2);
+} // namespace
+
+int main()
+{
+    TestCharacterDelimiter();
+    TestStringDelimiter();
+    TestCharacterSet();
+    TestWideCharacters();
+    TestTokensAreViews();
+    TestRanges();
+
+    return 0;
+}
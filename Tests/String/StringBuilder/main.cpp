@@ -7,6 +7,7 @@
 #include <utility>
 
 #include <Prism/Containers/DoublyLinkedList.hpp>
+#include <Prism/Containers/RingBuffer.hpp>
 #include <Prism/Core/Types.hpp>
 #include <Prism/String/Formatter.hpp>
 #include <Prism/String/String.hpp>
@@ -16,6 +17,7 @@
 #include <Prism/Core/Types.hpp>
 
 using namespace Prism;
+using namespace Prism::Literals;
 
 int main()
 {
@@ -28,7 +30,105 @@ int main()
     //
     BasicString<char> final = sb;
     printf("final: %s\n", final.Raw());
+    assert(final.View()
+           == "val: 000000ff\nval:     42\nval: 0XABCDEF\nval: 0b100000\n");
+
+    (void)Print("Hello, {} {:#x}, {:#x}", 2, 3, 4);
+
+    // Compiled format strings
+    assert(Format1("plain text").View() == "plain text");
+    assert(Format1("{} + {} = {}", 1, 2, 3).View() == "1 + 2 = 3");
+    assert(Format1("{{{}}} {{}}", 7).View() == "{7} {}");
+    assert(Format1("[{:<6}][{:>6}][{:^6}]", "ab", "cd", "ef").View()
+           == "[ab    ][    cd][  ef  ]");
+    assert(Format1("[{:*^7}]", -42).View() == "[**-42**]");
+    assert(Format1("{:08}|{:#010x}", -42, 255).View()
+           == "-0000042|0x000000ff");
+    assert(Format1("{} {:d} {:c}", 'A', 'A', 65).View() == "A 65 A");
+    assert(Format1("{} {}", true, false).View() == "true false");
+    assert(Format1("{:o} {:#o} {:b}", 8, 8, 5u).View() == "10 010 101");
+    assert(Format1("{}", -9223372036854775807ll - 1).View()
+           == "-9223372036854775808");
+    assert(Format1("{} {}", "view"_sv, String("string")).View()
+           == "view string");
+    assert(Format1("{}", static_cast<void*>(nullptr)).View() == "0x0");
+
+    // Bounded and counting sinks
+    assert(FormattedSize("{}-{:#x}", -1, 255) == 7);
+
+    char buffer[8];
+    auto result = FormatTo(Span<char>(buffer), "{} {}", 12, "abc");
+    assert(!result.Truncated() && result.Written == 6);
+    assert(StringView(buffer, result.Written) == "12 abc");
+    result = FormatTo(buffer, "{:>10}", 42);
+    assert(result.Truncated() && result.Written == 8 && result.Size == 10);
+    assert(StringView(buffer, 8) == "        ");
+
+    char  iteratorBuffer[16] = {};
+    char* end
+        = FormatTo(static_cast<char*>(iteratorBuffer), "{}{}", 'x', 7);
+    assert(end == iteratorBuffer + 2 && StringView(iteratorBuffer) == "x7");
+
+    Vector<char> characters;
+    struct PushBackIterator
+    {
+        Vector<char>*     Target;
+        PushBackIterator& operator*() { return *this; }
+        PushBackIterator& operator++(int) { return *this; }
+        PushBackIterator& operator=(char ch)
+        {
+            Target->PushBack(ch);
+            return *this;
+        }
+    };
+    FormatTo(PushBackIterator{&characters}, "{:04}", 12);
+    assert(StringView(characters.Raw(), characters.Size()) == "0012");
+
+    // A message wrapping around the end of a ring buffer is published whole
+    RingBuffer ring(8);
+    u8         scratch[8];
+    assert(ring.Write(reinterpret_cast<const u8*>("abcde"), 5) == 5);
+    assert(ring.Read(scratch, 5) == 5);
+    result = FormatTo(ring, "{}:{}", 12, 345);
+    assert(!result.Truncated() && ring.Used() == 6);
+    assert(ring.Read(scratch, 8) == 6);
+    assert(StringView(reinterpret_cast<char*>(scratch), 6) == "12:345");
+    result = FormatTo(ring, "{}", "0123456789");
+    assert(result.Truncated() && result.Written == 8 && ring.Used() == 8);
+
+    // Longer than the stack buffer Format1 tries first
+    String long1 = Format1("{:>300}", 1);
+    assert(long1.Size() == 300 && long1[299] == '1' && long1[0] == ' ');
+
+    StringBuilder<char> noArgs;
+    FormatTo(noArgs, "}}{{");
+    assert(BasicString<char>(noArgs).View() == "}{");
+
+    // Contiguous buffer, fill/repeat and zero-copy materialization
+    StringBuilder<char> report(64);
+    assert(report.Empty() && report.Capacity() >= 64);
+    report << "pid"_sv << ':' << u64(1234);
+    report.AppendFill(' ', 3);
+    report.AppendRepeated("ab", 3);
+    report.AppendFormatted(" [{:>4}|{:#x}]", 7, 255u);
+    assert(report.View() == "pid:1234   ababab [   7|0xff]");
+    report.Insert("> ");
+    assert(report.View() == "> pid:1234   ababab [   7|0xff]");
+    report.AppendRepeated(report.View().Substr(2, 3), 2);
+    assert(report.View() == "> pid:1234   ababab [   7|0xff]pidpid");
+
+    StringBuilder<char> large;
+    for (usize i = 0; i < 1000; ++i) large.AppendFormatted("{};", i % 10);
+    assert(large.Size() == 2000);
+    const char* data  = large.View().Raw();
+    String      moved = Move(large).ToString();
+    assert(moved.Raw() == data && moved.Size() == 2000);
+    assert(moved[0] == '0' && moved[1998] == '9' && large.Empty());
+
+    large.AppendRepeated("xyz", 100);
+    assert(large.Size() == 300 && large.View().Substr(297) == "xyz");
+    large.Reset();
+    assert(large.Empty() && large.Capacity() >= 300);
 
-    (void)Print("Hello, {} {:#x}, {:#x}", 2);
     return 0;
 }
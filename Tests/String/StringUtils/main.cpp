@@ -81,9 +81,112 @@ void StringUtils_Test_ToString_ToNumber()
     assert(ToNumber<u64>("999"_sv, 8) == 511);
     assert(ToNumber<u64>("242"_sv, 8) == 162);
 }
+void StringUtils_TestToChars()
+{
+    char buffer[66];
+    auto toChars = [&](auto value, u32 base = 10)
+    {
+        auto result = ToChars(buffer, buffer + sizeof(buffer), value, base);
+        assert(result.Error == CharsError::eNone);
+        return StringView(buffer, static_cast<usize>(result.End - buffer));
+    };
+
+    assert(toChars(0) == "0"_sv);
+    assert(toChars(7) == "7"_sv);
+    assert(toChars(42) == "42"_sv);
+    assert(toChars(-42) == "-42"_sv);
+    assert(toChars(1234567) == "1234567"_sv);
+    assert(toChars(NumericLimits<i8>::Min()) == "-128"_sv);
+    assert(toChars(NumericLimits<u16>::Max()) == "65535"_sv);
+    assert(toChars(NumericLimits<i32>::Min()) == "-2147483648"_sv);
+    assert(toChars(NumericLimits<u64>::Max()) == "18446744073709551615"_sv);
+    assert(toChars(NumericLimits<i64>::Min()) == "-9223372036854775808"_sv);
+    assert(toChars(255u, 16) == "ff"_sv);
+    assert(toChars(255u, 2) == "11111111"_sv);
+    assert(toChars(-8, 8) == "-10"_sv);
+    assert(toChars(35u, 36) == "z"_sv);
+    assert(toChars(100u, 3) == "10201"_sv);
+    assert(toChars(NumericLimits<u64>::Max(), 2).Size() == 64);
+
+    // Every power of ten and its neighbours
+    for (u64 value = 1; value < 10000000000000000000ull; value *= 10)
+    {
+        for (u64 v : {value - 1, value, value + 1})
+        {
+            assert(toChars(v) == StringView(std::to_string(v).c_str()));
+            assert(GetDigitCount(v) == std::to_string(v).size());
+        }
+    }
+
+    char small[4];
+    auto result = ToChars(small, small + sizeof(small), 12345);
+    assert(result.Error == CharsError::eValueTooLarge);
+    assert(result.End == small + sizeof(small));
+    result = ToChars(small, small + sizeof(small), -123);
+    assert(result.Error == CharsError::eNone && result.End == small + 4);
+
+    static_assert(GetDigitCount(0) == 1);
+    static_assert(GetDigitCount(-999) == 3);
+    static_assert(GetDigitCount(0xffu, 16) == 2);
+}
+void StringUtils_TestFromChars()
+{
+    auto fromChars = []<typename T>(StringView string, T& value, u32 base = 10)
+    { return FromChars(string, value, base); };
+
+    u64 u = 0;
+    assert(fromChars("12345678901234567890"_sv, u).Error == CharsError::eNone);
+    assert(u == 12345678901234567890ull);
+    assert(fromChars("18446744073709551615"_sv, u).Error == CharsError::eNone);
+    assert(u == NumericLimits<u64>::Max());
+    assert(fromChars("18446744073709551616"_sv, u).Error
+           == CharsError::eResultOutOfRange);
+    assert(fromChars("99999999999999999999999"_sv, u).Error
+           == CharsError::eResultOutOfRange);
+    assert(u == NumericLimits<u64>::Max());
+
+    i64  i      = 0;
+    auto result = fromChars("-9223372036854775808 rest"_sv, i);
+    assert(result.Error == CharsError::eNone);
+    assert(i == NumericLimits<i64>::Min());
+    assert(StringView(result.End, 5) == " rest"_sv);
+    assert(fromChars("9223372036854775808"_sv, i).Error
+           == CharsError::eResultOutOfRange);
+    assert(fromChars("-"_sv, i).Error == CharsError::eInvalidArgument);
+    assert(fromChars("x1"_sv, i).Error == CharsError::eInvalidArgument);
+    assert(fromChars("-12345678x"_sv, i).Error == CharsError::eNone);
+    assert(i == -12345678);
+
+    u8 byte = 0;
+    assert(fromChars("255"_sv, byte).Error == CharsError::eNone && byte == 255);
+    assert(fromChars("256"_sv, byte).Error == CharsError::eResultOutOfRange);
+    assert(fromChars("-1"_sv, byte).Error == CharsError::eInvalidArgument);
+
+    i8 signedByte = 0;
+    assert(fromChars("-128"_sv, signedByte).Error == CharsError::eNone);
+    assert(signedByte == -128);
+    assert(fromChars("128"_sv, signedByte).Error
+           == CharsError::eResultOutOfRange);
+
+    assert(fromChars("DeadBeef"_sv, u, 16).Error == CharsError::eNone);
+    assert(u == 0xdeadbeef);
+    assert(fromChars("1012"_sv, u, 2).Error == CharsError::eNone && u == 5);
+
+    // Roundtrip across the SWAR chunk boundaries
+    for (u64 value = 1; value < 10000000000000000000ull; value = value * 7 + 3)
+    {
+        String string = ToString(value);
+        assert(fromChars(string.View(), u).Error == CharsError::eNone);
+        assert(u == value);
+    }
+
+    static_assert(ToNumber<i32>("-2147483648"_sv) == NumericLimits<i32>::Min());
+}
 int main()
 {
     StringUtils_TestGetDigitCount();
+    StringUtils_TestToChars();
+    StringUtils_TestFromChars();
 
     return 0;
 }
@@ -0,0 +1,156 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Containers/Vector.hpp>
+#include <Prism/Utility/Checksum.hpp>
+
+#include <cassert>
+
+using namespace Prism;
+
+namespace
+{
+    constexpr u8 CHECK[]     = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    constexpr u8 WIKIPEDIA[] = {'W', 'i', 'k', 'i', 'p', 'e', 'd', 'i', 'a'};
+
+    // Bit at a time, straight from the definitions
+    u32 ReferenceCrc(u32 polynomial, const u8* data, usize size)
+    {
+        u32 crc = 0xffffffff;
+        for (usize i = 0; i < size; ++i)
+        {
+            crc ^= data[i];
+            for (i32 bit = 0; bit < 8; ++bit)
+                crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+        }
+
+        return ~crc;
+    }
+    u32 ReferenceAdler32(const u8* data, usize size)
+    {
+        u32 a = 1, b = 0;
+        for (usize i = 0; i < size; ++i)
+        {
+            a = (a + data[i]) % Adler32::MOD_ADLER;
+            b = (b + a) % Adler32::MOD_ADLER;
+        }
+
+        return (b << 16) | a;
+    }
+
+    u64 g_State = 0x2545'f491'4f6c'dd1dull;
+    u8  NextByte()
+    {
+        g_State ^= g_State << 13;
+        g_State ^= g_State >> 7;
+        g_State ^= g_State << 17;
+        return static_cast<u8>(g_State);
+    }
+
+    void TestKnownAnswers()
+    {
+        assert(CRC32::DoChecksum(CHECK, 9) == 0xcbf43926);
+        assert(CRC32C::DoChecksum(CHECK, 9) == 0xe3069283);
+        assert(Adler32::DoChecksum(WIKIPEDIA, 9) == 0x11e60398);
+
+        assert(CRC32::DoChecksum(nullptr, 0) == CRC32::INITIAL);
+        assert(CRC32C::DoChecksum(nullptr, 0) == CRC32C::INITIAL);
+        assert(Adler32::DoChecksum(nullptr, 0) == Adler32::INITIAL);
+
+        static_assert(CRC32::DoChecksum(CHECK, 9) == 0xcbf43926);
+        static_assert(CRC32C::DoChecksum(CHECK, 9) == 0xe3069283);
+        static_assert(Adler32::DoChecksum(WIKIPEDIA, 9) == 0x11e60398);
+        static_assert(CRC32::GenerateTableEntry(1) == 0x77073096);
+    }
+
+    // Every size around the vector block and folding thresholds, at
+    // every alignment of a 16-byte vector
+    void TestAgainstReference()
+    {
+        Vector<u8> buffer;
+        buffer.Resize(4096 + 16);
+        for (auto& byte : buffer) byte = NextByte();
+
+        for (usize size = 0; size <= 4096;
+             size += size < 600 ? 1 : 61 + size % 7)
+            for (usize offset : {0zu, 1zu, 7zu, 15zu})
+            {
+                const u8* data = buffer.Raw() + offset;
+                assert(CRC32::DoChecksum(data, size)
+                       == ReferenceCrc(CRC32::CRC32_POLY, data, size));
+                assert(CRC32C::DoChecksum(data, size)
+                       == ReferenceCrc(CRC32C::CRC32C_POLY, data, size));
+                assert(Adler32::DoChecksum(data, size)
+                       == ReferenceAdler32(data, size));
+            }
+    }
+
+    void TestIncremental()
+    {
+        Vector<u8> buffer;
+        buffer.Resize(3000);
+        for (auto& byte : buffer) byte = NextByte();
+
+        const u8* data  = buffer.Raw();
+        usize     size  = buffer.Size();
+        u32       crc   = CRC32::DoChecksum(data, size);
+        u32       crcc  = CRC32C::DoChecksum(data, size);
+        u32       adler = Adler32::DoChecksum(data, size);
+        for (usize split : {0zu, 1zu, 15zu, 64zu, 129zu, 1000zu, 2999zu})
+        {
+            usize rest = size - split;
+            assert(CRC32::Update(CRC32::DoChecksum(data, split), data + split,
+                                 rest)
+                   == crc);
+            assert(CRC32C::Update(CRC32C::DoChecksum(data, split),
+                                  data + split, rest)
+                   == crcc);
+            assert(Adler32::Update(Adler32::DoChecksum(data, split),
+                                   data + split, rest)
+                   == adler);
+        }
+
+        // Many small updates
+        u32 running = CRC32C::INITIAL;
+        for (usize offset = 0; offset < size; offset += 7)
+            running = CRC32C::Update(running, data + offset,
+                                     offset + 7 <= size ? 7 : size - offset);
+        assert(running == crcc);
+    }
+
+    // All 0xff bytes drive the Adler-32 sums to their largest values
+    // before each reduction
+    void TestAdlerOverflow()
+    {
+        Vector<u8> buffer;
+        buffer.Resize(Adler32::NMAX * 3 + 100);
+        for (auto& byte : buffer) byte = 0xff;
+
+        for (usize size : {Adler32::NMAX - 1, Adler32::NMAX,
+                           Adler32::NMAX + 1, buffer.Size()})
+            assert(Adler32::DoChecksum(buffer.Raw(), size)
+                   == ReferenceAdler32(buffer.Raw(), size));
+
+        u32 adler = Adler32::Update(0xfff0fff0, buffer.Raw(), buffer.Size());
+        u32 a = 0xfff0, b = 0xfff0;
+        for (usize i = 0; i < buffer.Size(); ++i)
+        {
+            a = (a + 0xff) % Adler32::MOD_ADLER;
+            b = (b + a) % Adler32::MOD_ADLER;
+        }
+        assert(adler == ((b << 16) | a));
+    }
+} // namespace
+
+int main()
+{
+    TestKnownAnswers();
+    TestAgainstReference();
+    TestIncremental();
+    TestAdlerOverflow();
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Created by v1tr10l7 on 18.10.2026.
+ * Copyright (c) 2024-2026, Szymon Zemke <v1tr10l7@proton.me>
+ *
+ * SPDX-License-Identifier: GPL-3
+ */
+#include <Prism/Utility/Path.hpp>
+
+#include <cassert>
+
+using namespace Prism;
+
+namespace
+{
+    bool Normalizes(const char* path, const char* expected)
+    {
+        Path normalized = path;
+        return normalized.Normalize() == expected;
+    }
+    template <typename Range>
+    bool Yields(const Range& range, std::initializer_list<StringView> names)
+    {
+        auto expected = names.begin();
+        for (StringView name : range)
+        {
+            if (expected == names.end() || name != *expected) return false;
+            ++expected;
+        }
+
+        return expected == names.end();
+    }
+
+    void TestComponents()
+    {
+        PathView path = "//usr/local//lib/";
+        assert(Yields(path.Components(), {"usr", "local", "lib"}));
+        assert(path.Absolute());
+
+        auto components = path.Components();
+        auto it         = components.end();
+        assert(*--it == "lib");
+        assert(*--it == "local");
+        assert(*--it == "usr");
+        assert(it == components.begin());
+        assert((*it).Raw() == path.Raw() + 2 && it.Offset() == 2);
+
+        usize count = 0;
+        for (auto rit = components.rbegin(); rit != components.rend(); ++rit)
+        {
+            StringView expected[] = {"lib", "local", "usr"};
+            assert(*rit == expected[count++]);
+        }
+        assert(count == 3);
+
+        assert(Yields(PathView("relative/file").Components(),
+                      {"relative", "file"}));
+        assert(PathView("").Components().Empty());
+        assert(PathView("///").Components().Empty());
+        assert(Yields(Path("a/./b").Components(), {"a", ".", "b"}));
+    }
+
+    void TestNames()
+    {
+        PathView path = "/usr/lib//libc.so.6/";
+        assert(path.BaseName() == "libc.so.6");
+        assert(path.ParentName() == "lib");
+        assert(path.Extension() == "6");
+
+        assert(PathView("/dir/file.txt").Extension() == "txt");
+        assert(PathView("/dir/.hidden").Extension() == "");
+        assert(PathView("file").BaseName() == "file");
+        assert(PathView("file").ParentName() == "");
+        assert(PathView("/file").ParentName() == "");
+        assert(PathView("/").BaseName() == "");
+        assert(PathView("").BaseName() == "");
+
+        // The size given to the constructor bounds the view
+        assert(PathView("/usr/lib", 4).BaseName() == "usr");
+    }
+
+    void TestNormalize()
+    {
+        assert(Normalizes("", ""));
+        assert(Normalizes("/", "/"));
+        assert(Normalizes("///", "/"));
+        assert(Normalizes(".", "."));
+        assert(Normalizes("./", "."));
+        assert(Normalizes("a/..", "."));
+        assert(Normalizes("/usr//local/./lib/", "/usr/local/lib"));
+        assert(Normalizes("/usr/local/../lib", "/usr/lib"));
+        assert(Normalizes("/..", "/"));
+        assert(Normalizes("/../../etc", "/etc"));
+        assert(Normalizes("../a", "../a"));
+        assert(Normalizes("../a/../..", "../.."));
+        assert(Normalizes("a/b/../../..", ".."));
+        assert(Normalizes("./a/./b/.", "a/b"));
+        assert(Normalizes("a/.../b", "a/.../b"));
+        assert(Normalizes("a/..b/.c", "a/..b/.c"));
+        assert(Normalizes("//a//b//../c//", "/a/c"));
+
+        // A path normalizes to itself once normalized
+        Path path = "/x/./y/../../z//w/";
+        path.Normalize();
+        Path again = path;
+        assert(again.Normalize() == path && path == "/z/w");
+    }
+
+    void TestJoin()
+    {
+        assert(Path::Join("/usr", "lib", "libc.so") == "/usr/lib/libc.so");
+        assert(Path::Join("/usr/", "/lib", "libc.so") == "/usr/lib/libc.so");
+        assert(Path::Join("/usr/", "lib/", "/libc.so") == "/usr/lib/libc.so");
+        assert(Path::Join("/usr", "//lib", "//") == "/usr/lib");
+        assert(Path::Join("", "/etc") == "/etc");
+        assert(Path::Join("a//b", "c") == "a//b/c");
+        assert(Path::Join("", "a", "", "b") == "a/b");
+        assert(Path::Join("/", "etc") == "/etc");
+        assert(Path::Join("a") == "a");
+        assert(Path::Join("", "") == "");
+
+        String     base = "/home";
+        StringView user = "user";
+        Path       joined = Path::Join(base, user, PathView(".config"));
+        assert(joined == "/home/user/.config");
+    }
+} // namespace
+
+int main()
+{
+    TestComponents();
+    TestNames();
+    TestNormalize();
+    TestJoin();
+
+    return 0;
+}